@@ -0,0 +1,400 @@
+/////////////////
+///
+/// BenchmarkLayer.cpp
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Runs scripted stress scenes for a fixed number
+/// of frames along a deterministic camera path and
+/// writes frame time percentiles and Renderer2D
+/// stats to a CSV file.
+///
+/////////////////
+
+#include "BenchmarkLayer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+#include <Violet/Core/Time.h>
+
+static constexpr uint32_t s_SpriteCount = 100000;
+static constexpr uint32_t s_TextureCount = 64;
+static constexpr uint32_t s_OverdrawLayers = 128;
+static constexpr float s_WorldHalfWidth = 160.0f;
+static constexpr float s_WorldHalfHeight = 90.0f;
+
+// Scenes advance by a fixed step per frame, never by the clock.
+static constexpr float s_FrameStep = 1.0f / 60.0f;
+
+/**
+ * @brief A xorshift generator, the standard distributions are
+ * not guaranteed to give the same numbers on every platform.
+ * @param p_State The state of the generator.
+ * @returns A number in [0, 1).
+ */
+static float Random(uint32_t& p_State)
+{
+	p_State ^= p_State << 13;
+	p_State ^= p_State >> 17;
+	p_State ^= p_State << 5;
+	return (p_State >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief Wraps a coordinate into [-p_HalfExtent, p_HalfExtent).
+ */
+static float Wrap(float p_Value, float p_HalfExtent)
+{
+	float extent = p_HalfExtent * 2.0f;
+	float wrapped = fmodf(p_Value + p_HalfExtent, extent);
+	return (wrapped < 0.0f ? wrapped + extent : wrapped) - p_HalfExtent;
+}
+
+/**
+ * @brief Gets a percentile of sorted values, by nearest rank.
+ */
+static float Percentile(const std::vector<float>& p_Sorted, float p_Percentile)
+{
+	if (p_Sorted.empty())
+		return 0.0f;
+
+	size_t rank = (size_t)std::ceil(p_Percentile / 100.0f * p_Sorted.size());
+	return p_Sorted[std::min(std::max(rank, (size_t)1), p_Sorted.size()) - 1];
+}
+
+BenchmarkLayer::BenchmarkLayer(const BenchmarkSettings& p_Settings)
+	: Layer("BenchmarkLayer"), m_Settings(p_Settings), m_Camera(-1.0f, 1.0f, -1.0f, 1.0f)
+{
+	SetEventCategories(Violet::EventCategoryApplication);
+
+	const Scene scenes[] = { Scene::StaticSprites, Scene::MovingSprites, Scene::ManyTextures, Scene::Overdraw };
+	for (Scene scene : scenes)
+	{
+		if (m_Settings.Scene == "all" || m_Settings.Scene == GetSceneName(scene))
+			m_Scenes.push_back(scene);
+	}
+
+	if (m_Scenes.empty())
+		VT_ERROR("Unknown Benchmark Scene '{0}'", m_Settings.Scene);
+}
+
+void BenchmarkLayer::OnAttach()
+{
+	VT_PROFILE_FUNCTION();
+
+	Violet::Window& window = Violet::Application::Get().GetWindow();
+	m_AspectRatio = (float)window.GetWidth() / (float)window.GetHeight();
+
+	// Frame times must not be capped by the display.
+	window.SetVSync(false);
+
+	// Small checkerboards, each a different color.
+	uint32_t state = 0x9e3779b9;
+	for (uint32_t i = 0; i < s_TextureCount; i++)
+	{
+		uint32_t color = 0xff000000 | ((uint32_t)(Random(state) * 255.0f) << 16) | ((uint32_t)(Random(state) * 255.0f) << 8) | (uint32_t)(Random(state) * 255.0f);
+		uint32_t pixels[8 * 8];
+		for (uint32_t p = 0; p < 8 * 8; p++)
+			pixels[p] = ((p % 8) + (p / 8)) % 2 ? color : 0xffffffff;
+
+		m_Textures.push_back(Violet::Texture2D::Create(8, 8));
+		m_Textures.back()->SetData(pixels, sizeof(pixels));
+	}
+
+	if (m_Scenes.empty())
+	{
+		Violet::Application::Get().Close();
+		return;
+	}
+
+	BeginScene(m_Scenes[0]);
+	m_LastFrameTime = Violet::Time::GetNanoseconds();
+}
+
+void BenchmarkLayer::OnDetach()
+{
+	VT_PROFILE_FUNCTION();
+
+	m_Textures.clear();
+}
+
+void BenchmarkLayer::OnUpdate(Violet::Timestep p_Timestep)
+{
+	VT_PROFILE_FUNCTION();
+
+	// The time since the last update is the whole of the last frame, present included.
+	uint64_t time = Violet::Time::GetNanoseconds();
+	float frameTime = (float)((time - m_LastFrameTime) * 1e-6);
+	m_LastFrameTime = time;
+
+	if (m_SceneIndex >= m_Scenes.size())
+		return;
+
+	if (m_Frame > m_Settings.WarmupFrames)
+		m_Current.FrameTimes.push_back(frameTime);
+
+	if (m_Frame == m_Settings.WarmupFrames + m_Settings.FrameCount)
+	{
+		EndScene();
+		if (++m_SceneIndex == m_Scenes.size())
+		{
+			WriteResults();
+			Violet::Application::Get().Close();
+			return;
+		}
+		BeginScene(m_Scenes[m_SceneIndex]);
+	}
+
+	float sceneTime = m_Frame * s_FrameStep;
+	UpdateCamera(sceneTime);
+
+	Violet::RenderCommand::SetClearColor({ 0.1f, 0.1f, 0.1f, 1 });
+	Violet::RenderCommand::Clear();
+
+	Violet::Renderer2D::ResetStats();
+	DrawScene(sceneTime);
+
+	if (m_Frame >= m_Settings.WarmupFrames)
+	{
+		Violet::Renderer2D::Statistics stats = Violet::Renderer2D::GetStats();
+		m_Current.DrawCalls += stats.DrawCalls;
+		m_Current.QuadCount += stats.QuadCount;
+		m_Current.BytesUploaded += stats.BytesUploaded;
+		m_Current.TexturesBound += stats.TexturesBound;
+	}
+
+	m_Frame++;
+}
+
+void BenchmarkLayer::OnEvent(Violet::Event& p_Event)
+{
+	Violet::EventDispatcher dispatcher(p_Event);
+	dispatcher.Dispatch<&BenchmarkLayer::OnWindowResized>(this);
+}
+
+bool BenchmarkLayer::OnWindowResized(Violet::WindowResizeEvent& p_Event)
+{
+	if (p_Event.GetHeight() > 0)
+		m_AspectRatio = (float)p_Event.GetWidth() / (float)p_Event.GetHeight();
+	return false;
+}
+
+/**
+ * @brief Parses the benchmark options of the command line.
+ * @param p_Args The command line arguments.
+ * @param p_Settings Receives the options that were given.
+ * @returns Whether benchmark mode was requested.
+ */
+bool BenchmarkLayer::ParseCommandLine(const Violet::ApplicationCommandLineArgs& p_Args, BenchmarkSettings& p_Settings)
+{
+	bool enabled = false;
+	for (int i = 1; i < p_Args.Count; i++)
+	{
+		bool hasValue = i + 1 < p_Args.Count && strncmp(p_Args[i + 1], "--", 2) != 0;
+		if (strcmp(p_Args[i], "--benchmark") == 0)
+		{
+			enabled = true;
+			if (hasValue)
+				p_Settings.Scene = p_Args[++i];
+		}
+		else if (hasValue && strcmp(p_Args[i], "--frames") == 0)
+			p_Settings.FrameCount = std::max((uint32_t)std::strtoul(p_Args[++i], nullptr, 10), 1u);
+		else if (hasValue && strcmp(p_Args[i], "--warmup") == 0)
+			p_Settings.WarmupFrames = (uint32_t)std::strtoul(p_Args[++i], nullptr, 10);
+		else if (hasValue && strcmp(p_Args[i], "--benchmark-out") == 0)
+			p_Settings.OutputPath = p_Args[++i];
+	}
+
+	return enabled;
+}
+
+/**
+ * @brief Builds the objects of a scene. Every scene is seeded
+ * the same, so every run draws the same thing.
+ * @param p_Scene The scene.
+ */
+void BenchmarkLayer::BeginScene(Scene p_Scene)
+{
+	VT_PROFILE_FUNCTION();
+
+	m_Frame = 0;
+	m_Current = SceneResult();
+	m_Current.Name = GetSceneName(p_Scene);
+	m_Current.FrameTimes.reserve(m_Settings.FrameCount);
+
+	m_Sprites.clear();
+	uint32_t state = 0x12345678;
+
+	if (p_Scene == Scene::Overdraw)
+	{
+		// Layers covering the whole view, back to front so each passes the depth test.
+		for (uint32_t i = 0; i < s_OverdrawLayers; i++)
+		{
+			Sprite sprite = {};
+			sprite.Size = { s_WorldHalfWidth * 2.5f, s_WorldHalfHeight * 2.5f };
+			sprite.Color = { Random(state), Random(state), Random(state), 0.05f };
+			sprite.TextureIndex = i % s_TextureCount;
+			m_Sprites.push_back(sprite);
+		}
+	}
+	else
+	{
+		constexpr uint32_t columns = 400;
+		constexpr uint32_t rows = s_SpriteCount / columns;
+		glm::vec2 spacing = { s_WorldHalfWidth * 2.0f / columns, s_WorldHalfHeight * 2.0f / rows };
+
+		m_Sprites.resize(s_SpriteCount);
+		for (uint32_t i = 0; i < s_SpriteCount; i++)
+		{
+			Sprite& sprite = m_Sprites[i];
+			sprite.Position = { -s_WorldHalfWidth + (i % columns + 0.5f) * spacing.x, -s_WorldHalfHeight + (i / columns + 0.5f) * spacing.y };
+			sprite.Velocity = { Random(state) * 20.0f - 10.0f, Random(state) * 20.0f - 10.0f };
+			sprite.Size = spacing * 0.8f;
+			sprite.Rotation = Random(state) * 360.0f;
+			sprite.AngularVelocity = Random(state) * 180.0f - 90.0f;
+			sprite.Color = { Random(state), Random(state), Random(state), 1.0f };
+			// Neighbours use different textures so batches keep running out of slots.
+			sprite.TextureIndex = (i * 7) % s_TextureCount;
+		}
+	}
+
+	VT_INFO("Benchmark Scene '{0}': {1} Objects, {2} Warm-Up And {3} Measured Frames", m_Current.Name, m_Sprites.size(), m_Settings.WarmupFrames, m_Settings.FrameCount);
+	m_Current.ObjectCount = (uint32_t)m_Sprites.size();
+}
+
+/**
+ * @brief Draws a frame of the current scene.
+ * @param p_Time The scene time in seconds.
+ */
+void BenchmarkLayer::DrawScene(float p_Time)
+{
+	VT_PROFILE_FUNCTION();
+
+	Violet::Renderer2D::BeginScene(m_Camera);
+
+	switch (m_Scenes[m_SceneIndex])
+	{
+		case Scene::StaticSprites:
+		{
+			for (const Sprite& sprite : m_Sprites)
+				Violet::Renderer2D::DrawQuad(sprite.Position, sprite.Size, sprite.Color);
+			break;
+		}
+		case Scene::MovingSprites:
+		{
+			// Positions follow from the time alone, the frame rate cannot change the path.
+			for (const Sprite& sprite : m_Sprites)
+			{
+				glm::vec2 position = sprite.Position + sprite.Velocity * p_Time;
+				position = { Wrap(position.x, s_WorldHalfWidth), Wrap(position.y, s_WorldHalfHeight) };
+				Violet::Renderer2D::DrawRotatedQuad(position, sprite.Size, sprite.Rotation + sprite.AngularVelocity * p_Time, sprite.Color);
+			}
+			break;
+		}
+		case Scene::ManyTextures:
+		{
+			for (const Sprite& sprite : m_Sprites)
+				Violet::Renderer2D::DrawQuad(sprite.Position, sprite.Size, m_Textures[sprite.TextureIndex], 1.0f, sprite.Color);
+			break;
+		}
+		case Scene::Overdraw:
+		{
+			const glm::vec3& center = m_Camera.GetPosition();
+			for (uint32_t i = 0; i < (uint32_t)m_Sprites.size(); i++)
+			{
+				const Sprite& sprite = m_Sprites[i];
+				float z = -0.9f + 1.8f * i / m_Sprites.size();
+				Violet::Renderer2D::DrawQuad({ center.x, center.y, z }, sprite.Size, m_Textures[sprite.TextureIndex], 10.0f, sprite.Color);
+			}
+			break;
+		}
+	}
+
+	Violet::Renderer2D::EndScene();
+}
+
+/**
+ * @brief Moves the camera along its path, a slow pan, zoom and
+ * roll that always keeps most of the world in view.
+ * @param p_Time The scene time in seconds.
+ */
+void BenchmarkLayer::UpdateCamera(float p_Time)
+{
+	float zoom = s_WorldHalfHeight * (0.8f + 0.2f * sinf(p_Time * 0.5f));
+	m_Camera.SetProjection(-m_AspectRatio * zoom, m_AspectRatio * zoom, -zoom, zoom);
+	m_Camera.SetPosition({ sinf(p_Time * 0.3f) * 20.0f, cosf(p_Time * 0.2f) * 10.0f, 0.0f });
+	m_Camera.SetRotation(sinf(p_Time * 0.1f) * 10.0f);
+}
+
+/**
+ * @brief Sorts the frame times of the current scene and keeps
+ * its result.
+ */
+void BenchmarkLayer::EndScene()
+{
+	std::sort(m_Current.FrameTimes.begin(), m_Current.FrameTimes.end());
+
+	const std::vector<float>& times = m_Current.FrameTimes;
+	VT_INFO("  p50 {0:.3f} ms, p95 {1:.3f} ms, p99 {2:.3f} ms, max {3:.3f} ms", Percentile(times, 50.0f), Percentile(times, 95.0f), Percentile(times, 99.0f), times.empty() ? 0.0f : times.back());
+
+	m_Results.push_back(std::move(m_Current));
+	m_Current = SceneResult();
+}
+
+/**
+ * @brief Writes a CSV row per scene. Renderer2D stats are the
+ * average per measured frame.
+ * @returns Whether the file could be written.
+ */
+bool BenchmarkLayer::WriteResults() const
+{
+	std::ofstream out(m_Settings.OutputPath);
+	if (!out)
+	{
+		VT_ERROR("Could Not Open Benchmark Results File '{0}'", m_Settings.OutputPath);
+		return false;
+	}
+
+	out << "scene,objects,frames,mean_ms,p50_ms,p90_ms,p95_ms,p99_ms,max_ms,draw_calls,quads,bytes_uploaded,textures_bound\n";
+	out << std::setprecision(4) << std::fixed;
+	for (const SceneResult& result : m_Results)
+	{
+		const std::vector<float>& times = result.FrameTimes;
+		double mean = 0.0;
+		for (float time : times)
+			mean += time;
+		mean = times.empty() ? 0.0 : mean / times.size();
+
+		double frames = std::max((double)m_Settings.FrameCount, 1.0);
+		out << result.Name << ',' << result.ObjectCount << ',' << times.size() << ',' << mean << ','
+			<< Percentile(times, 50.0f) << ',' << Percentile(times, 90.0f) << ',' << Percentile(times, 95.0f) << ','
+			<< Percentile(times, 99.0f) << ',' << (times.empty() ? 0.0f : times.back()) << ','
+			<< result.DrawCalls / frames << ',' << result.QuadCount / frames << ','
+			<< result.BytesUploaded / frames << ',' << result.TexturesBound / frames << '\n';
+	}
+
+	VT_INFO("Wrote Benchmark Results To '{0}'", m_Settings.OutputPath);
+	return true;
+}
+
+/**
+ * @brief Gets the command line name of a scene.
+ * @param p_Scene The scene.
+ * @returns The name of the scene.
+ */
+const char* BenchmarkLayer::GetSceneName(Scene p_Scene)
+{
+	switch (p_Scene)
+	{
+		case Scene::StaticSprites: return "static";
+		case Scene::MovingSprites: return "moving";
+		case Scene::ManyTextures:  return "textures";
+		case Scene::Overdraw:      return "overdraw";
+	}
+
+	return "unknown";
+}
\ No newline at end of file
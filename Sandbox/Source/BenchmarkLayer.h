@@ -0,0 +1,98 @@
+/////////////////
+///
+/// BenchmarkLayer.h
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Runs scripted stress scenes for a fixed number
+/// of frames along a deterministic camera path and
+/// writes frame time percentiles and Renderer2D
+/// stats to a CSV file.
+///
+/// Usage: Sandbox --benchmark [all|static|moving|textures|overdraw]
+///     [--frames <count>] [--warmup <count>]
+///     [--benchmark-out <results.csv>]
+///
+/////////////////
+
+#ifndef __BENCHMARK_LAYER_H_INCLUDED__
+#define __BENCHMARK_LAYER_H_INCLUDED__
+
+#include <Violet.h>
+
+#include <string>
+#include <vector>
+
+struct BenchmarkSettings
+{
+	std::string Scene = "all";
+	uint32_t FrameCount = 1000;
+	uint32_t WarmupFrames = 60;
+	std::string OutputPath = "SandboxBenchmark.csv";
+};
+
+class BenchmarkLayer : public Violet::Layer
+{
+public:
+	BenchmarkLayer(const BenchmarkSettings& p_Settings);
+	virtual ~BenchmarkLayer() = default;
+
+	virtual void OnAttach() override;
+	virtual void OnDetach() override;
+
+	void OnUpdate(Violet::Timestep p_Timestep) override;
+	void OnEvent(Violet::Event& p_Event) override;
+
+	static bool ParseCommandLine(const Violet::ApplicationCommandLineArgs& p_Args, BenchmarkSettings& p_Settings);
+private:
+	enum class Scene { StaticSprites, MovingSprites, ManyTextures, Overdraw };
+
+	struct Sprite
+	{
+		glm::vec2 Position;
+		glm::vec2 Velocity;
+		glm::vec2 Size;
+		float Rotation;
+		float AngularVelocity;
+		glm::vec4 Color;
+		uint32_t TextureIndex;
+	};
+
+	struct SceneResult
+	{
+		const char* Name;
+		uint32_t ObjectCount;
+		std::vector<float> FrameTimes; // Milliseconds.
+		uint64_t DrawCalls = 0;
+		uint64_t QuadCount = 0;
+		uint64_t BytesUploaded = 0;
+		uint64_t TexturesBound = 0;
+	};
+private:
+	bool OnWindowResized(Violet::WindowResizeEvent& p_Event);
+
+	void BeginScene(Scene p_Scene);
+	void DrawScene(float p_Time);
+	void UpdateCamera(float p_Time);
+	void EndScene();
+	bool WriteResults() const;
+
+	static const char* GetSceneName(Scene p_Scene);
+private:
+	BenchmarkSettings m_Settings;
+	std::vector<Scene> m_Scenes;
+	uint32_t m_SceneIndex = 0;
+	uint32_t m_Frame = 0;
+	uint64_t m_LastFrameTime = 0;
+
+	Violet::OrthographicCamera m_Camera;
+	float m_AspectRatio = 1280.0f / 720.0f;
+
+	std::vector<Sprite> m_Sprites;
+	std::vector<Violet::Ref<Violet::Texture2D>> m_Textures;
+
+	SceneResult m_Current;
+	std::vector<SceneResult> m_Results;
+};
+
+#endif // __BENCHMARK_LAYER_H_INCLUDED__
\ No newline at end of file
@@ -3,6 +3,7 @@
 /// ExampleLayer.cpp
 /// Violet McAllister
 /// July 15th, 2022
+/// Updated: July 24th, 2022
 ///
 /// Testing Violet API Code
 ///
@@ -18,6 +19,8 @@
 ExampleLayer::ExampleLayer()
 	: Layer("ExampleLayer"), m_CameraController(1280.0f / 720.0f)
 {
+	SetEventCategories(Violet::EventCategoryApplication | Violet::EventCategoryMouse);
+
 	m_VertexArray = Violet::VertexArray::Create();
 
 	float vertices[3 * 7] = {
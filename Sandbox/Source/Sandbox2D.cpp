@@ -3,7 +3,7 @@
 /// Sandbox2D.cpp
 /// Violet McAllister
 /// July 14th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Testing Violet API Code
 ///
@@ -21,13 +21,32 @@
 Sandbox2D::Sandbox2D()
 	: Layer("Sandbox2D"), m_CameraController(1280.0f / 720.0f), m_SquareColor({ 0.2f, 0.3f, 0.8f, 1.0f })
 {
+	// The camera controller only listens for scrolling and resizing.
+	SetEventCategories(Violet::EventCategoryApplication | Violet::EventCategoryMouse);
+}
+
+void Sandbox2D::OnStartup(Violet::StartupSequence& p_Sequence)
+{
+	// Decode on a worker while the window opens, upload once the renderer is up.
+	Violet::StartupStageID decode = p_Sequence.Add("Checkerboard Decode", Violet::StartupThread::Worker, [this]()
+	{
+		m_CheckerboardImage = Violet::ImageData::Load("Assets/Textures/Checkerboard.png");
+	});
+
+	p_Sequence.Add("Checkerboard Upload", Violet::StartupThread::Main, [this]()
+	{
+		m_CheckerboardTexture = Violet::Texture2D::Create(m_CheckerboardImage);
+		m_CheckerboardImage = Violet::ImageData();
+	}, { decode, p_Sequence.Find("Renderer API") });
 }
 
 void Sandbox2D::OnAttach()
 {
 	VT_PROFILE_FUNCTION();
 
-	m_CheckerboardTexture = Violet::Texture2D::Create("Assets/Textures/Checkerboard.png");
+	Violet::FixedTimestepSettings fixedTimestep;
+	fixedTimestep.Enabled = true;
+	Violet::Application::Get().SetFixedTimestep(fixedTimestep);
 }
 
 void Sandbox2D::OnDetach()
@@ -49,12 +68,9 @@ void Sandbox2D::OnUpdate(Violet::Timestep p_Timestep)
 		Violet::RenderCommand::Clear();
 	}
 
-	static float rotation = 0.0f;
-
 	Violet::Renderer2D::ResetStats();
 	{
-		static float rotation = 0.0f;
-		rotation += p_Timestep * 50.0f;
+		float rotation = glm::mix(m_PreviousRotation, m_Rotation, p_Timestep.GetInterpolationAlpha());
 
 		VT_PROFILE_SCOPE("Renderer Draw");
 
@@ -81,6 +97,12 @@ void Sandbox2D::OnUpdate(Violet::Timestep p_Timestep)
 	}
 }
 
+void Sandbox2D::OnFixedUpdate(Violet::Timestep p_FixedTimestep)
+{
+	m_PreviousRotation = m_Rotation;
+	m_Rotation += p_FixedTimestep * 50.0f;
+}
+
 void Sandbox2D::OnImGuiRender()
 {
 	VT_PROFILE_FUNCTION();
@@ -144,6 +166,34 @@ void Sandbox2D::OnImGuiRender()
 				if (ImGui::MenuItem("Exit")) Violet::Application::Get().Close();
 				ImGui::EndMenu();
 			}
+
+			if (ImGui::BeginMenu("View"))
+			{
+				Violet::ProfilerPanel& profilerPanel = Violet::Application::Get().GetImGuiLayer()->GetProfilerPanel();
+				if (ImGui::MenuItem("Profiler", nullptr, profilerPanel.IsOpen()))
+					profilerPanel.SetOpen(!profilerPanel.IsOpen());
+				ImGui::EndMenu();
+			}
+
+			if (ImGui::BeginMenu("Input"))
+			{
+				Violet::Application& app = Violet::Application::Get();
+				if (ImGui::MenuItem("Record", nullptr, app.IsRecordingInput(), !app.IsPlayingInput()))
+				{
+					if (app.IsRecordingInput())
+						app.StopInputRecording();
+					else
+						app.StartInputRecording("Sandbox2D.vtir");
+				}
+				if (ImGui::MenuItem("Replay", nullptr, app.IsPlayingInput(), !app.IsRecordingInput()))
+				{
+					if (app.IsPlayingInput())
+						app.StopInputPlayback();
+					else
+						app.StartInputPlayback("Sandbox2D.vtir");
+				}
+				ImGui::EndMenu();
+			}
 			ImGui::EndMenuBar();
 		}
 
@@ -151,10 +201,12 @@ void Sandbox2D::OnImGuiRender()
 
 		auto stats = Violet::Renderer2D::GetStats();
 		ImGui::Text("Renderer2D Stats:");
-		ImGui::Text("Draw Calls: %d", stats.DrawCalls);
-		ImGui::Text("Quads: %d", stats.QuadCount);
-		ImGui::Text("Vertices: %d", stats.GetTotalVertexCount());
-		ImGui::Text("Indices: %d", stats.GetTotalIndexCount());
+		ImGui::Text("Draw Calls: %u", stats.DrawCalls);
+		ImGui::Text("Quads: %u", stats.QuadCount);
+		ImGui::Text("Vertices: %u", stats.GetTotalVertexCount());
+		ImGui::Text("Indices: %u", stats.GetTotalIndexCount());
+		ImGui::Text("Bytes Uploaded: %u", stats.BytesUploaded);
+		ImGui::Text("Textures Bound: %u", stats.TexturesBound);
 		ImGui::ColorEdit4("Square Color", glm::value_ptr(m_SquareColor));
 
 		uint32_t textureID = m_CheckerboardTexture->GetRendererID();
@@ -169,10 +221,12 @@ void Sandbox2D::OnImGuiRender()
 
 		auto stats = Violet::Renderer2D::GetStats();
 		ImGui::Text("Renderer2D Stats:");
-		ImGui::Text("Draw Calls: %d", stats.DrawCalls);
-		ImGui::Text("Quads: %d", stats.QuadCount);
-		ImGui::Text("Vertices: %d", stats.GetTotalVertexCount());
-		ImGui::Text("Indices: %d", stats.GetTotalIndexCount());
+		ImGui::Text("Draw Calls: %u", stats.DrawCalls);
+		ImGui::Text("Quads: %u", stats.QuadCount);
+		ImGui::Text("Vertices: %u", stats.GetTotalVertexCount());
+		ImGui::Text("Indices: %u", stats.GetTotalIndexCount());
+		ImGui::Text("Bytes Uploaded: %u", stats.BytesUploaded);
+		ImGui::Text("Textures Bound: %u", stats.TexturesBound);
 
 		ImGui::ColorEdit4("Square Color", glm::value_ptr(m_SquareColor));
 
@@ -3,7 +3,7 @@
 /// Sandbox2D.h
 /// Violet McAllister
 /// July 14th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Testing Violet API Code
 ///
@@ -20,10 +20,12 @@ public:
 	Sandbox2D();
 	virtual ~Sandbox2D() = default;
 
+	virtual void OnStartup(Violet::StartupSequence& p_Sequence) override;
 	virtual void OnAttach() override;
 	virtual void OnDetach() override;
 
 	void OnUpdate(Violet::Timestep p_Timestep) override;
+	void OnFixedUpdate(Violet::Timestep p_FixedTimestep) override;
 	virtual void OnImGuiRender() override;
 	void OnEvent(Violet::Event& p_Event) override;
 private:
@@ -33,8 +35,13 @@ private:
 	Violet::Ref<Violet::Shader> m_FlatColorShader;
 
 	Violet::Ref<Violet::Texture2D> m_CheckerboardTexture;
+	Violet::ImageData m_CheckerboardImage;
 	
 	glm::vec4 m_SquareColor;
+
+	// Simulated at the fixed rate, drawn blended between the last two ticks.
+	float m_Rotation = 0.0f;
+	float m_PreviousRotation = 0.0f;
 };
 
 #endif // __SANDBOX_2D_H_INCLUDED__
\ No newline at end of file
@@ -3,7 +3,7 @@
 /// SandboxApp.cpp
 /// Violet McAllister
 /// June 30th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Testing Violet API Code
 ///
@@ -12,14 +12,51 @@
 #include <Violet.h>
 #include <Violet/Core/EntryPoint.h>
 
+#include "BenchmarkLayer.h"
 #include "ExampleLayer.h"
 #include "Sandbox2D.h"
 
+/**
+ * @brief Picks the renderer from "--renderer <opengl|null|software>"
+ * on the command line, OpenGL is kept when it is missing or unknown.
+ * @param p_Args The command line.
+ */
+static void SelectRenderer(const Violet::ApplicationCommandLineArgs& p_Args)
+{
+	for (int i = 1; i + 1 < p_Args.Count; i++)
+	{
+		if (strcmp(p_Args[i], "--renderer") != 0)
+			continue;
+
+		const char* name = p_Args[i + 1];
+		if (strcmp(name, "opengl") == 0)
+			Violet::RendererAPI::SetAPI(Violet::RendererAPI::API::OpenGL);
+		else if (strcmp(name, "null") == 0)
+			Violet::RendererAPI::SetAPI(Violet::RendererAPI::API::Null);
+		else if (strcmp(name, "software") == 0)
+			Violet::RendererAPI::SetAPI(Violet::RendererAPI::API::Software);
+		else
+			VT_WARN("Unknown Renderer '{0}', Using OpenGL!", name);
+		return;
+	}
+}
+
 class SandboxApp : public Violet::Application
 {
 public:
-	SandboxApp()
+	SandboxApp(Violet::ApplicationCommandLineArgs p_Args)
+		: Application(p_Args)
 	{
+		// The renderer starts with the application in Run, so it can still be picked here.
+		SelectRenderer(p_Args);
+
+		BenchmarkSettings benchmark;
+		if (BenchmarkLayer::ParseCommandLine(p_Args, benchmark))
+		{
+			PushLayer(new BenchmarkLayer(benchmark));
+			return;
+		}
+
 		PushLayer(new Sandbox2D());
 		//PushLayer(new ExampleLayer());
 	}
@@ -30,7 +67,7 @@ public:
 	}
 };
 
-Violet::Application* Violet::CreateApplication()
+Violet::Application* Violet::CreateApplication(Violet::ApplicationCommandLineArgs p_Args)
 {
-	return new SandboxApp();
+	return new SandboxApp(p_Args);
 }
\ No newline at end of file
@@ -0,0 +1,3 @@
+#!/bin/sh
+# Linux builds are headless, see HeadlessWindow.
+premake5 gmake2 || exit 1
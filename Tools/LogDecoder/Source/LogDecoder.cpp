@@ -0,0 +1,316 @@
+/////////////////
+///
+/// LogDecoder.cpp
+/// Violet McAllister
+/// August 1st, 2022
+/// Updated: August 6th, 2022
+///
+/// Renders a fast log dump written by
+/// FastLog::Dump or its crash handler as text,
+/// every thread merged in time order. Dumps are
+/// in the byte order of the machine that wrote
+/// them, decode them on the same endianness.
+///
+/// Usage: LogDecoder <dump.vtfl> [output.txt]
+///
+/////////////////
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <spdlog/fmt/fmt.h>
+
+#include <Violet/Debug/FastLog.h>
+
+/**
+ * @brief A call site read from the dump.
+ */
+struct Site
+{
+	uint32_t Line = 0;
+	std::string Format;
+	std::string File;
+};
+
+/**
+ * @brief A record read from the dump.
+ */
+struct Record
+{
+	double Time;
+	uint32_t Thread;
+	uint64_t Site;
+	uint8_t Arguments[Violet::FastLogFormat::ArgumentSize];
+};
+
+/**
+ * @brief A decoded argument.
+ */
+struct Argument
+{
+	Violet::FastLogFormat::Tag Tag;
+	uint64_t Bits = 0;
+	std::string Text;
+};
+
+/**
+ * @brief Reads a value from a stream.
+ * @param p_Input The stream.
+ * @param p_Value The value read.
+ * @returns If the value could be read.
+ */
+template<typename T>
+static bool ReadValue(std::ifstream& p_Input, T& p_Value)
+{
+	return (bool)p_Input.read(reinterpret_cast<char*>(&p_Value), sizeof(T));
+}
+
+/**
+ * @brief Reads a string written as its length followed by
+ * the characters.
+ * @param p_Input The stream.
+ * @param p_Value The string read.
+ * @returns If the string could be read.
+ */
+static bool ReadString(std::ifstream& p_Input, std::string& p_Value)
+{
+	uint16_t size;
+	if (!ReadValue(p_Input, size))
+		return false;
+
+	p_Value.resize(size);
+	return size == 0 || (bool)p_Input.read(&p_Value[0], size);
+}
+
+/**
+ * @brief Splits the argument bytes of a record.
+ * @param p_Record The record.
+ * @returns The arguments.
+ */
+static std::vector<Argument> DecodeArguments(const Record& p_Record)
+{
+	using Format = Violet::FastLogFormat;
+
+	std::vector<Argument> arguments;
+	const uint8_t* cursor = p_Record.Arguments;
+	const uint8_t* end = p_Record.Arguments + Format::ArgumentSize;
+	while (cursor < end && *cursor != Format::End)
+	{
+		Argument argument;
+		argument.Tag = (Format::Tag)*cursor;
+		if (argument.Tag == Format::String)
+		{
+			if (end - cursor < 2 || end - cursor - 2 < cursor[1])
+				break;
+			argument.Text.assign(reinterpret_cast<const char*>(cursor + 2), cursor[1]);
+			cursor += 2 + cursor[1];
+		}
+		else
+		{
+			if (end - cursor < 9 || argument.Tag > Format::Pointer)
+				break;
+			memcpy(&argument.Bits, cursor + 1, 8);
+			cursor += 9;
+		}
+
+		arguments.push_back(argument);
+	}
+
+	return arguments;
+}
+
+/**
+ * @brief Formats an argument with a format spec.
+ * @param p_Argument The argument.
+ * @param p_Spec The spec, without the colon.
+ * @returns The formatted argument.
+ */
+static std::string FormatArgument(const Argument& p_Argument, const std::string& p_Spec)
+{
+	using Format = Violet::FastLogFormat;
+
+	std::string pattern = p_Spec.empty() ? "{}" : "{:" + p_Spec + "}";
+	try
+	{
+		switch (p_Argument.Tag)
+		{
+			case Format::Int:
+			{
+				int64_t value = (int64_t)p_Argument.Bits;
+				return fmt::vformat(pattern, fmt::make_format_args(value));
+			}
+			case Format::UInt:
+			{
+				uint64_t value = p_Argument.Bits;
+				return fmt::vformat(pattern, fmt::make_format_args(value));
+			}
+			case Format::Double:
+			{
+				double value;
+				memcpy(&value, &p_Argument.Bits, sizeof(double));
+				return fmt::vformat(pattern, fmt::make_format_args(value));
+			}
+			case Format::Bool:
+			{
+				bool value = p_Argument.Bits != 0;
+				return fmt::vformat(pattern, fmt::make_format_args(value));
+			}
+			case Format::Char:
+			{
+				char value = (char)p_Argument.Bits;
+				return fmt::vformat(pattern, fmt::make_format_args(value));
+			}
+			case Format::String:
+				return fmt::vformat(pattern, fmt::make_format_args(p_Argument.Text));
+			case Format::Pointer:
+				return fmt::format("0x{:016x}", p_Argument.Bits);
+			case Format::End:
+			default:
+				return "{...}";
+		}
+	}
+	catch (const fmt::format_error&)
+	{
+	}
+
+	return "{?}";
+}
+
+/**
+ * @brief Renders a format string the way fmt would, with
+ * arguments that did not fit the record shown as {...}.
+ * @param p_Format The format string.
+ * @param p_Arguments The arguments.
+ * @returns The message.
+ */
+static std::string Render(const std::string& p_Format, const std::vector<Argument>& p_Arguments)
+{
+	std::string result;
+	size_t nextIndex = 0;
+	for (size_t i = 0; i < p_Format.size(); i++)
+	{
+		char c = p_Format[i];
+		if ((c == '{' || c == '}') && i + 1 < p_Format.size() && p_Format[i + 1] == c)
+		{
+			result += c;
+			i++;
+			continue;
+		}
+
+		size_t close = p_Format.find('}', i);
+		if (c != '{' || close == std::string::npos)
+		{
+			result += c;
+			continue;
+		}
+
+		std::string field = p_Format.substr(i + 1, close - i - 1);
+		size_t colon = field.find(':');
+		std::string index = field.substr(0, colon);
+		std::string spec = colon == std::string::npos ? "" : field.substr(colon + 1);
+
+		size_t argumentIndex = index.empty() ? nextIndex++ : (size_t)strtoul(index.c_str(), nullptr, 10);
+		result += argumentIndex < p_Arguments.size() ? FormatArgument(p_Arguments[argumentIndex], spec) : "{...}";
+		i = close;
+	}
+
+	return result;
+}
+
+int main(int argc, char** argv)
+{
+	using Format = Violet::FastLogFormat;
+
+	if (argc < 2)
+	{
+		std::cerr << "Usage: LogDecoder <dump.vtfl> [output.txt]\n";
+		return 1;
+	}
+
+	std::ifstream input(argv[1], std::ios::binary);
+	if (!input.is_open())
+	{
+		std::cerr << "Could Not Open '" << argv[1] << "'.\n";
+		return 1;
+	}
+
+	char magic[4];
+	uint32_t version, siteCount, threadCount;
+	if (!input.read(magic, sizeof(magic)) || memcmp(magic, Format::Magic, sizeof(magic)) != 0
+		|| !ReadValue(input, version) || version != Format::Version
+		|| !ReadValue(input, siteCount) || !ReadValue(input, threadCount))
+	{
+		std::cerr << "'" << argv[1] << "' Is Not A Fast Log Dump Of Version " << Format::Version << ".\n";
+		return 1;
+	}
+
+	std::unordered_map<uint64_t, Site> sites;
+	for (uint32_t i = 0; i < siteCount; i++)
+	{
+		uint64_t id;
+		Site site;
+		if (!ReadValue(input, id) || !ReadValue(input, site.Line) || !ReadString(input, site.Format) || !ReadString(input, site.File))
+		{
+			std::cerr << "Dump Is Truncated In The Site Table.\n";
+			return 1;
+		}
+
+		// Only the file name, the full build path is noise.
+		size_t slash = site.File.find_last_of("/\\");
+		if (slash != std::string::npos)
+			site.File = site.File.substr(slash + 1);
+		sites[id] = std::move(site);
+	}
+
+	std::vector<Record> records;
+	for (uint32_t i = 0; i < threadCount; i++)
+	{
+		uint32_t index, recordCount;
+		if (!ReadValue(input, index) || !ReadValue(input, recordCount))
+			break;
+
+		for (uint32_t j = 0; j < recordCount; j++)
+		{
+			Record record;
+			record.Thread = index;
+			if (!ReadValue(input, record.Time) || !ReadValue(input, record.Site) || !input.read(reinterpret_cast<char*>(record.Arguments), sizeof(record.Arguments)))
+				break;
+			records.push_back(record);
+		}
+	}
+
+	std::stable_sort(records.begin(), records.end(), [](const Record& p_A, const Record& p_B) { return p_A.Time < p_B.Time; });
+
+	std::ofstream file;
+	if (argc >= 3)
+	{
+		file.open(argv[2]);
+		if (!file.is_open())
+		{
+			std::cerr << "Could Not Open '" << argv[2] << "'.\n";
+			return 1;
+		}
+	}
+	std::ostream& output = argc >= 3 ? file : std::cout;
+
+	double start = records.empty() ? 0.0 : records.front().Time;
+	for (const Record& record : records)
+	{
+		auto it = sites.find(record.Site);
+		if (it == sites.end())
+			continue;
+
+		const Site& site = it->second;
+		output << fmt::format("[{:12.3f} us] [Thread {}] {}:{}: ", record.Time - start, record.Thread, site.File, site.Line);
+		output << Render(site.Format, DecodeArguments(record)) << '\n';
+	}
+
+	std::cerr << "Decoded " << records.size() << " Records From " << threadCount << " Threads.\n";
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+/////////////////
+///
+/// HeadlessWindow.cpp
+/// Violet McAllister
+/// August 3rd, 2022
+///
+/// The Linux window. Violet runs on Linux for
+/// render farms and perf CI, which have neither
+/// a display server nor a GPU, so the window is
+/// an offscreen surface of a fixed size.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/Linux/HeadlessWindow.h"
+
+#include <csignal>
+
+#include "Violet/Events/ApplicationEvent.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Set from the signal handler, polled every update.
+	 */
+	static volatile std::sig_atomic_t s_CloseRequested = 0;
+
+	/**
+	 * @brief Asks the window to close on SIGINT and SIGTERM.
+	 * @param p_Signal The signal.
+	 */
+	static void OnCloseSignal(int p_Signal)
+	{
+		s_CloseRequested = 1;
+	}
+
+	/**
+	 * @brief Constructs a HeadlessWindow object and its offscreen
+	 * graphics context.
+	 * @param p_Properties The window properties (title, width, height).
+	 */
+	HeadlessWindow::HeadlessWindow(const WindowProperties& p_Properties)
+	{
+		VT_PROFILE_FUNCTION();
+
+		m_Data.Title = p_Properties.Title;
+		m_Data.Width = p_Properties.Width;
+		m_Data.Height = p_Properties.Height;
+
+		VT_CORE_INFO("Creating Headless Window {0} ({1}, {2})", m_Data.Title, m_Data.Width, m_Data.Height);
+
+		m_Context = GraphicsContext::CreateHeadless(m_Data.Width, m_Data.Height);
+		m_Context->Init();
+		SetVSync(true);
+
+		std::signal(SIGINT, OnCloseSignal);
+		std::signal(SIGTERM, OnCloseSignal);
+	}
+
+	/**
+	 * @brief Deconstructs a HeadlessWindow object.
+	 */
+	HeadlessWindow::~HeadlessWindow()
+	{
+		VT_PROFILE_FUNCTION();
+
+		std::signal(SIGINT, SIG_DFL);
+		std::signal(SIGTERM, SIG_DFL);
+	}
+
+	/**
+	 * @brief Finishes the frame and turns a pending close signal
+	 * into a window close event.
+	 */
+	void HeadlessWindow::OnUpdate()
+	{
+		VT_PROFILE_FUNCTION();
+
+		if (s_CloseRequested)
+		{
+			s_CloseRequested = 0;
+			if (m_Data.Queue)
+			{
+				m_Data.Queue->Push<WindowCloseEvent>();
+			}
+			else
+			{
+				WindowCloseEvent event;
+				m_Data.EventCallback(event);
+			}
+		}
+
+		m_Context->SwapBuffers();
+	}
+
+	/**
+	 * @brief Sets whether vsync is enabled. Nothing is presented,
+	 * so frames are never throttled either way.
+	 * @param p_Enabled Whether vsync is enabled.
+	 */
+	void HeadlessWindow::SetVSync(bool p_Enabled)
+	{
+		m_Data.VSync = p_Enabled;
+	}
+
+	/**
+	 * @brief Checks if vsync is enabled.
+	 * @returns If vsync is enabled.
+	 */
+	bool HeadlessWindow::IsVSync() const
+	{
+		return m_Data.VSync;
+	}
+}
\ No newline at end of file
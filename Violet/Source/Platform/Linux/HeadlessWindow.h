@@ -0,0 +1,85 @@
+/////////////////
+///
+/// HeadlessWindow.h
+/// Violet McAllister
+/// August 3rd, 2022
+///
+/// The Linux window. Violet runs on Linux for
+/// render farms and perf CI, which have neither
+/// a display server nor a GPU, so the window is
+/// an offscreen surface of a fixed size.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_LINUX_HEADLESS_WINDOW_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_LINUX_HEADLESS_WINDOW_H_INCLUDED__
+
+#include "Violet/Core/Window.h"
+#include "Violet/Renderer/GraphicsContext.h"
+
+namespace Violet
+{
+	/**
+	 * @brief A window without a display. It never receives input,
+	 * and SIGINT or SIGTERM close it like the close button would.
+	 */
+	class HeadlessWindow : public Window
+	{
+	public: // Constructors & Deconstructors
+		HeadlessWindow(const WindowProperties& p_Properties);
+		virtual ~HeadlessWindow();
+	public: // Override Implementations
+		/**
+		 * @brief Gets the width of the offscreen surface.
+		 * @returns The width of the offscreen surface.
+		 */
+		unsigned int GetWidth() const override { return m_Data.Width; }
+
+		/**
+		 * @brief Gets the height of the offscreen surface.
+		 * @returns The height of the offscreen surface.
+		 */
+		unsigned int GetHeight() const override { return m_Data.Height; }
+
+		/**
+		 * @brief Sets a given event callback for the window.
+		 * @param p_Callback The callback for the event.
+		 */
+		void SetEventCallback(const EventCallbackFunction& p_Callback) override { m_Data.EventCallback = p_Callback; }
+
+		/**
+		 * @brief Sets the queue events are buffered into. Without a
+		 * queue, events go straight to the event callback.
+		 * @param p_Queue The event queue.
+		 */
+		void SetEventQueue(EventQueue* p_Queue) override { m_Data.Queue = p_Queue; }
+
+		/**
+		 * @brief There is no native window.
+		 * @returns nullptr.
+		 */
+		virtual void* GetNativeWindow() const override { return nullptr; }
+	public: // Override Definitions
+		void OnUpdate() override;
+		void SetVSync(bool p_Enabled) override;
+		bool IsVSync() const override;
+	private: // WindowData
+		/**
+		 * @brief The data needed to use a Headless Window.
+		 */
+		struct WindowData
+		{
+		public: // Public Member Variables
+			std::string Title;
+			unsigned int Width, Height;
+			bool VSync;
+			EventCallbackFunction EventCallback;
+			EventQueue* Queue = nullptr;
+		};
+	private: // Private Member Variables
+		Scope<GraphicsContext> m_Context;
+		WindowData m_Data;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_LINUX_HEADLESS_WINDOW_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,36 @@
+/////////////////
+///
+/// LinuxInput.h
+/// Violet McAllister
+/// August 3rd, 2022
+///
+/// Linux implementation of Input. The headless
+/// window has no devices, so nothing is ever
+/// held; recorded input still plays back
+/// through events.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_LINUX_INPUT_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_LINUX_INPUT_H_INCLUDED__
+
+#include "Violet/Core/Input.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Linux Implementation of the Input class.
+	 */
+	class LinuxInput : public Input
+	{
+	protected: // Key Event Implementations
+		virtual bool IsKeyPressedImpl(KeyCode p_KeyCode) override { return false; }
+	protected: // Mouse Event Implementations
+		virtual bool IsMouseButtonPressedImpl(MouseCode p_Button) override { return false; }
+		virtual std::pair<float, float> GetMousePositionImpl() override { return { 0.0f, 0.0f }; }
+		virtual float GetMouseXImpl() override { return 0.0f; }
+		virtual float GetMouseYImpl() override { return 0.0f; }
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_LINUX_INPUT_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,75 @@
+/////////////////
+///
+/// NullBuffer.cpp
+/// Violet McAllister
+/// August 4th, 2022
+///
+/// Null implementations of Vertex & Index Buffer
+/// objects, keeping their data in CPU memory.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/Null/NullBuffer.h"
+
+#include "Platform/Null/NullCommandLog.h"
+
+namespace Violet
+{
+	/////////////////////////////
+	// VertexBuffer /////////////
+	/////////////////////////////
+
+	/**
+	 * @brief Constructs a NullVertexBuffer object using only
+	 * the size of the buffer.
+	 * @param p_Size The size of the buffer.
+	 */
+	NullVertexBuffer::NullVertexBuffer(uint32_t p_Size)
+		: m_RendererID(NullCommandLog::Get().NextRendererID()), m_Data(p_Size)
+	{
+	}
+
+	/**
+	 * @brief Constructs a NullVertexBuffer object.
+	 * @param p_Vertices The vertices for the buffer.
+	 * @param p_Size The size of the buffer.
+	 */
+	NullVertexBuffer::NullVertexBuffer(float* p_Vertices, uint32_t p_Size)
+		: m_RendererID(NullCommandLog::Get().NextRendererID()), m_DataSize(p_Size),
+		m_Data((const uint8_t*)p_Vertices, (const uint8_t*)p_Vertices + p_Size)
+	{
+	}
+
+	/**
+	 * @brief Copies data into the start of the buffer.
+	 * @param p_Data The data.
+	 * @param p_Size The size of the data.
+	 */
+	void NullVertexBuffer::SetData(const void* p_Data, uint32_t p_Size)
+	{
+		VT_CORE_ASSERT(p_Size <= m_Data.size(), "Data Does Not Fit In The Vertex Buffer!");
+
+		memcpy(m_Data.data(), p_Data, p_Size);
+		m_DataSize = p_Size;
+
+		NullCommand command = { NullCommandType::UploadVertexData, m_RendererID };
+		command.Count = p_Size;
+		NullCommandLog::Get().Record(std::move(command));
+	}
+
+	/////////////////////////////
+	// IndexBuffer //////////////
+	/////////////////////////////
+
+	/**
+	 * @brief Constructs a NullIndexBuffer object.
+	 * @param p_Indices The indices for the buffer.
+	 * @param p_Count The amount of indices.
+	 */
+	NullIndexBuffer::NullIndexBuffer(uint32_t* p_Indices, uint32_t p_Count)
+		: m_RendererID(NullCommandLog::Get().NextRendererID()), m_Indices(p_Indices, p_Indices + p_Count)
+	{
+	}
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+/////////////////
+///
+/// NullBuffer.h
+/// Violet McAllister
+/// August 4th, 2022
+///
+/// Null implementations of Vertex & Index Buffer
+/// objects, keeping their data in CPU memory.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_NULL_BUFFER_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_NULL_BUFFER_H_INCLUDED__
+
+#include <vector>
+
+#include "Violet/Renderer/Buffer.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Null Implementation of a Vertex Buffer.
+	 */
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public: // Constructors & Deconstructors
+		NullVertexBuffer(uint32_t p_Size);
+		NullVertexBuffer(float* p_Vertices, uint32_t p_Size);
+	public: // Main Functionality
+		virtual void Bind() const override { }
+		virtual void Unbind() const override { }
+		virtual void SetData(const void* p_Data, uint32_t p_Size) override;
+	public: // Buffer Layout
+		/**
+		 * @brief Gets the buffer layout.
+		 * @returns The buffer layout.
+		 */
+		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+
+		/**
+		 * @brief Sets the buffer layout.
+		 * @returns The buffer layout.
+		 */
+		virtual void SetLayout(const BufferLayout& p_Layout) override { m_Layout = p_Layout; }
+	public: // Getters
+		uint32_t GetRendererID() const { return m_RendererID; }
+		const uint8_t* GetData() const { return m_Data.data(); }
+
+		/**
+		 * @brief Gets how many bytes the last SetData wrote.
+		 * @returns The size of the last upload.
+		 */
+		uint32_t GetDataSize() const { return m_DataSize; }
+	private: // Private Member Variables
+		uint32_t m_RendererID;
+		uint32_t m_DataSize = 0;
+		std::vector<uint8_t> m_Data;
+		BufferLayout m_Layout;
+	};
+
+	/**
+	 * @brief Null Implementation of an Index Buffer.
+	 */
+	class NullIndexBuffer : public IndexBuffer
+	{
+	public: // Constructors & Deconstructors
+		NullIndexBuffer(uint32_t* p_Indices, uint32_t p_Count);
+	public: // Main Functionality
+		virtual void Bind() const override { }
+		virtual void Unbind() const override { }
+	public: // Getters
+		/**
+		 * @brief Gets the index count.
+		 * @returns The index count.
+		 */
+		virtual uint32_t GetCount() const override { return (uint32_t)m_Indices.size(); }
+
+		uint32_t GetRendererID() const { return m_RendererID; }
+		const uint32_t* GetIndices() const { return m_Indices.data(); }
+	private: // Private Member Variables
+		uint32_t m_RendererID;
+		std::vector<uint32_t> m_Indices;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_NULL_BUFFER_H_INCLUDED__
\ No newline at end of file
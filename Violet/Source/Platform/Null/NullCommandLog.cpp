@@ -0,0 +1,76 @@
+/////////////////
+///
+/// NullCommandLog.cpp
+/// Violet McAllister
+/// August 4th, 2022
+///
+/// The log the Null renderer records into. Every
+/// draw and state change of the Null resources
+/// ends up here, so tests and benchmarks can see
+/// what the renderer submitted without a GPU.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/Null/NullCommandLog.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Counts a command and keeps it while recording.
+	 * @param p_Command The command.
+	 */
+	void NullCommandLog::Record(NullCommand&& p_Command)
+	{
+		switch (p_Command.Type)
+		{
+			case NullCommandType::DrawIndexed:
+				m_Counters.DrawCalls++;
+				m_Counters.IndicesDrawn += p_Command.Count;
+				break;
+			case NullCommandType::UploadVertexData:
+			case NullCommandType::UploadTextureData:
+				m_Counters.BytesUploaded += p_Command.Count;
+				break;
+			default:
+				m_Counters.StateChanges++;
+				break;
+		}
+
+		if (m_Recording)
+			m_Commands.push_back(std::move(p_Command));
+	}
+
+	/**
+	 * @brief Drops the recorded commands and resets the counters.
+	 */
+	void NullCommandLog::Clear()
+	{
+		m_Commands.clear();
+		m_Counters = Counters();
+	}
+
+	/**
+	 * @brief Counts the recorded commands of a type.
+	 * @param p_Type The command type.
+	 * @returns The number of recorded commands of that type.
+	 */
+	uint32_t NullCommandLog::Count(NullCommandType p_Type) const
+	{
+		uint32_t count = 0;
+		for (const NullCommand& command : m_Commands)
+			count += command.Type == p_Type;
+		return count;
+	}
+
+	/**
+	 * @brief Gets the log all Null resources record into.
+	 * @returns The command log.
+	 */
+	NullCommandLog& NullCommandLog::Get()
+	{
+		static NullCommandLog s_Log;
+		return s_Log;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+/////////////////
+///
+/// NullCommandLog.h
+/// Violet McAllister
+/// August 4th, 2022
+/// Updated: August 6th, 2022
+///
+/// The log the Null renderer records into. Every
+/// draw and state change of the Null resources
+/// ends up here, so tests and benchmarks can see
+/// what the renderer submitted without a GPU.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_NULL_COMMAND_LOG_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_NULL_COMMAND_LOG_H_INCLUDED__
+
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Violet/Core/Base.h"
+
+namespace Violet
+{
+	/**
+	 * @brief The kinds of commands the Null renderer records.
+	 */
+	enum class NullCommandType
+	{
+		SetViewport, SetClearColor, Clear, DrawIndexed,
+		BindVertexArray, BindTexture, BindShader,
+		UploadVertexData, UploadTextureData,
+		SetUniform
+	};
+
+	/**
+	 * @brief A recorded command. Fields a command does not use
+	 * are left zero.
+	 */
+	struct NullCommand
+	{
+		NullCommandType Type;
+		uint32_t RendererID = 0; // The resource the command acts on.
+		uint32_t Slot = 0;       // Texture slot.
+		uint32_t Count = 0;      // Index count, bytes uploaded or uniform array length.
+		glm::vec4 Value = glm::vec4(0.0f); // Viewport, clear color or uniform value.
+		std::string Name;        // Uniform name.
+	};
+
+	/**
+	 * @brief Records the commands of the Null renderer. The
+	 * counters are always kept, the commands only while
+	 * recording. Recording is off until a test turns it on, so
+	 * long runs do not grow the log.
+	 */
+	class NullCommandLog
+	{
+	public: // Counters
+		/**
+		 * @brief Totals since the log was last cleared.
+		 */
+		struct Counters
+		{
+			uint32_t DrawCalls = 0;
+			uint64_t IndicesDrawn = 0;
+			uint32_t StateChanges = 0;
+			uint64_t BytesUploaded = 0;
+		};
+	public: // Main Functionality
+		void Record(NullCommand&& p_Command);
+		void Clear();
+		uint32_t Count(NullCommandType p_Type) const;
+	public: // Getters & Setters
+		void SetRecording(bool p_Recording) { m_Recording = p_Recording; }
+		bool IsRecording() const { return m_Recording; }
+		const std::vector<NullCommand>& GetCommands() const { return m_Commands; }
+		const Counters& GetCounters() const { return m_Counters; }
+
+		/**
+		 * @brief Hands out renderer IDs, so recorded commands can
+		 * tell the Null resources apart.
+		 * @returns A new renderer ID, never 0.
+		 */
+		uint32_t NextRendererID() { return ++m_LastRendererID; }
+
+		static NullCommandLog& Get();
+	private: // Private Member Variables
+		std::vector<NullCommand> m_Commands;
+		Counters m_Counters;
+		uint32_t m_LastRendererID = 0;
+		bool m_Recording = false;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_NULL_COMMAND_LOG_H_INCLUDED__
\ No newline at end of file
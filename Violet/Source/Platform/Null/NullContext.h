@@ -0,0 +1,30 @@
+/////////////////
+///
+/// NullContext.h
+/// Violet McAllister
+/// August 4th, 2022
+///
+/// The graphics context of the Null renderer,
+/// which has nothing to create or present.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_NULL_CONTEXT_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_NULL_CONTEXT_H_INCLUDED__
+
+#include "Violet/Renderer/GraphicsContext.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Null Implementation of a graphics context.
+	 */
+	class NullContext : public GraphicsContext
+	{
+	public: // Main Functionality
+		virtual void Init() override { }
+		virtual void SwapBuffers() override { }
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_NULL_CONTEXT_H_INCLUDED__
\ No newline at end of file
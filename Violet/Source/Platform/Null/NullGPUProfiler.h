@@ -0,0 +1,32 @@
+/////////////////
+///
+/// NullGPUProfiler.h
+/// Violet McAllister
+/// August 4th, 2022
+///
+/// The GPU profiler of the Null renderer, which
+/// has no GPU work to time.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_NULL_GPU_PROFILER_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_NULL_GPU_PROFILER_H_INCLUDED__
+
+#include "Violet/Renderer/GPUProfiler.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Null implementation of a GPUProfiler. Every query
+	 * is invalid, so scopes end without doing anything.
+	 */
+	class NullGPUProfiler : public GPUProfiler
+	{
+	public: // Main Functionality
+		virtual uint32_t BeginQuery(const char* p_Name) override { return InvalidQuery; }
+		virtual void EndQuery(uint32_t p_Query) override { }
+		virtual void EndFrame() override { }
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_NULL_GPU_PROFILER_H_INCLUDED__
\ No newline at end of file
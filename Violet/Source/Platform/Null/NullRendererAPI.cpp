@@ -0,0 +1,82 @@
+/////////////////
+///
+/// NullRendererAPI.cpp
+/// Violet McAllister
+/// August 4th, 2022
+///
+/// A RendererAPI which draws nothing. Draws and
+/// state changes are recorded into the
+/// NullCommandLog, so the CPU side of rendering
+/// can be measured and tested without a GPU.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/Null/NullRendererAPI.h"
+
+#include "Platform/Null/NullCommandLog.h"
+#include "Platform/Null/NullVertexArray.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Records setting the viewport.
+	 * @param p_X The x position of the view port.
+	 * @param p_Y The y position of the view port.
+	 * @param p_Width The width of the view port.
+	 * @param p_Height The height of the view port.
+	 */
+	void NullRendererAPI::SetViewport(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height)
+	{
+		NullCommand command = { NullCommandType::SetViewport };
+		command.Value = glm::vec4((float)p_X, (float)p_Y, (float)p_Width, (float)p_Height);
+		NullCommandLog::Get().Record(std::move(command));
+	}
+
+	/**
+	 * @brief Records setting the clear color.
+	 * @param p_Color The clear color.
+	 */
+	void NullRendererAPI::SetClearColor(const glm::vec4& p_Color)
+	{
+		NullCommand command = { NullCommandType::SetClearColor };
+		command.Value = p_Color;
+		NullCommandLog::Get().Record(std::move(command));
+	}
+
+	/**
+	 * @brief Records clearing the color and depth buffers.
+	 */
+	void NullRendererAPI::Clear()
+	{
+		NullCommandLog::Get().Record({ NullCommandType::Clear });
+	}
+
+	/**
+	 * @brief Records a draw of the vertex array.
+	 * @param p_VertexArray The vertex array being drawn.
+	 * @param p_IndexCount The number of indices, all of them if 0.
+	 */
+	void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& p_VertexArray, uint32_t p_IndexCount)
+	{
+		uint32_t count = p_IndexCount ? p_IndexCount : p_VertexArray->GetIndexBuffer()->GetCount();
+
+		NullCommand command = { NullCommandType::DrawIndexed, static_cast<const NullVertexArray*>(p_VertexArray.get())->GetRendererID() };
+		command.Count = count;
+		NullCommandLog::Get().Record(std::move(command));
+	}
+
+	/**
+	 * @brief Nothing was drawn, so the pixels read back black.
+	 * @param p_X The left of the rectangle.
+	 * @param p_Y The bottom of the rectangle.
+	 * @param p_Width The width of the rectangle.
+	 * @param p_Height The height of the rectangle.
+	 * @param p_Pixels The pixels.
+	 */
+	void NullRendererAPI::ReadPixels(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height, uint32_t* p_Pixels)
+	{
+		memset(p_Pixels, 0, (size_t)p_Width * p_Height * sizeof(uint32_t));
+	}
+}
\ No newline at end of file
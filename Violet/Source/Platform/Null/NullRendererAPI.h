@@ -0,0 +1,37 @@
+/////////////////
+///
+/// NullRendererAPI.h
+/// Violet McAllister
+/// August 4th, 2022
+///
+/// A RendererAPI which draws nothing. Draws and
+/// state changes are recorded into the
+/// NullCommandLog, so the CPU side of rendering
+/// can be measured and tested without a GPU.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_NULL_RENDERER_API_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_NULL_RENDERER_API_H_INCLUDED__
+
+#include "Violet/Renderer/RendererAPI.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Null implementation of a RendererAPI.
+	 */
+	class NullRendererAPI : public RendererAPI
+	{
+	public: // Initializer
+		virtual void Init() override { }
+	public: // Main Functionality
+		virtual void SetViewport(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height) override;
+		virtual void SetClearColor(const glm::vec4& p_Color) override;
+		virtual void Clear() override;
+		virtual void DrawIndexed(const Ref<VertexArray>& p_VertexArray, uint32_t p_IndexCount = 0) override;
+		virtual void ReadPixels(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height, uint32_t* p_Pixels) override;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_NULL_RENDERER_API_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,159 @@
+/////////////////
+///
+/// NullShader.cpp
+/// Violet McAllister
+/// August 4th, 2022
+/// Updated: August 6th, 2022
+///
+/// Null implementation of a Shader. Nothing is
+/// compiled, uniforms are recorded and the
+/// matrices kept for inspection.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include <cstring>
+
+#include "Platform/Null/NullShader.h"
+
+#include "Platform/Null/NullCommandLog.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Constructs a NullShader object. The sources are
+	 * not used.
+	 * @param p_Name The name of the shader.
+	 * @param p_VertexSource The vertex source.
+	 * @param p_FragmentSource The fragment source.
+	 */
+	NullShader::NullShader(const std::string& p_Name, const std::string& p_VertexSource, const std::string& p_FragmentSource)
+		: m_RendererID(NullCommandLog::Get().NextRendererID()), m_Name(p_Name)
+	{
+	}
+
+	/**
+	 * @brief Records binding the shader.
+	 */
+	void NullShader::Bind() const
+	{
+		NullCommandLog::Get().Record({ NullCommandType::BindShader, m_RendererID });
+	}
+
+	/**
+	 * @brief Records setting an int uniform.
+	 * @param p_Name The name of the uniform.
+	 * @param p_Value The value.
+	 */
+	void NullShader::SetInt(const char* p_Name, int p_Value)
+	{
+		RecordUniform(p_Name, glm::vec4((float)p_Value, 0.0f, 0.0f, 0.0f));
+	}
+
+	/**
+	 * @brief Records setting an int array uniform, only its
+	 * length is kept.
+	 * @param p_Name The name of the uniform.
+	 * @param p_Values The values.
+	 * @param p_Count The number of values.
+	 */
+	void NullShader::SetIntArray(const char* p_Name, int* p_Values, uint32_t p_Count)
+	{
+		RecordUniform(p_Name, glm::vec4(0.0f), p_Count);
+	}
+
+	/**
+	 * @brief Records setting a float uniform.
+	 * @param p_Name The name of the uniform.
+	 * @param p_Value The value.
+	 */
+	void NullShader::SetFloat(const char* p_Name, float p_Value)
+	{
+		RecordUniform(p_Name, glm::vec4(p_Value, 0.0f, 0.0f, 0.0f));
+	}
+
+	/**
+	 * @brief Records setting a float3 uniform.
+	 * @param p_Name The name of the uniform.
+	 * @param p_Value The value.
+	 */
+	void NullShader::SetFloat3(const char* p_Name, const glm::vec3& p_Value)
+	{
+		RecordUniform(p_Name, glm::vec4(p_Value, 0.0f));
+	}
+
+	/**
+	 * @brief Records setting a float4 uniform.
+	 * @param p_Name The name of the uniform.
+	 * @param p_Value The value.
+	 */
+	void NullShader::SetFloat4(const char* p_Name, const glm::vec4& p_Value)
+	{
+		RecordUniform(p_Name, p_Value);
+	}
+
+	/**
+	 * @brief Records setting a mat4 uniform and keeps the matrix.
+	 * @param p_Name The name of the uniform.
+	 * @param p_Value The value.
+	 */
+	void NullShader::SetMat4(const char* p_Name, const glm::mat4& p_Value)
+	{
+		for (uint32_t i = 0; i < m_MatrixCount; i++)
+		{
+			if (std::strcmp(m_Matrices[i].Name, p_Name) == 0)
+			{
+				m_Matrices[i].Value = p_Value;
+				RecordUniform(p_Name, glm::vec4(0.0f));
+				return;
+			}
+		}
+
+		VT_CORE_ASSERT(m_MatrixCount < s_MaxMatrices, "Too Many Mat4 Uniforms!");
+		VT_CORE_ASSERT(std::strlen(p_Name) < sizeof(MatrixUniform::Name), "Mat4 Uniform Name Too Long!");
+		if (m_MatrixCount < s_MaxMatrices)
+		{
+			MatrixUniform& matrix = m_Matrices[m_MatrixCount++];
+			std::strncpy(matrix.Name, p_Name, sizeof(matrix.Name) - 1);
+			matrix.Name[sizeof(matrix.Name) - 1] = '\0';
+			matrix.Value = p_Value;
+		}
+
+		RecordUniform(p_Name, glm::vec4(0.0f));
+	}
+
+	/**
+	 * @brief Gets the last value a mat4 uniform was set to.
+	 * @param p_Name The name of the uniform.
+	 * @returns The matrix, identity if it was never set.
+	 */
+	const glm::mat4& NullShader::GetMat4(const char* p_Name) const
+	{
+		static const glm::mat4 s_Identity = glm::mat4(1.0f);
+
+		for (uint32_t i = 0; i < m_MatrixCount; i++)
+			if (std::strcmp(m_Matrices[i].Name, p_Name) == 0)
+				return m_Matrices[i].Value;
+
+		return s_Identity;
+	}
+
+	/**
+	 * @brief Records a uniform being set.
+	 * @param p_Name The name of the uniform.
+	 * @param p_Value The value, widened to a vec4.
+	 * @param p_Count The number of values.
+	 */
+	void NullShader::RecordUniform(const char* p_Name, const glm::vec4& p_Value, uint32_t p_Count)
+	{
+		NullCommandLog& log = NullCommandLog::Get();
+
+		NullCommand command = { NullCommandType::SetUniform, m_RendererID };
+		command.Count = p_Count;
+		command.Value = p_Value;
+		if (log.IsRecording())
+			command.Name = p_Name;
+		log.Record(std::move(command));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+/////////////////
+///
+/// NullShader.h
+/// Violet McAllister
+/// August 4th, 2022
+/// Updated: August 6th, 2022
+///
+/// Null implementation of a Shader. Nothing is
+/// compiled, uniforms are recorded and the
+/// matrices kept for inspection.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_NULL_SHADER_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_NULL_SHADER_H_INCLUDED__
+
+#include <glm/glm.hpp>
+
+#include "Violet/Renderer/Shader.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Null Implementation of a Shader.
+	 */
+	class NullShader : public Shader
+	{
+	public: // Constructors & Deconstructors
+		NullShader(const std::string& p_Name, const std::string& p_VertexSource, const std::string& p_FragmentSource);
+	public: // Main Functionality
+		virtual void Bind() const override;
+		virtual void Unbind() const override { }
+	public: // Uniforms
+		virtual void SetInt(const char* p_Name, int p_Value) override;
+		virtual void SetIntArray(const char* p_Name, int* p_Values, uint32_t p_Count) override;
+		virtual void SetFloat(const char* p_Name, float p_Value) override;
+		virtual void SetFloat3(const char* p_Name, const glm::vec3& p_Value) override;
+		virtual void SetFloat4(const char* p_Name, const glm::vec4& p_Value) override;
+		virtual void SetMat4(const char* p_Name, const glm::mat4& p_Value) override;
+	public: // Getters
+		/**
+		 * @brief Gets the name of the shader.
+		 * @returns The name of the shader.
+		 */
+		virtual const std::string& GetName() const override { return m_Name; }
+
+		uint32_t GetRendererID() const { return m_RendererID; }
+		const glm::mat4& GetMat4(const char* p_Name) const;
+	private: // Helpers
+		void RecordUniform(const char* p_Name, const glm::vec4& p_Value, uint32_t p_Count = 1);
+	private: // Private Member Variables
+		uint32_t m_RendererID;
+		std::string m_Name;
+
+		// Matrices are few and set every frame, so a small array avoids building keys.
+		struct MatrixUniform
+		{
+			char Name[64];
+			glm::mat4 Value;
+		};
+
+		static constexpr uint32_t s_MaxMatrices = 8;
+		MatrixUniform m_Matrices[s_MaxMatrices];
+		uint32_t m_MatrixCount = 0;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_NULL_SHADER_H_INCLUDED__
\ No newline at end of file
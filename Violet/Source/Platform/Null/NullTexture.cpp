@@ -0,0 +1,98 @@
+/////////////////
+///
+/// NullTexture.cpp
+/// Violet McAllister
+/// August 4th, 2022
+/// Updated: August 6th, 2022
+///
+/// Null implementation of a 2D Texture, keeping
+/// its pixels in CPU memory.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/Null/NullTexture.h"
+
+#include "Platform/Null/NullCommandLog.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Constructs a NullTexture2D object using only the
+	 * width and height that the texture should be.
+	 * @param p_Width The width of the created texture.
+	 * @param p_Height The height of the created texture.
+	 */
+	NullTexture2D::NullTexture2D(uint32_t p_Width, uint32_t p_Height)
+		: m_Width(p_Width), m_Height(p_Height), m_RendererID(NullCommandLog::Get().NextRendererID()),
+		m_Pixels((size_t)p_Width * p_Height)
+	{
+	}
+
+	/**
+	 * @brief Constructs a NullTexture2D object.
+	 * @param p_Filepath The path to the image file.
+	 */
+	NullTexture2D::NullTexture2D(const std::string& p_Filepath)
+		: NullTexture2D(ImageData::Load(p_Filepath))
+	{
+	}
+
+	/**
+	 * @brief Constructs a NullTexture2D object from a decoded
+	 * image, expanding grey, grey-alpha and RGB images to RGBA.
+	 * @param p_Image The decoded image.
+	 */
+	NullTexture2D::NullTexture2D(const ImageData& p_Image)
+		: NullTexture2D(p_Image.GetWidth(), p_Image.GetHeight())
+	{
+		VT_PROFILE_FUNCTION();
+
+		VT_CORE_ASSERT(p_Image.IsValid(), "[STB_IMAGE ERROR] Failed To Load Image!");
+		m_Path = p_Image.GetPath();
+
+		const uint8_t* source = p_Image.GetPixels();
+		uint32_t channels = p_Image.GetChannels();
+		VT_CORE_ASSERT(channels >= 1 && channels <= 4, "Format not supported!");
+
+		// Grey images spread their one channel over red, green and blue.
+		uint32_t green = channels >= 3 ? 1 : 0;
+		uint32_t blue = channels >= 3 ? 2 : 0;
+		uint32_t alpha = channels == 2 || channels == 4 ? channels - 1 : UINT32_MAX;
+
+		uint8_t* destination = (uint8_t*)m_Pixels.data();
+		for (size_t i = 0; i < m_Pixels.size(); i++)
+		{
+			const uint8_t* pixel = source + i * channels;
+			destination[i * 4 + 0] = pixel[0];
+			destination[i * 4 + 1] = pixel[green];
+			destination[i * 4 + 2] = pixel[blue];
+			destination[i * 4 + 3] = alpha != UINT32_MAX ? pixel[alpha] : 0xff;
+		}
+	}
+
+	/**
+	 * @brief Replaces the pixels of the texture.
+	 * @param p_Data The RGBA8 pixels.
+	 * @param p_Size The size of the pixels in bytes.
+	 */
+	void NullTexture2D::SetData(void* p_Data, uint32_t p_Size)
+	{
+		VT_CORE_ASSERT(p_Size == m_Width * m_Height * 4, "Data must be entire texture!");
+		memcpy(m_Pixels.data(), p_Data, p_Size);
+
+		NullCommand command = { NullCommandType::UploadTextureData, m_RendererID };
+		command.Count = p_Size;
+		NullCommandLog::Get().Record(std::move(command));
+	}
+
+	/**
+	 * @brief Records binding the texture to a slot.
+	 * @param p_Slot The texture slot.
+	 */
+	void NullTexture2D::Bind(uint32_t p_Slot) const
+	{
+		NullCommandLog::Get().Record({ NullCommandType::BindTexture, m_RendererID, p_Slot });
+	}
+}
\ No newline at end of file
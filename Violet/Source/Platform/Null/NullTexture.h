@@ -0,0 +1,68 @@
+/////////////////
+///
+/// NullTexture.h
+/// Violet McAllister
+/// August 4th, 2022
+///
+/// Null implementation of a 2D Texture, keeping
+/// its pixels in CPU memory.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_NULL_TEXTURE_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_NULL_TEXTURE_H_INCLUDED__
+
+#include <vector>
+
+#include "Violet/Renderer/Texture.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Null Implementation of a 2D Texture object. Pixels
+	 * are kept as RGBA8 whatever the source format was.
+	 */
+	class NullTexture2D : public Texture2D
+	{
+	public: // Constructors & Deconstructors
+		NullTexture2D(uint32_t p_Width, uint32_t p_Height);
+		NullTexture2D(const std::string& p_Filepath);
+		NullTexture2D(const ImageData& p_Image);
+	public: // Getters
+		/**
+		 * @brief Gets the width of the texture.
+		 * @returns The width of the texture.
+		 */
+		virtual uint32_t GetWidth() const override { return m_Width; }
+
+		/**
+		 * @brief Gets the height of the texture.
+		 * @returns The height of the texture.
+		 */
+		virtual uint32_t GetHeight() const override { return m_Height; }
+
+		/**
+		 * @brief Gets the renderer ID of the texture.
+		 * @returns The renderer ID of the texture.
+		 */
+		virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+		const uint32_t* GetPixels() const { return m_Pixels.data(); }
+	public: // Setter
+		virtual void SetData(void* p_Data, uint32_t p_Size) override;
+	public: // Main Functionality
+		virtual void Bind(uint32_t p_Slot = 0) const override;
+	public: // Operator Overrides
+		virtual bool operator==(const Texture& p_Other) const override
+		{
+			return m_RendererID == p_Other.GetRendererID();
+		}
+	private: // Private Member Variables
+		std::string m_Path;
+		uint32_t m_Width, m_Height;
+		uint32_t m_RendererID;
+		std::vector<uint32_t> m_Pixels;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_NULL_TEXTURE_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,55 @@
+/////////////////
+///
+/// NullVertexArray.cpp
+/// Violet McAllister
+/// August 4th, 2022
+///
+/// Null implementation of a Vertex Array,
+/// holding on to its buffers.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/Null/NullVertexArray.h"
+
+#include "Platform/Null/NullCommandLog.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Constructs a NullVertexArray object.
+	 */
+	NullVertexArray::NullVertexArray()
+		: m_RendererID(NullCommandLog::Get().NextRendererID())
+	{
+	}
+
+	/**
+	 * @brief Records binding the vertex array.
+	 */
+	void NullVertexArray::Bind() const
+	{
+		NullCommandLog::Get().Record({ NullCommandType::BindVertexArray, m_RendererID });
+	}
+
+	/**
+	 * @brief Adds a vertex buffer to the vertex array.
+	 * @param p_VertexBuffer The vertex buffer.
+	 */
+	void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& p_VertexBuffer)
+	{
+		VT_CORE_ASSERT(p_VertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer Has No Layout!");
+
+		m_VertexBuffers.push_back(p_VertexBuffer);
+	}
+
+	/**
+	 * @brief Sets the index buffer of the vertex array.
+	 * @param p_IndexBuffer The index buffer.
+	 */
+	void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& p_IndexBuffer)
+	{
+		m_IndexBuffer = p_IndexBuffer;
+	}
+}
\ No newline at end of file
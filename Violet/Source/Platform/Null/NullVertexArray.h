@@ -0,0 +1,53 @@
+/////////////////
+///
+/// NullVertexArray.h
+/// Violet McAllister
+/// August 4th, 2022
+///
+/// Null implementation of a Vertex Array,
+/// holding on to its buffers.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_NULL_VERTEX_ARRAY_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_NULL_VERTEX_ARRAY_H_INCLUDED__
+
+#include "Violet/Renderer/VertexArray.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Null Implementation of a
+	 * Vertex Array.
+	 */
+	class NullVertexArray : public VertexArray
+	{
+	public: // Constructors
+		NullVertexArray();
+	public: // Main Functionality
+		virtual void Bind() const override;
+		virtual void Unbind() const override { }
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& p_VertexBuffer) override;
+		virtual void SetIndexBuffer(const Ref<IndexBuffer>& p_IndexBuffer) override;
+	public: // Getters
+		/**
+		 * @brief Gets the list of vertex buffers.
+		 * @returns The list of vertex buffers.
+		 */
+		virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+
+		/**
+		 * @brief Gets the set index buffer.
+		 * @returns The set index buffer.
+		 */
+		virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+		uint32_t GetRendererID() const { return m_RendererID; }
+	private: // Private Member Variables
+		uint32_t m_RendererID;
+		std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+		Ref<IndexBuffer> m_IndexBuffer;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_NULL_VERTEX_ARRAY_H_INCLUDED__
\ No newline at end of file
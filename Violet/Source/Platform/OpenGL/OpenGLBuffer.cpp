@@ -3,7 +3,7 @@
 /// OpenGLBuffer.cpp
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 15th, 2022
+/// Updated: July 17th, 2022
 ///
 /// Contains OpenGL implementations of Vertex & 
 /// Index Buffer objects used to store information 
@@ -67,7 +67,7 @@ namespace Violet
 	 */
 	void OpenGLVertexBuffer::Bind() const
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 	}
@@ -77,7 +77,7 @@ namespace Violet
 	 */
 	void OpenGLVertexBuffer::Unbind() const
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
@@ -130,7 +130,7 @@ namespace Violet
 	 */
 	void OpenGLIndexBuffer::Bind() const
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
 	}
@@ -140,7 +140,7 @@ namespace Violet
 	 */
 	void OpenGLIndexBuffer::Unbind() const
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 	}
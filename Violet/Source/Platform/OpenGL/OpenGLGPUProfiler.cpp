@@ -0,0 +1,107 @@
+/////////////////
+///
+/// OpenGLGPUProfiler.cpp
+/// Violet McAllister
+/// July 20th, 2022
+/// Updated: August 6th, 2022
+///
+/// Implementation of the OpenGL GPU profiler.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/OpenGL/OpenGLGPUProfiler.h"
+
+#include <glad/glad.h>
+
+namespace Violet
+{
+	/**
+	 * @brief Constructs an OpenGLGPUProfiler and creates the
+	 * query pool.
+	 */
+	OpenGLGPUProfiler::OpenGLGPUProfiler()
+	{
+		VT_PROFILE_FUNCTION();
+
+		for (FrameQueries& frame : m_Frames)
+			glGenQueries(MaxQueriesPerFrame, frame.RendererIDs);
+	}
+
+	/**
+	 * @brief Deconstructs an OpenGLGPUProfiler and deletes the
+	 * query pool.
+	 */
+	OpenGLGPUProfiler::~OpenGLGPUProfiler()
+	{
+		VT_PROFILE_FUNCTION();
+
+		for (FrameQueries& frame : m_Frames)
+			glDeleteQueries(MaxQueriesPerFrame, frame.RendererIDs);
+	}
+
+	/**
+	 * @brief Begins timing GPU work. Time elapsed queries cannot
+	 * nest, so a nested scope is not timed.
+	 * @param p_Name The name of the scope, in static storage.
+	 * @returns The query, or InvalidQuery if none was started.
+	 */
+	uint32_t OpenGLGPUProfiler::BeginQuery(const char* p_Name)
+	{
+		FrameQueries& frame = m_Frames[m_FrameIndex];
+		if (m_QueryActive || frame.Count == MaxQueriesPerFrame)
+			return InvalidQuery;
+
+		uint32_t query = frame.Count++;
+		frame.Infos[query] = { p_Name, ProfileClock::ToMicroseconds(ProfileClock::Now()) };
+
+		glBeginQuery(GL_TIME_ELAPSED, frame.RendererIDs[query]);
+		m_QueryActive = true;
+
+		return query;
+	}
+
+	/**
+	 * @brief Ends timing GPU work.
+	 * @param p_Query The query returned by BeginQuery.
+	 */
+	void OpenGLGPUProfiler::EndQuery(uint32_t p_Query)
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+		m_QueryActive = false;
+	}
+
+	/**
+	 * @brief Moves to the next frame and writes out the queries
+	 * of the oldest frame, issued FramesInFlight frames before
+	 * the one just ended. They are reused from here on.
+	 */
+	void OpenGLGPUProfiler::EndFrame()
+	{
+		VT_PROFILE_FUNCTION();
+
+		m_FrameIndex = (m_FrameIndex + 1) % (FramesInFlight + 1);
+
+		FrameQueries& frame = m_Frames[m_FrameIndex];
+		for (uint32_t i = 0; i < frame.Count; i++)
+		{
+			// Results that are still not ready are dropped instead of stalling.
+			GLint available = 0;
+			glGetQueryObjectiv(frame.RendererIDs[i], GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available)
+				continue;
+
+			GLuint64 elapsed = 0;
+			glGetQueryObjectui64v(frame.RendererIDs[i], GL_QUERY_RESULT, &elapsed);
+
+			double start = std::max(frame.Infos[i].CPUStart, m_LastGPUEnd);
+			double duration = elapsed / 1000.0;
+			m_LastGPUEnd = start + duration;
+
+			Instrumentor::Get().WriteGPUProfile(frame.Infos[i].Name, start, duration);
+		}
+
+		frame.Count = 0;
+	}
+}
\ No newline at end of file
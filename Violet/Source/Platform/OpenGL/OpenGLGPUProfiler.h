@@ -0,0 +1,61 @@
+/////////////////
+///
+/// OpenGLGPUProfiler.h
+/// Violet McAllister
+/// July 20th, 2022
+/// Updated: August 6th, 2022
+///
+/// Implements the GPU profiler for OpenGL with
+/// GL_TIME_ELAPSED queries.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_OPEN_GL_GPU_PROFILER_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_OPEN_GL_GPU_PROFILER_H_INCLUDED__
+
+#include "Violet/Renderer/GPUProfiler.h"
+
+namespace Violet
+{
+	/**
+	 * @brief OpenGL implementation of a GPUProfiler. Queries
+	 * are pooled per frame and read back FramesInFlight
+	 * frames after they were issued, so the pool holds one
+	 * frame more than that.
+	 */
+	class OpenGLGPUProfiler : public GPUProfiler
+	{
+	public: // Constants
+		static constexpr uint32_t FramesInFlight = 4;
+		static constexpr uint32_t MaxQueriesPerFrame = 32;
+	public: // Constructors & Deconstructors
+		OpenGLGPUProfiler();
+		virtual ~OpenGLGPUProfiler();
+	public: // Main Functionality
+		virtual uint32_t BeginQuery(const char* p_Name) override;
+		virtual void EndQuery(uint32_t p_Query) override;
+		virtual void EndFrame() override;
+	private: // Query Info
+		struct QueryInfo
+		{
+			const char* Name;
+			double CPUStart;
+		};
+
+		struct FrameQueries
+		{
+			uint32_t RendererIDs[MaxQueriesPerFrame];
+			QueryInfo Infos[MaxQueriesPerFrame];
+			uint32_t Count = 0;
+		};
+	private: // Private Member Variables
+		FrameQueries m_Frames[FramesInFlight + 1];
+		uint32_t m_FrameIndex = 0;
+		bool m_QueryActive = false;
+
+		// GPU work is serial, so a scope cannot start before the previous one ended.
+		double m_LastGPUEnd = 0.0;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_OPEN_GL_GPU_PROFILER_H_INCLUDED__
\ No newline at end of file
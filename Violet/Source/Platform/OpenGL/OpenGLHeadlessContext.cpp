@@ -0,0 +1,143 @@
+/////////////////
+///
+/// OpenGLHeadlessContext.cpp
+/// Violet McAllister
+/// August 3rd, 2022
+///
+/// An offscreen OpenGL context created through
+/// EGL, for machines without a display server
+/// or GPU. Mesa's surfaceless platform renders
+/// with its software rasterizer.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/OpenGL/OpenGLHeadlessContext.h"
+
+#include <glad/glad.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+namespace Violet
+{
+	/**
+	 * @brief Constructs an OpenGLHeadlessContext.
+	 * @param p_Width The width of the offscreen surface.
+	 * @param p_Height The height of the offscreen surface.
+	 */
+	OpenGLHeadlessContext::OpenGLHeadlessContext(uint32_t p_Width, uint32_t p_Height)
+		: m_Width(p_Width), m_Height(p_Height)
+	{
+	}
+
+	/**
+	 * @brief Destroys the context and its surface.
+	 */
+	OpenGLHeadlessContext::~OpenGLHeadlessContext()
+	{
+		if (!m_Display)
+			return;
+
+		eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		if (m_Context)
+			eglDestroyContext(m_Display, m_Context);
+		if (m_Surface)
+			eglDestroySurface(m_Display, m_Surface);
+		eglTerminate(m_Display);
+	}
+
+	/**
+	 * @brief Creates the EGL display, pbuffer surface and context,
+	 * and loads OpenGL through EGL.
+	 */
+	void OpenGLHeadlessContext::Init()
+	{
+		VT_PROFILE_FUNCTION();
+
+		// The surfaceless platform needs neither a display server nor a GPU.
+		EGLDisplay display = EGL_NO_DISPLAY;
+		const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+		auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay && clientExtensions && strstr(clientExtensions, "EGL_MESA_platform_surfaceless"))
+			display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+		if (display == EGL_NO_DISPLAY)
+			display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+		EGLint eglMajor, eglMinor;
+		bool initialized = display != EGL_NO_DISPLAY && eglInitialize(display, &eglMajor, &eglMinor);
+		VT_CORE_ASSERT(initialized, "[EGL ERROR] Could Not Initialize EGL!");
+		if (!initialized)
+			return;
+		m_Display = display;
+
+		eglBindAPI(EGL_OPENGL_API);
+
+		const EGLint configAttributes[] = {
+			EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_RED_SIZE, 8,
+			EGL_GREEN_SIZE, 8,
+			EGL_BLUE_SIZE, 8,
+			EGL_ALPHA_SIZE, 8,
+			EGL_DEPTH_SIZE, 24,
+			EGL_NONE
+		};
+		EGLConfig config;
+		EGLint configCount = 0;
+		eglChooseConfig(display, configAttributes, &config, 1, &configCount);
+		VT_CORE_ASSERT(configCount > 0, "[EGL ERROR] No Config Supports Offscreen OpenGL!");
+		if (configCount == 0)
+			return;
+
+		const EGLint surfaceAttributes[] = {
+			EGL_WIDTH, (EGLint)m_Width,
+			EGL_HEIGHT, (EGLint)m_Height,
+			EGL_NONE
+		};
+		m_Surface = eglCreatePbufferSurface(display, config, surfaceAttributes);
+		VT_CORE_ASSERT(m_Surface != EGL_NO_SURFACE, "[EGL ERROR] Could Not Create The Offscreen Surface!");
+
+		const EGLint contextAttributes[] = {
+			EGL_CONTEXT_MAJOR_VERSION, 4,
+			EGL_CONTEXT_MINOR_VERSION, 5,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+		m_Context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+		VT_CORE_ASSERT(m_Context != EGL_NO_CONTEXT, "[EGL ERROR] Could Not Create An OpenGL 4.5 Context!");
+
+		// Makes the context current on this thread.
+		eglMakeCurrent(display, m_Surface, m_Surface, m_Context);
+		// Gets OpenGL functionality from the driver.
+		int status = gladLoadGLLoader((GLADloadproc)eglGetProcAddress);
+		VT_CORE_ASSERT(status, "[GLAD ERROR] Failed To Initialize Glad!");
+
+		VT_CORE_INFO("OpenGL Info (Headless, EGL {0}.{1}):", eglMajor, eglMinor);
+		VT_CORE_INFO("  Vendor: {0}", (const char*)glGetString(GL_VENDOR));
+		VT_CORE_INFO("  Renderer: {0}", (const char*)glGetString(GL_RENDERER));
+		VT_CORE_INFO("  Version: {0}", (const char*)glGetString(GL_VERSION));
+
+#ifdef VT_ENABLE_ASSERTS
+		int versionMajor;
+		int versionMinor;
+		glGetIntegerv(GL_MAJOR_VERSION, &versionMajor);
+		glGetIntegerv(GL_MINOR_VERSION, &versionMinor);
+
+		VT_CORE_ASSERT(versionMajor > 4 || (versionMajor == 4 && versionMinor >= 5), "Hazel requires at least OpenGL version 4.5!");
+#endif
+	}
+
+	/**
+	 * @brief A pbuffer has nothing to present, so this waits for
+	 * the frame to finish instead. Otherwise frame times would
+	 * not include the rendering.
+	 */
+	void OpenGLHeadlessContext::SwapBuffers()
+	{
+		VT_PROFILE_FUNCTION();
+
+		glFinish();
+	}
+}
\ No newline at end of file
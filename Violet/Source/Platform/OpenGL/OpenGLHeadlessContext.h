@@ -0,0 +1,45 @@
+/////////////////
+///
+/// OpenGLHeadlessContext.h
+/// Violet McAllister
+/// August 3rd, 2022
+///
+/// An offscreen OpenGL context created through
+/// EGL, for machines without a display server
+/// or GPU. Mesa's surfaceless platform renders
+/// with its software rasterizer.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_OPEN_GL_HEADLESS_CONTEXT_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_OPEN_GL_HEADLESS_CONTEXT_H_INCLUDED__
+
+#include <cstdint>
+
+#include "Violet/Renderer/GraphicsContext.h"
+
+namespace Violet
+{
+	/**
+	 * @brief OpenGL context rendering into an EGL pbuffer
+	 * instead of a window.
+	 */
+	class OpenGLHeadlessContext : public GraphicsContext
+	{
+	public: // Constructors & Deconstructors
+		OpenGLHeadlessContext(uint32_t p_Width, uint32_t p_Height);
+		virtual ~OpenGLHeadlessContext();
+	public: // Main Functionality
+		virtual void Init() override;
+		virtual void SwapBuffers() override;
+	private: // Private Member Variables
+		uint32_t m_Width, m_Height;
+
+		// EGL handles, kept opaque so EGL stays out of the headers.
+		void* m_Display = nullptr;
+		void* m_Surface = nullptr;
+		void* m_Context = nullptr;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_OPEN_GL_HEADLESS_CONTEXT_H_INCLUDED__
\ No newline at end of file
@@ -112,4 +112,19 @@ namespace Violet
 		glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
 		glBindTexture(GL_TEXTURE_2D, 0);
 	}
+
+	/**
+	 * @brief Wrapper for glReadPixels(). Reads RGBA8 pixels from
+	 * the framebuffer.
+	 * @param p_X The left of the rectangle.
+	 * @param p_Y The bottom of the rectangle.
+	 * @param p_Width The width of the rectangle.
+	 * @param p_Height The height of the rectangle.
+	 * @param p_Pixels The pixels, bottom row first.
+	 */
+	void OpenGLRendererAPI::ReadPixels(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height, uint32_t* p_Pixels)
+	{
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+		glReadPixels(p_X, p_Y, p_Width, p_Height, GL_RGBA, GL_UNSIGNED_BYTE, p_Pixels);
+	}
 }
\ No newline at end of file
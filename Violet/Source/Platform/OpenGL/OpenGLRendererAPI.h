@@ -32,6 +32,7 @@ namespace Violet
 		virtual void SetClearColor(const glm::vec4& p_Color) override;
 		virtual void Clear() override;
 		virtual void DrawIndexed(const Ref<VertexArray>& p_VertexArray, uint32_t p_IndexCount = 0) override;
+		virtual void ReadPixels(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height, uint32_t* p_Pixels) override;
 	};
 }
 
@@ -3,7 +3,7 @@
 /// OpenGLShader.cpp
 /// Violet McAllister
 /// July 13th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// A shader is a program which allows
 /// you to communicate with the GPU directly
@@ -19,51 +19,12 @@
 
 #include "Platform/OpenGL/OpenGLShader.h"
 
-#include <fstream>
-
 #include <glad/glad.h>
 
 #include <glm/gtc/type_ptr.hpp>
 
 namespace Violet
 {
-	/**
-	 * @brief Converts a shader type in string form to a shader
-	 * type in GLenum form.
-	 * @param p_Type The string type being converted.
-	 * @returns The Glenum converted type.
-	 */
-	static GLenum ShaderTypeFromString(const std::string& p_Type)
-	{
-		if (p_Type == "vertex")
-			return GL_VERTEX_SHADER;
-		if (p_Type == "fragment" || p_Type == "pixel")
-			return GL_FRAGMENT_SHADER;
-
-		VT_CORE_ASSERT(false, "Unknown shader type!");
-		return 0;
-	}
-
-	/**
-	 * @brief Constructs an OpenGLShader object using the file path.
-	 * @param p_Filepath The filepath to the shader code.
-	 */
-	OpenGLShader::OpenGLShader(const std::string& p_Filepath)
-	{
-		VT_PROFILE_FUNCTION();
-
-		std::string source = ReadFile(p_Filepath);
-		auto shaderSources = PreProcess(source);
-		Compile(shaderSources);
-
-		// Extract Name From Filepath
-		auto lastSlash = p_Filepath.find_last_of("/\\");
-		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
-		auto lastDot = p_Filepath.rfind('.');
-		auto count = lastDot == std::string::npos ? p_Filepath.size() - lastSlash : lastDot - lastSlash;
-		m_Name = p_Filepath.substr(lastSlash, count);
-	}
-	
 	/**
 	 * @brief Constructs and OpenGLShader object from source.
 	 * @param p_VertexSource The vertex shader source.
@@ -90,76 +51,6 @@ namespace Violet
 		glDeleteProgram(m_RendererID);
 	}
 
-	/**
-	 * @brief Reads file data.
-	 * @param p_Filepath The file path.
-	 * @returns The file as a string.
-	 */
-	std::string OpenGLShader::ReadFile(const std::string& p_Filepath)
-	{
-		VT_PROFILE_FUNCTION();
-
-		std::string result;
-		std::ifstream in(p_Filepath, std::ios::in | std::ios::binary);
-		if (in)
-		{
-			// Reads File Data into result
-			in.seekg(0, std::ios::end);
-			
-			size_t size = in.tellg();
-			if (size != -1)
-			{
-				result.resize(size);
-				in.seekg(0, std::ios::beg);
-				in.read(&result[0], size);
-				in.close();
-			}
-			else
-			{
-				VT_CORE_ERROR("Could not read from file '{0}'", p_Filepath);
-			}
-		}
-		else
-		{
-			VT_CORE_ERROR("Could Not Open File '{0}'", p_Filepath);
-		}
-
-		return result;
-	}
-
-	/**
-	 * @brief Takes a shader source and breaks it down into vertex and
-	 * fragment shader strings.
-	 * @param p_Source The file source.
-	 * @returns A map between a GLenum and it's corresponding string.
-	 */
-	std::unordered_map<GLenum, std::string> OpenGLShader::PreProcess(const std::string& p_Source)
-	{
-		VT_PROFILE_FUNCTION();
-
-		std::unordered_map<GLenum, std::string> shaderSources;
-
-		const char* typeToken = "#type";
-		size_t typeTokenLength = strlen(typeToken);
-		size_t pos = p_Source.find(typeToken, 0); // Start of shader type declaration line
-		while (pos != std::string::npos)
-		{
-			size_t eol = p_Source.find_first_of("\r\n", pos);
-			VT_CORE_ASSERT(eol != std::string::npos, "Syntax error");
-			size_t begin = pos + typeTokenLength + 1; // Start of shader type name (after "#type " keyword)
-			std::string type = p_Source.substr(begin, eol - begin);
-			VT_CORE_ASSERT(ShaderTypeFromString(type), "Invalid shader type specified");
-
-			size_t nextLinePos = p_Source.find_first_not_of("\r\n", eol); // Start of shader code after shader type declaration line
-			VT_CORE_ASSERT(nextLinePos != std::string::npos, "Syntax error");
-			pos = p_Source.find(typeToken, nextLinePos); // Start of next shader type declaration line
-
-			shaderSources[ShaderTypeFromString(type)] = (pos == std::string::npos) ? p_Source.substr(nextLinePos) : p_Source.substr(nextLinePos, pos - nextLinePos);
-		}
-
-		return shaderSources;
-	}
-
 	/**
 	 * @brief Compiles a shader program from shader sources.
 	 * @param p_ShaderSources the map of shader sources.
@@ -242,7 +133,7 @@ namespace Violet
 	 */
 	void OpenGLShader::Bind() const
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		glUseProgram(m_RendererID);
 	}
@@ -252,7 +143,7 @@ namespace Violet
 	 */
 	void OpenGLShader::Unbind() const
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		glUseProgram(0);
 	}
@@ -262,9 +153,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The integer value.
 	 */
-	void OpenGLShader::SetInt(const std::string& p_Name, int p_Value)
+	void OpenGLShader::SetInt(const char* p_Name, int p_Value)
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		UploadUniformInt(p_Name, p_Value);
 	}
@@ -275,9 +166,9 @@ namespace Violet
 	 * @param p_Values The integers.
 	 * @param p_Count The number of integers.
 	 */
-	void OpenGLShader::SetIntArray(const std::string& p_Name, int* p_Values, uint32_t p_Count)
+	void OpenGLShader::SetIntArray(const char* p_Name, int* p_Values, uint32_t p_Count)
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		UploadUniformIntArray(p_Name, p_Values, p_Count);
 	}
@@ -287,9 +178,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The float value.
 	 */
-	void OpenGLShader::SetFloat(const std::string& p_Name, float p_Value)
+	void OpenGLShader::SetFloat(const char* p_Name, float p_Value)
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		UploadUniformFloat(p_Name, p_Value);
 	}
@@ -299,9 +190,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The three float values as a vector.
 	 */
-	void OpenGLShader::SetFloat3(const std::string& p_Name, const glm::vec3& p_Value)
+	void OpenGLShader::SetFloat3(const char* p_Name, const glm::vec3& p_Value)
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		UploadUniformFloat3(p_Name, p_Value);
 	}
@@ -311,9 +202,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The four float values as a vector.
 	 */
-	void OpenGLShader::SetFloat4(const std::string& p_Name, const glm::vec4& p_Value)
+	void OpenGLShader::SetFloat4(const char* p_Name, const glm::vec4& p_Value)
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		UploadUniformFloat4(p_Name, p_Value);
 	}
@@ -323,7 +214,7 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The 4x4 matrix.
 	 */
-	void OpenGLShader::SetMat4(const std::string& p_Name, const glm::mat4& p_Value)
+	void OpenGLShader::SetMat4(const char* p_Name, const glm::mat4& p_Value)
 	{
 		UploadUniformMat4(p_Name, p_Value);
 	}
@@ -333,9 +224,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The integer value.
 	 */
-	void OpenGLShader::UploadUniformInt(const std::string& p_Name, int p_Value)
+	void OpenGLShader::UploadUniformInt(const char* p_Name, int p_Value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, p_Name.c_str());
+		GLint location = glGetUniformLocation(m_RendererID, p_Name);
 		glUniform1i(location, p_Value);
 	}
 
@@ -345,9 +236,9 @@ namespace Violet
 	 * @param p_Values The integers.
 	 * @param p_Count The number of integers.
 	 */
-	void OpenGLShader::UploadUniformIntArray(const std::string& p_Name, int* p_Values, uint32_t p_Count)
+	void OpenGLShader::UploadUniformIntArray(const char* p_Name, int* p_Values, uint32_t p_Count)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, p_Name.c_str());
+		GLint location = glGetUniformLocation(m_RendererID, p_Name);
 		glUniform1iv(location, p_Count, p_Values);
 	}
 
@@ -356,9 +247,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The float value.
 	 */
-	void OpenGLShader::UploadUniformFloat(const std::string& p_Name, float p_Value)
+	void OpenGLShader::UploadUniformFloat(const char* p_Name, float p_Value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, p_Name.c_str());
+		GLint location = glGetUniformLocation(m_RendererID, p_Name);
 		glUniform1f(location, p_Value);
 	}
 
@@ -367,9 +258,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The two float values as a vector.
 	 */
-	void OpenGLShader::UploadUniformFloat2(const std::string& p_Name, const glm::vec2& p_Value)
+	void OpenGLShader::UploadUniformFloat2(const char* p_Name, const glm::vec2& p_Value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, p_Name.c_str());
+		GLint location = glGetUniformLocation(m_RendererID, p_Name);
 		glUniform2f(location, p_Value.x, p_Value.y);
 	}
 
@@ -378,9 +269,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The three float values as a vector.
 	 */
-	void OpenGLShader::UploadUniformFloat3(const std::string& p_Name, const glm::vec3& p_Value)
+	void OpenGLShader::UploadUniformFloat3(const char* p_Name, const glm::vec3& p_Value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, p_Name.c_str());
+		GLint location = glGetUniformLocation(m_RendererID, p_Name);
 		glUniform3f(location, p_Value.x, p_Value.y, p_Value.z);
 	}
 
@@ -389,9 +280,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The four float values as a vector.
 	 */
-	void OpenGLShader::UploadUniformFloat4(const std::string& p_Name, const glm::vec4& p_Value)
+	void OpenGLShader::UploadUniformFloat4(const char* p_Name, const glm::vec4& p_Value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, p_Name.c_str());
+		GLint location = glGetUniformLocation(m_RendererID, p_Name);
 		glUniform4f(location, p_Value.x, p_Value.y, p_Value.z, p_Value.w);
 	}
 
@@ -400,9 +291,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The 3x3 matrix.
 	 */
-	void OpenGLShader::UploadUniformMat3(const std::string& p_Name, const glm::mat3& p_Matrix)
+	void OpenGLShader::UploadUniformMat3(const char* p_Name, const glm::mat3& p_Matrix)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, p_Name.c_str());
+		GLint location = glGetUniformLocation(m_RendererID, p_Name);
 		glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(p_Matrix));
 	}
 
@@ -411,9 +302,9 @@ namespace Violet
 	 * @param p_Name The name of the uniform in the shader.
 	 * @param p_Value The 4x4 matrix.
 	 */
-	void OpenGLShader::UploadUniformMat4(const std::string& p_Name, const glm::mat4& p_Matrix)
+	void OpenGLShader::UploadUniformMat4(const char* p_Name, const glm::mat4& p_Matrix)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, p_Name.c_str());
+		GLint location = glGetUniformLocation(m_RendererID, p_Name);
 		glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(p_Matrix));
 	}
 }
@@ -3,7 +3,7 @@
 /// OpenGLShader.h
 /// Violet McAllister
 /// July 13th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// A shader is a program which allows
 /// you to communicate with the GPU directly
@@ -33,19 +33,18 @@ namespace Violet
 	class OpenGLShader : public Shader
 	{
 	public: // Constructors & Deconstructors
-		OpenGLShader(const std::string& p_Filepath);
 		OpenGLShader(const std::string& p_Name, const std::string& p_VertexSource, const std::string& p_FragmentSource);
 		virtual ~OpenGLShader();
 	public: // Main Functionality
 		virtual void Bind() const override;
 		virtual void Unbind() const override;
 	public: // Uniforms
-		virtual void SetInt(const std::string& p_Name, int p_Value) override;
-		virtual void SetIntArray(const std::string& p_Name, int* p_Values, uint32_t p_Count) override;
-		virtual void SetFloat(const std::string& p_Name, float p_Value) override;
-		virtual void SetFloat3(const std::string& p_Name, const glm::vec3& p_Value) override;
-		virtual void SetFloat4(const std::string& p_Name, const glm::vec4& p_Value) override;
-		virtual void SetMat4(const std::string& p_Name, const glm::mat4& p_Value) override;
+		virtual void SetInt(const char* p_Name, int p_Value) override;
+		virtual void SetIntArray(const char* p_Name, int* p_Values, uint32_t p_Count) override;
+		virtual void SetFloat(const char* p_Name, float p_Value) override;
+		virtual void SetFloat3(const char* p_Name, const glm::vec3& p_Value) override;
+		virtual void SetFloat4(const char* p_Name, const glm::vec4& p_Value) override;
+		virtual void SetMat4(const char* p_Name, const glm::mat4& p_Value) override;
 	public: // Getters
 		/**
 		 * @brief Gets the name of the shader.
@@ -53,17 +52,15 @@ namespace Violet
 		 */
 		virtual const std::string& GetName() const override { return m_Name; }
 	public: // Uniform Internals
-		void UploadUniformInt(const std::string& p_Name, int p_Value);
-		void UploadUniformIntArray(const std::string& p_Name, int* p_Values, uint32_t p_Count);
-		void UploadUniformFloat(const std::string& p_Name, float p_Value);
-		void UploadUniformFloat2(const std::string& p_Name, const glm::vec2& p_Value);
-		void UploadUniformFloat3(const std::string& p_Name, const glm::vec3& p_Value);
-		void UploadUniformFloat4(const std::string& p_Name, const glm::vec4& p_Value);
-		void UploadUniformMat3(const std::string& p_Name, const glm::mat3& p_Matrix);
-		void UploadUniformMat4(const std::string& p_Name, const glm::mat4& p_Matrix);
+		void UploadUniformInt(const char* p_Name, int p_Value);
+		void UploadUniformIntArray(const char* p_Name, int* p_Values, uint32_t p_Count);
+		void UploadUniformFloat(const char* p_Name, float p_Value);
+		void UploadUniformFloat2(const char* p_Name, const glm::vec2& p_Value);
+		void UploadUniformFloat3(const char* p_Name, const glm::vec3& p_Value);
+		void UploadUniformFloat4(const char* p_Name, const glm::vec4& p_Value);
+		void UploadUniformMat3(const char* p_Name, const glm::mat3& p_Matrix);
+		void UploadUniformMat4(const char* p_Name, const glm::mat4& p_Matrix);
 	private: // Helpers
-		std::string ReadFile(const std::string& p_Filepath);
-		std::unordered_map<GLenum, std::string> PreProcess(const std::string& p_Source);
 		void Compile(const std::unordered_map<GLenum, std::string>& p_ShaderSources);
 	private: // Private Member Variables
 		uint32_t m_RendererID;
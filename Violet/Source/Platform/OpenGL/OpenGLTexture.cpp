@@ -3,7 +3,7 @@
 /// OpenGLTexture.cpp
 /// Violet McAllister
 /// July 13th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// A texture is a collection of
 /// data which can be uploaded to
@@ -18,8 +18,6 @@
 
 #include "Platform/OpenGL/OpenGLTexture.h"
 
-#include <stb_image.h>
-
 namespace Violet
 {
 	/**
@@ -51,31 +49,30 @@ namespace Violet
 	 * @param p_Filepath The path to the image file.
 	 */
 	OpenGLTexture2D::OpenGLTexture2D(const std::string& p_Filepath)
-		: m_Path(p_Filepath)
+		: OpenGLTexture2D(ImageData::Load(p_Filepath))
+	{
+	}
+
+	/**
+	 * @brief Constructs an OpenGLTexture2D object from a decoded
+	 * image, only the upload happens here.
+	 * @param p_Image The decoded image.
+	 */
+	OpenGLTexture2D::OpenGLTexture2D(const ImageData& p_Image)
+		: m_Path(p_Image.GetPath()), m_Width(p_Image.GetWidth()), m_Height(p_Image.GetHeight())
 	{
 		VT_PROFILE_FUNCTION();
 
-		// Get The Width, Height, and Channels
-		int width, height, channels;
-		stbi_set_flip_vertically_on_load(1);
-		// Get image data
-		stbi_uc* data = nullptr;
-		{
-			VT_PROFILE_SCOPE("stbi_load - OpenGLTexture2D::OpenGLTexture2d(const std::string&)");
-			data = stbi_load(p_Filepath.c_str(), &width, &height, &channels, 0);
-		}
-		VT_CORE_ASSERT(data, "[STB_IMAGE ERROR] Failed To Load Image!");
-		m_Width = width;
-		m_Height = height;
+		VT_CORE_ASSERT(p_Image.IsValid(), "[STB_IMAGE ERROR] Failed To Load Image!");
 
 		// Determine Internal & Data Formats
 		GLenum internalFormat = 0, dataFormat = 0;
-		if (channels == 4)
+		if (p_Image.GetChannels() == 4)
 		{
 			internalFormat = GL_RGBA8;
 			dataFormat = GL_RGBA;
 		}
-		else if (channels == 3)
+		else if (p_Image.GetChannels() == 3)
 		{
 			internalFormat = GL_RGB8;
 			dataFormat = GL_RGB;
@@ -94,10 +91,7 @@ namespace Violet
 		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
 		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE, data);
-
-		// Free the image data
-		stbi_image_free(data);
+		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE, p_Image.GetPixels());
 	}
 
 	/**
@@ -125,7 +119,7 @@ namespace Violet
 	 */
 	void OpenGLTexture2D::Bind(uint32_t p_Slot) const
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		glBindTextureUnit(p_Slot, m_RendererID);
 	}
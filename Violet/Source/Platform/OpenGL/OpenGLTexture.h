@@ -3,7 +3,7 @@
 /// OpenGLTexture.h
 /// Violet McAllister
 /// July 13th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// A texture is a collection of
 /// data which can be uploaded to
@@ -31,6 +31,7 @@ namespace Violet
 	public: // Constructors & Deconstructors
 		OpenGLTexture2D(uint32_t p_Width, uint32_t p_Height);
 		OpenGLTexture2D(const std::string& p_Filepath);
+		OpenGLTexture2D(const ImageData& p_Image);
 		virtual ~OpenGLTexture2D();
 	public: // Getters
 		/**
@@ -3,7 +3,7 @@
 /// OpenGLVertexArray.cpp
 /// Violet McAllister
 /// July 12th, 2022
-/// Updated: July 15th, 2022
+/// Updated: July 17th, 2022
 ///
 /// The vertex array object contains
 /// information about how the vertex 
@@ -73,7 +73,7 @@ namespace Violet
 	 */
 	void OpenGLVertexArray::Bind() const
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		glBindVertexArray(m_RendererID);
 	}
@@ -83,7 +83,7 @@ namespace Violet
 	 */
 	void OpenGLVertexArray::Unbind() const
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		glBindVertexArray(0);
 	}
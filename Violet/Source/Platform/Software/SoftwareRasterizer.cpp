@@ -0,0 +1,352 @@
+/////////////////
+///
+/// SoftwareRasterizer.cpp
+/// Violet McAllister
+/// August 5th, 2022
+///
+/// A tiled triangle rasterizer. Triangles are set
+/// up and binned into screen tiles in parallel,
+/// then every tile is rasterized by one job with
+/// SSE edge functions, four pixels at a time.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/Software/SoftwareRasterizer.h"
+
+#include <emmintrin.h>
+
+#include "Violet/Core/JobSystem.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Packs a color into RGBA8, red in the lowest byte.
+	 * @param p_Color The color.
+	 * @returns The packed color.
+	 */
+	static uint32_t PackColor(const glm::vec4& p_Color)
+	{
+		glm::vec4 color = glm::clamp(p_Color, 0.0f, 1.0f) * 255.0f + 0.5f;
+		return (uint32_t)color.r | ((uint32_t)color.g << 8) | ((uint32_t)color.b << 16) | ((uint32_t)color.a << 24);
+	}
+
+	/**
+	 * @brief Unpacks an RGBA8 color.
+	 * @param p_Color The packed color.
+	 * @returns The color.
+	 */
+	static glm::vec4 UnpackColor(uint32_t p_Color)
+	{
+		return glm::vec4(p_Color & 0xff, (p_Color >> 8) & 0xff, (p_Color >> 16) & 0xff, p_Color >> 24) * (1.0f / 255.0f);
+	}
+
+	/**
+	 * @brief Samples a texture with nearest filtering and repeat
+	 * wrapping.
+	 * @param p_Sampler The texture.
+	 * @param p_TexCoord The texture coordinate.
+	 * @returns The texel, white without a texture.
+	 */
+	static glm::vec4 Sample(const SoftwareSampler& p_Sampler, const glm::vec2& p_TexCoord)
+	{
+		if (!p_Sampler.Pixels)
+			return glm::vec4(1.0f);
+
+		int32_t width = (int32_t)p_Sampler.Width, height = (int32_t)p_Sampler.Height;
+		int32_t x = (int32_t)floorf(p_TexCoord.x * width) % width;
+		int32_t y = (int32_t)floorf(p_TexCoord.y * height) % height;
+		x += x < 0 ? width : 0;
+		y += y < 0 ? height : 0;
+		return UnpackColor(p_Sampler.Pixels[y * width + x]);
+	}
+
+	/**
+	 * @brief Resizes the color and depth buffers, clearing them.
+	 * @param p_Width The width in pixels.
+	 * @param p_Height The height in pixels.
+	 */
+	void SoftwareRasterizer::Resize(uint32_t p_Width, uint32_t p_Height)
+	{
+		if (p_Width == m_Width && p_Height == m_Height)
+			return;
+
+		m_Width = p_Width;
+		m_Height = p_Height;
+		m_TilesX = (p_Width + TileSize - 1) / TileSize;
+		m_TilesY = (p_Height + TileSize - 1) / TileSize;
+		m_Stride = m_TilesX * TileSize;
+
+		m_Color.assign((size_t)m_Stride * m_Height, 0);
+		m_Depth.assign((size_t)m_Stride * m_Height, 1.0f);
+		m_Bins.clear();
+	}
+
+	/**
+	 * @brief Clears the color buffer to a color and the depth
+	 * buffer to the far plane.
+	 * @param p_Color The clear color.
+	 */
+	void SoftwareRasterizer::Clear(const glm::vec4& p_Color)
+	{
+		VT_PROFILE_FUNCTION();
+
+		std::fill(m_Color.begin(), m_Color.end(), PackColor(p_Color));
+		std::fill(m_Depth.begin(), m_Depth.end(), 1.0f);
+	}
+
+	/**
+	 * @brief Draws an indexed triangle list. Returns once every
+	 * tile has been rasterized.
+	 * @param p_Vertices The transformed vertices.
+	 * @param p_VertexCount The number of vertices.
+	 * @param p_Indices The indices, three per triangle.
+	 * @param p_IndexCount The number of indices.
+	 * @param p_Samplers The textures bound to each slot, MaxSamplers of them.
+	 */
+	void SoftwareRasterizer::DrawTriangles(const SoftwareVertex* p_Vertices, uint32_t p_VertexCount, const uint32_t* p_Indices, uint32_t p_IndexCount, const SoftwareSampler* p_Samplers)
+	{
+		VT_PROFILE_FUNCTION();
+
+		uint32_t triangleCount = p_IndexCount / 3;
+		if (triangleCount == 0 || m_Width == 0 || m_Height == 0)
+			return;
+
+		uint32_t tileCount = m_TilesX * m_TilesY;
+		uint32_t chunkCount = (triangleCount + TrianglesPerChunk - 1) / TrianglesPerChunk;
+		if (m_Triangles.size() < triangleCount)
+			m_Triangles.resize(triangleCount);
+		if (m_Bins.size() < (size_t)chunkCount * tileCount)
+			m_Bins.resize((size_t)chunkCount * tileCount);
+
+		JobSystem::ParallelFor("SoftwareRasterizer Setup", chunkCount, 1, [&](uint32_t p_Chunk)
+		{
+			SetupChunk(p_Chunk, p_Vertices, p_VertexCount, p_Indices, triangleCount);
+		});
+
+		JobSystem::ParallelFor("SoftwareRasterizer Tiles", tileCount, 1, [&](uint32_t p_Tile)
+		{
+			RasterizeTile(p_Tile, chunkCount, p_Samplers);
+		});
+	}
+
+	/**
+	 * @brief Copies a rectangle of the color buffer out, row 0
+	 * being the bottom like glReadPixels.
+	 * @param p_X The left of the rectangle.
+	 * @param p_Y The bottom of the rectangle.
+	 * @param p_Width The width of the rectangle.
+	 * @param p_Height The height of the rectangle.
+	 * @param p_Pixels The RGBA8 pixels, p_Width * p_Height of them.
+	 */
+	void SoftwareRasterizer::ReadPixels(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height, uint32_t* p_Pixels) const
+	{
+		VT_CORE_ASSERT(p_X + p_Width <= m_Width && p_Y + p_Height <= m_Height, "Pixels Outside The Framebuffer!");
+
+		for (uint32_t row = 0; row < p_Height; row++)
+			memcpy(p_Pixels + (size_t)row * p_Width, &m_Color[(size_t)(p_Y + row) * m_Stride + p_X], p_Width * sizeof(uint32_t));
+	}
+
+	/**
+	 * @brief Sets up a chunk of triangles and bins them into the
+	 * tiles they overlap. Every chunk has its own bins, so chunks
+	 * set up in parallel without locking.
+	 * @param p_Chunk The chunk.
+	 * @param p_Vertices The transformed vertices.
+	 * @param p_VertexCount The number of vertices.
+	 * @param p_Indices The indices.
+	 * @param p_TriangleCount The number of triangles in the draw.
+	 */
+	void SoftwareRasterizer::SetupChunk(uint32_t p_Chunk, const SoftwareVertex* p_Vertices, uint32_t p_VertexCount, const uint32_t* p_Indices, uint32_t p_TriangleCount)
+	{
+		VT_PROFILE_VERBOSE_FUNCTION();
+
+		uint32_t tileCount = m_TilesX * m_TilesY;
+		std::vector<uint32_t>* bins = &m_Bins[(size_t)p_Chunk * tileCount];
+		for (uint32_t tile = 0; tile < tileCount; tile++)
+			bins[tile].clear();
+
+		uint32_t begin = p_Chunk * TrianglesPerChunk;
+		uint32_t end = std::min(begin + TrianglesPerChunk, p_TriangleCount);
+		for (uint32_t index = begin; index < end; index++)
+		{
+			const uint32_t* indices = p_Indices + (size_t)index * 3;
+			if (indices[0] >= p_VertexCount || indices[1] >= p_VertexCount || indices[2] >= p_VertexCount)
+				continue;
+
+			const SoftwareVertex* vertices[3] = { &p_Vertices[indices[0]], &p_Vertices[indices[1]], &p_Vertices[indices[2]] };
+			if (vertices[0]->Clipped || vertices[1]->Clipped || vertices[2]->Clipped)
+				continue;
+
+			// Edge i runs between the other two vertices.
+			Triangle& triangle = m_Triangles[index];
+			for (uint32_t edge = 0; edge < 3; edge++)
+			{
+				const glm::vec3& a = vertices[(edge + 1) % 3]->Position;
+				const glm::vec3& b = vertices[(edge + 2) % 3]->Position;
+				triangle.A[edge] = a.y - b.y;
+				triangle.B[edge] = b.x - a.x;
+				triangle.C[edge] = a.x * b.y - a.y * b.x;
+			}
+
+			// Twice the signed area, both windings are drawn like the OpenGL renderer.
+			const glm::vec3& first = vertices[0]->Position;
+			float area = triangle.A[0] * first.x + triangle.B[0] * first.y + triangle.C[0];
+			if (!(std::fabs(area) > 0.0f))
+				continue; // Degenerate
+			if (area < 0.0f)
+			{
+				for (uint32_t edge = 0; edge < 3; edge++)
+				{
+					triangle.A[edge] = -triangle.A[edge];
+					triangle.B[edge] = -triangle.B[edge];
+					triangle.C[edge] = -triangle.C[edge];
+				}
+				area = -area;
+			}
+			triangle.InverseArea = 1.0f / area;
+
+			// Left edges and top edges own the pixels centered on them.
+			for (uint32_t edge = 0; edge < 3; edge++)
+				triangle.Inclusive[edge] = triangle.A[edge] > 0.0f || (triangle.A[edge] == 0.0f && triangle.B[edge] < 0.0f);
+
+			for (uint32_t vertex = 0; vertex < 3; vertex++)
+			{
+				triangle.Z[vertex] = vertices[vertex]->Position.z;
+				triangle.Color[vertex] = vertices[vertex]->Color;
+				triangle.TexCoord[vertex] = vertices[vertex]->TexCoord;
+			}
+			triangle.TexIndex = std::min(vertices[0]->TexIndex, MaxSamplers - 1);
+
+			float minX = std::min({ vertices[0]->Position.x, vertices[1]->Position.x, vertices[2]->Position.x });
+			float minY = std::min({ vertices[0]->Position.y, vertices[1]->Position.y, vertices[2]->Position.y });
+			float maxX = std::max({ vertices[0]->Position.x, vertices[1]->Position.x, vertices[2]->Position.x });
+			float maxY = std::max({ vertices[0]->Position.y, vertices[1]->Position.y, vertices[2]->Position.y });
+			triangle.MinX = (int32_t)floorf(glm::clamp(minX, 0.0f, (float)m_Width));
+			triangle.MinY = (int32_t)floorf(glm::clamp(minY, 0.0f, (float)m_Height));
+			triangle.MaxX = (int32_t)ceilf(glm::clamp(maxX, 0.0f, (float)m_Width));
+			triangle.MaxY = (int32_t)ceilf(glm::clamp(maxY, 0.0f, (float)m_Height));
+			if (triangle.MinX >= triangle.MaxX || triangle.MinY >= triangle.MaxY)
+				continue; // Off screen
+
+			uint32_t tileMinX = triangle.MinX / TileSize, tileMaxX = (triangle.MaxX - 1) / TileSize;
+			uint32_t tileMinY = triangle.MinY / TileSize, tileMaxY = (triangle.MaxY - 1) / TileSize;
+			for (uint32_t tileY = tileMinY; tileY <= tileMaxY; tileY++)
+				for (uint32_t tileX = tileMinX; tileX <= tileMaxX; tileX++)
+					bins[tileY * m_TilesX + tileX].push_back(index);
+		}
+	}
+
+	/**
+	 * @brief Rasterizes every triangle binned into a tile, in the
+	 * order they were drawn.
+	 * @param p_Tile The tile.
+	 * @param p_ChunkCount The number of chunks in the draw.
+	 * @param p_Samplers The bound textures.
+	 */
+	void SoftwareRasterizer::RasterizeTile(uint32_t p_Tile, uint32_t p_ChunkCount, const SoftwareSampler* p_Samplers)
+	{
+		VT_PROFILE_VERBOSE_FUNCTION();
+
+		uint32_t tileCount = m_TilesX * m_TilesY;
+		int32_t tileX = (int32_t)((p_Tile % m_TilesX) * TileSize);
+		int32_t tileY = (int32_t)((p_Tile / m_TilesX) * TileSize);
+
+		for (uint32_t chunk = 0; chunk < p_ChunkCount; chunk++)
+			for (uint32_t index : m_Bins[(size_t)chunk * tileCount + p_Tile])
+				RasterizeTriangle(m_Triangles[index], tileX, tileY, p_Samplers);
+	}
+
+	/**
+	 * @brief Rasterizes the part of a triangle inside a tile. The
+	 * edge functions, depth test and depth writes run on four
+	 * pixels at once, only covered pixels are shaded.
+	 * @param p_Triangle The triangle.
+	 * @param p_TileX The left of the tile.
+	 * @param p_TileY The bottom of the tile.
+	 * @param p_Samplers The bound textures.
+	 */
+	void SoftwareRasterizer::RasterizeTriangle(const Triangle& p_Triangle, int32_t p_TileX, int32_t p_TileY, const SoftwareSampler* p_Samplers)
+	{
+		// Tiles start on a multiple of four, so aligning down stays inside the tile.
+		int32_t minX = std::max(p_Triangle.MinX, p_TileX) & ~3;
+		int32_t maxX = std::min(p_Triangle.MaxX, p_TileX + (int32_t)TileSize);
+		int32_t minY = std::max(p_Triangle.MinY, p_TileY);
+		int32_t maxY = std::min(p_Triangle.MaxY, p_TileY + (int32_t)TileSize);
+		if (minX >= maxX || minY >= maxY)
+			return;
+
+		const SoftwareSampler& sampler = p_Samplers[p_Triangle.TexIndex];
+
+		const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+		const __m128i laneIndices = _mm_setr_epi32(0, 1, 2, 3);
+		const __m128i laneEnd = _mm_set1_epi32(maxX);
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 inverseArea = _mm_set1_ps(p_Triangle.InverseArea);
+
+		__m128 a[3], z[3];
+		for (uint32_t edge = 0; edge < 3; edge++)
+		{
+			a[edge] = _mm_set1_ps(p_Triangle.A[edge]);
+			z[edge] = _mm_set1_ps(p_Triangle.Z[edge]);
+		}
+
+		alignas(16) float weights[3][4];
+		for (int32_t y = minY; y < maxY; y++)
+		{
+			float pixelY = (float)y + 0.5f;
+			__m128 row[3];
+			for (uint32_t edge = 0; edge < 3; edge++)
+				row[edge] = _mm_set1_ps(p_Triangle.B[edge] * pixelY + p_Triangle.C[edge]);
+
+			uint32_t* colorRow = &m_Color[(size_t)y * m_Stride];
+			float* depthRow = &m_Depth[(size_t)y * m_Stride];
+			for (int32_t x = minX; x < maxX; x += 4)
+			{
+				__m128 pixelX = _mm_add_ps(_mm_set1_ps((float)x), laneOffsets);
+				__m128 mask = _mm_castsi128_ps(_mm_cmplt_epi32(_mm_add_epi32(_mm_set1_epi32(x), laneIndices), laneEnd));
+
+				__m128 e[3];
+				for (uint32_t edge = 0; edge < 3; edge++)
+				{
+					e[edge] = _mm_add_ps(_mm_mul_ps(a[edge], pixelX), row[edge]);
+					mask = _mm_and_ps(mask, p_Triangle.Inclusive[edge] ? _mm_cmpge_ps(e[edge], zero) : _mm_cmpgt_ps(e[edge], zero));
+				}
+				if (!_mm_movemask_ps(mask))
+					continue;
+
+				__m128 w0 = _mm_mul_ps(e[0], inverseArea);
+				__m128 w1 = _mm_mul_ps(e[1], inverseArea);
+				__m128 w2 = _mm_mul_ps(e[2], inverseArea);
+
+				// Depth test less, passing pixels write their depth.
+				__m128 depth = _mm_add_ps(_mm_add_ps(_mm_mul_ps(w0, z[0]), _mm_mul_ps(w1, z[1])), _mm_mul_ps(w2, z[2]));
+				__m128 previous = _mm_loadu_ps(depthRow + x);
+				mask = _mm_and_ps(mask, _mm_cmplt_ps(depth, previous));
+				int covered = _mm_movemask_ps(mask);
+				if (!covered)
+					continue;
+				_mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(mask, depth), _mm_andnot_ps(mask, previous)));
+
+				_mm_store_ps(weights[0], w0);
+				_mm_store_ps(weights[1], w1);
+				_mm_store_ps(weights[2], w2);
+				for (int lane = 0; lane < 4; lane++)
+				{
+					if (!(covered & (1 << lane)))
+						continue;
+
+					float b0 = weights[0][lane], b1 = weights[1][lane], b2 = weights[2][lane];
+					glm::vec4 color = p_Triangle.Color[0] * b0 + p_Triangle.Color[1] * b1 + p_Triangle.Color[2] * b2;
+					glm::vec2 texCoord = p_Triangle.TexCoord[0] * b0 + p_Triangle.TexCoord[1] * b1 + p_Triangle.TexCoord[2] * b2;
+					color *= Sample(sampler, texCoord);
+
+					// Blend src alpha, one minus src alpha.
+					uint32_t& destination = colorRow[x + lane];
+					destination = PackColor(color * color.a + UnpackColor(destination) * (1.0f - color.a));
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
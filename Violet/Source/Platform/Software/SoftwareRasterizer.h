@@ -0,0 +1,101 @@
+/////////////////
+///
+/// SoftwareRasterizer.h
+/// Violet McAllister
+/// August 5th, 2022
+///
+/// A tiled triangle rasterizer. Triangles are set
+/// up and binned into screen tiles in parallel,
+/// then every tile is rasterized by one job with
+/// SSE edge functions, four pixels at a time.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_SOFTWARE_RASTERIZER_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_SOFTWARE_RASTERIZER_H_INCLUDED__
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Violet/Core/Base.h"
+
+namespace Violet
+{
+	/**
+	 * @brief A vertex after the vertex stage, in framebuffer pixels
+	 * with the depth in [0, 1].
+	 */
+	struct SoftwareVertex
+	{
+		glm::vec3 Position;
+		glm::vec4 Color;
+		glm::vec2 TexCoord; // Already multiplied by the tiling factor.
+		uint32_t TexIndex;
+		bool Clipped;       // Behind the camera, triangles using it are dropped.
+	};
+
+	/**
+	 * @brief An RGBA8 texture the rasterizer samples with nearest
+	 * filtering and repeat wrapping. No pixels samples as white.
+	 */
+	struct SoftwareSampler
+	{
+		const uint32_t* Pixels = nullptr;
+		uint32_t Width = 0, Height = 0;
+	};
+
+	/**
+	 * @brief Rasterizes triangles into an RGBA8 color buffer and a
+	 * float depth buffer. Draws blend with src alpha, one minus
+	 * src alpha and test depth with less, like the OpenGL renderer.
+	 */
+	class SoftwareRasterizer
+	{
+	public: // Constants
+		static constexpr uint32_t TileSize = 64;
+		static constexpr uint32_t TrianglesPerChunk = 2048;
+		static constexpr uint32_t MaxSamplers = 32;
+	public: // Main Functionality
+		void Resize(uint32_t p_Width, uint32_t p_Height);
+		void Clear(const glm::vec4& p_Color);
+		void DrawTriangles(const SoftwareVertex* p_Vertices, uint32_t p_VertexCount, const uint32_t* p_Indices, uint32_t p_IndexCount, const SoftwareSampler* p_Samplers);
+		void ReadPixels(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height, uint32_t* p_Pixels) const;
+	public: // Getters
+		uint32_t GetWidth() const { return m_Width; }
+		uint32_t GetHeight() const { return m_Height; }
+	private: // Triangle
+		/**
+		 * @brief A set up triangle. Edge function i is positive inside
+		 * the triangle and weights vertex i.
+		 */
+		struct Triangle
+		{
+			float A[3], B[3], C[3];
+			bool Inclusive[3]; // Top-left rule, pixels exactly on the edge belong to it.
+			float InverseArea;
+			float Z[3];
+			glm::vec4 Color[3];
+			glm::vec2 TexCoord[3];
+			uint32_t TexIndex;
+			int32_t MinX, MinY, MaxX, MaxY; // Pixel bounds, max exclusive.
+		};
+	private: // Helpers
+		void SetupChunk(uint32_t p_Chunk, const SoftwareVertex* p_Vertices, uint32_t p_VertexCount, const uint32_t* p_Indices, uint32_t p_TriangleCount);
+		void RasterizeTile(uint32_t p_Tile, uint32_t p_ChunkCount, const SoftwareSampler* p_Samplers);
+		void RasterizeTriangle(const Triangle& p_Triangle, int32_t p_TileX, int32_t p_TileY, const SoftwareSampler* p_Samplers);
+	private: // Private Member Variables
+		uint32_t m_Width = 0, m_Height = 0;
+		uint32_t m_Stride = 0; // Rows are padded to whole tiles, so tiles never share memory.
+		uint32_t m_TilesX = 0, m_TilesY = 0;
+
+		std::vector<uint32_t> m_Color;
+		std::vector<float> m_Depth;
+
+		std::vector<Triangle> m_Triangles;
+		// Indexed [chunk * tile count + tile], tiles read the chunks in order to keep the draw order.
+		std::vector<std::vector<uint32_t>> m_Bins;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_SOFTWARE_RASTERIZER_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,218 @@
+/////////////////
+///
+/// SoftwareRendererAPI.cpp
+/// Violet McAllister
+/// August 5th, 2022
+/// Updated: August 6th, 2022
+///
+/// A RendererAPI drawing on the CPU, for machines
+/// without a GPU. Vertices are transformed in
+/// parallel and the triangles handed to the
+/// tiled SoftwareRasterizer.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/Software/SoftwareRendererAPI.h"
+
+#include "Platform/Null/NullBuffer.h"
+#include "Platform/Software/SoftwareShader.h"
+#include "Platform/Software/SoftwareTexture.h"
+
+#include "Violet/Core/JobSystem.h"
+
+namespace Violet
+{
+	const SoftwareTexture2D* SoftwareRendererAPI::s_TextureSlots[SoftwareRasterizer::MaxSamplers] = {};
+	const SoftwareShader* SoftwareRendererAPI::s_Shader = nullptr;
+
+	/**
+	 * @brief Finds the offset of a vertex attribute.
+	 * @param p_Layout The vertex buffer layout.
+	 * @param p_Name The name of the attribute.
+	 * @returns The offset, or -1 if the layout does not have it.
+	 */
+	static int64_t FindAttribute(const BufferLayout& p_Layout, const char* p_Name)
+	{
+		for (const BufferElement& element : p_Layout)
+		{
+			if (element.Name == p_Name)
+				return (int64_t)element.Offset;
+		}
+
+		return -1;
+	}
+
+	/**
+	 * @brief Initializes the software renderer.
+	 */
+	void SoftwareRendererAPI::Init()
+	{
+		VT_PROFILE_FUNCTION();
+	}
+
+	/**
+	 * @brief Sets the viewport, growing the framebuffer to fit it.
+	 * @param p_X The x position of the view port.
+	 * @param p_Y The y position of the view port.
+	 * @param p_Width The width of the view port.
+	 * @param p_Height The height of the view port.
+	 */
+	void SoftwareRendererAPI::SetViewport(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height)
+	{
+		m_ViewportX = p_X;
+		m_ViewportY = p_Y;
+		m_ViewportWidth = p_Width;
+		m_ViewportHeight = p_Height;
+		m_Rasterizer.Resize(p_X + p_Width, p_Y + p_Height);
+	}
+
+	/**
+	 * @brief Sets the color Clear clears to.
+	 * @param p_Color The clear color.
+	 */
+	void SoftwareRendererAPI::SetClearColor(const glm::vec4& p_Color)
+	{
+		m_ClearColor = p_Color;
+	}
+
+	/**
+	 * @brief Clears the color and depth buffers.
+	 */
+	void SoftwareRendererAPI::Clear()
+	{
+		m_Rasterizer.Clear(m_ClearColor);
+	}
+
+	/**
+	 * @brief Runs the vertex stage on the vertex array and
+	 * rasterizes its triangles with the bound textures.
+	 * @param p_VertexArray The vertex array being drawn.
+	 * @param p_IndexCount The number of indices, all of them if 0.
+	 */
+	void SoftwareRendererAPI::DrawIndexed(const Ref<VertexArray>& p_VertexArray, uint32_t p_IndexCount)
+	{
+		VT_PROFILE_FUNCTION();
+
+		VT_CORE_ASSERT(s_Shader, "No Shader Is Bound!");
+		VT_CORE_ASSERT(!p_VertexArray->GetVertexBuffers().empty(), "Vertex Array Has No Vertex Buffer!");
+
+		const NullIndexBuffer& indexBuffer = static_cast<const NullIndexBuffer&>(*p_VertexArray->GetIndexBuffer());
+		const NullVertexBuffer& vertexBuffer = static_cast<const NullVertexBuffer&>(*p_VertexArray->GetVertexBuffers()[0]);
+		uint32_t count = std::min(p_IndexCount ? p_IndexCount : indexBuffer.GetCount(), indexBuffer.GetCount());
+
+		const BufferLayout& layout = vertexBuffer.GetLayout();
+		int64_t positionOffset = FindAttribute(layout, "a_Position");
+		int64_t colorOffset = FindAttribute(layout, "a_Color");
+		int64_t texCoordOffset = FindAttribute(layout, "a_TexCoord");
+		int64_t texIndexOffset = FindAttribute(layout, "a_TexIndex");
+		int64_t tilingFactorOffset = FindAttribute(layout, "a_TilingFactor");
+		VT_CORE_ASSERT(positionOffset >= 0, "Vertex Layout Has No a_Position!");
+
+		uint32_t stride = layout.GetStride();
+		uint32_t vertexCount = vertexBuffer.GetDataSize() / stride;
+		if (m_Vertices.size() < vertexCount)
+			m_Vertices.resize(vertexCount);
+
+		glm::mat4 transform = s_Shader->GetMat4("u_ViewProjection") * s_Shader->GetMat4("u_Transform");
+		glm::vec2 viewportOffset = { (float)m_ViewportX, (float)m_ViewportY };
+		glm::vec2 viewportHalfSize = { m_ViewportWidth * 0.5f, m_ViewportHeight * 0.5f };
+
+		// Vertex stage, Texture.glsl with the viewport transform.
+		const uint8_t* data = vertexBuffer.GetData();
+		JobSystem::ParallelFor("SoftwareRendererAPI Vertices", vertexCount, 4096, [&](uint32_t p_Index)
+		{
+			const uint8_t* source = data + (size_t)p_Index * stride;
+			SoftwareVertex& vertex = m_Vertices[p_Index];
+
+			glm::vec3 position;
+			memcpy(&position, source + positionOffset, sizeof(glm::vec3));
+			glm::vec4 clip = transform * glm::vec4(position, 1.0f);
+			vertex.Clipped = !(clip.w > 0.0f);
+			glm::vec3 ndc = glm::vec3(clip) / clip.w;
+			vertex.Position = glm::vec3(viewportOffset + (glm::vec2(ndc) + 1.0f) * viewportHalfSize, ndc.z * 0.5f + 0.5f);
+
+			vertex.Color = glm::vec4(1.0f);
+			if (colorOffset >= 0)
+				memcpy(&vertex.Color, source + colorOffset, sizeof(glm::vec4));
+
+			vertex.TexCoord = glm::vec2(0.0f);
+			if (texCoordOffset >= 0)
+				memcpy(&vertex.TexCoord, source + texCoordOffset, sizeof(glm::vec2));
+
+			float texIndex = 0.0f, tilingFactor = 1.0f;
+			if (texIndexOffset >= 0)
+				memcpy(&texIndex, source + texIndexOffset, sizeof(float));
+			if (tilingFactorOffset >= 0)
+				memcpy(&tilingFactor, source + tilingFactorOffset, sizeof(float));
+			vertex.TexIndex = texIndex > 0.0f ? (uint32_t)texIndex : 0;
+			vertex.TexCoord *= tilingFactor;
+		});
+
+		SoftwareSampler samplers[SoftwareRasterizer::MaxSamplers];
+		for (uint32_t slot = 0; slot < SoftwareRasterizer::MaxSamplers; slot++)
+		{
+			if (const SoftwareTexture2D* texture = s_TextureSlots[slot])
+				samplers[slot] = { texture->GetPixels(), texture->GetWidth(), texture->GetHeight() };
+		}
+
+		m_Rasterizer.DrawTriangles(m_Vertices.data(), vertexCount, indexBuffer.GetIndices(), count, samplers);
+	}
+
+	/**
+	 * @brief Copies pixels out of the color buffer.
+	 * @param p_X The left of the rectangle.
+	 * @param p_Y The bottom of the rectangle.
+	 * @param p_Width The width of the rectangle.
+	 * @param p_Height The height of the rectangle.
+	 * @param p_Pixels The RGBA8 pixels, bottom row first.
+	 */
+	void SoftwareRendererAPI::ReadPixels(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height, uint32_t* p_Pixels)
+	{
+		m_Rasterizer.ReadPixels(p_X, p_Y, p_Width, p_Height, p_Pixels);
+	}
+
+	/**
+	 * @brief Binds a texture to a slot.
+	 * @param p_Slot The texture slot.
+	 * @param p_Texture The texture.
+	 */
+	void SoftwareRendererAPI::BindTexture(uint32_t p_Slot, const SoftwareTexture2D* p_Texture)
+	{
+		VT_CORE_ASSERT(p_Slot < SoftwareRasterizer::MaxSamplers, "Texture Slot Out Of Range!");
+		s_TextureSlots[p_Slot] = p_Texture;
+	}
+
+	/**
+	 * @brief Unbinds a texture from every slot holding it.
+	 * @param p_Texture The texture.
+	 */
+	void SoftwareRendererAPI::UnbindTexture(const SoftwareTexture2D* p_Texture)
+	{
+		for (const SoftwareTexture2D*& slot : s_TextureSlots)
+		{
+			if (slot == p_Texture)
+				slot = nullptr;
+		}
+	}
+
+	/**
+	 * @brief Binds the shader draws take their matrices from.
+	 * @param p_Shader The shader.
+	 */
+	void SoftwareRendererAPI::BindShader(const SoftwareShader* p_Shader)
+	{
+		s_Shader = p_Shader;
+	}
+
+	/**
+	 * @brief Unbinds a shader if it is bound.
+	 * @param p_Shader The shader.
+	 */
+	void SoftwareRendererAPI::UnbindShader(const SoftwareShader* p_Shader)
+	{
+		if (s_Shader == p_Shader)
+			s_Shader = nullptr;
+	}
+}
\ No newline at end of file
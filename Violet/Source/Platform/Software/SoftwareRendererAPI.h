@@ -0,0 +1,60 @@
+/////////////////
+///
+/// SoftwareRendererAPI.h
+/// Violet McAllister
+/// August 5th, 2022
+///
+/// A RendererAPI drawing on the CPU, for machines
+/// without a GPU. Vertices are transformed in
+/// parallel and the triangles handed to the
+/// tiled SoftwareRasterizer.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_SOFTWARE_RENDERER_API_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_SOFTWARE_RENDERER_API_H_INCLUDED__
+
+#include "Platform/Software/SoftwareRasterizer.h"
+
+#include "Violet/Renderer/RendererAPI.h"
+
+namespace Violet
+{
+	class SoftwareShader;
+	class SoftwareTexture2D;
+
+	/**
+	 * @brief Software implementation of a RendererAPI. Draws the
+	 * vertex layout of Texture.glsl: a_Position, a_Color,
+	 * a_TexCoord, a_TexIndex and a_TilingFactor, transformed by
+	 * the u_ViewProjection and u_Transform of the bound shader.
+	 */
+	class SoftwareRendererAPI : public RendererAPI
+	{
+	public: // Initializer
+		virtual void Init() override;
+	public: // Main Functionality
+		virtual void SetViewport(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height) override;
+		virtual void SetClearColor(const glm::vec4& p_Color) override;
+		virtual void Clear() override;
+		virtual void DrawIndexed(const Ref<VertexArray>& p_VertexArray, uint32_t p_IndexCount = 0) override;
+		virtual void ReadPixels(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height, uint32_t* p_Pixels) override;
+	public: // Bindings
+		static void BindTexture(uint32_t p_Slot, const SoftwareTexture2D* p_Texture);
+		static void UnbindTexture(const SoftwareTexture2D* p_Texture);
+		static void BindShader(const SoftwareShader* p_Shader);
+		static void UnbindShader(const SoftwareShader* p_Shader);
+	private: // Private Member Variables
+		SoftwareRasterizer m_Rasterizer;
+		std::vector<SoftwareVertex> m_Vertices;
+		glm::vec4 m_ClearColor = glm::vec4(0.0f);
+		uint32_t m_ViewportX = 0, m_ViewportY = 0;
+		uint32_t m_ViewportWidth = 0, m_ViewportHeight = 0;
+	private: // Private Static Member Variables
+		// Bindings are global state, like they are in OpenGL.
+		static const SoftwareTexture2D* s_TextureSlots[SoftwareRasterizer::MaxSamplers];
+		static const SoftwareShader* s_Shader;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_SOFTWARE_RENDERER_API_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,37 @@
+/////////////////
+///
+/// SoftwareShader.cpp
+/// Violet McAllister
+/// August 5th, 2022
+///
+/// The Shader of the software renderer. The
+/// programs themselves are not run, the
+/// rasterizer implements Texture.glsl and reads
+/// the matrices from the bound shader.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/Software/SoftwareShader.h"
+
+#include "Platform/Software/SoftwareRendererAPI.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Unbinds the shader if it is still bound.
+	 */
+	SoftwareShader::~SoftwareShader()
+	{
+		SoftwareRendererAPI::UnbindShader(this);
+	}
+
+	/**
+	 * @brief Makes the shader the one the rasterizer draws with.
+	 */
+	void SoftwareShader::Bind() const
+	{
+		SoftwareRendererAPI::BindShader(this);
+	}
+}
\ No newline at end of file
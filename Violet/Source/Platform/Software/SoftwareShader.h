@@ -0,0 +1,34 @@
+/////////////////
+///
+/// SoftwareShader.h
+/// Violet McAllister
+/// August 5th, 2022
+///
+/// The Shader of the software renderer. The
+/// programs themselves are not run, the
+/// rasterizer implements Texture.glsl and reads
+/// the matrices from the bound shader.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_SOFTWARE_SHADER_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_SOFTWARE_SHADER_H_INCLUDED__
+
+#include "Platform/Null/NullShader.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Software Implementation of a Shader.
+	 */
+	class SoftwareShader : public NullShader
+	{
+	public: // Constructors & Deconstructors
+		using NullShader::NullShader;
+		virtual ~SoftwareShader();
+	public: // Main Functionality
+		virtual void Bind() const override;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_SOFTWARE_SHADER_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,38 @@
+/////////////////
+///
+/// SoftwareTexture.cpp
+/// Violet McAllister
+/// August 5th, 2022
+///
+/// The 2D Texture of the software renderer. The
+/// pixels live in CPU memory like the Null
+/// texture, binding one hands it to the
+/// rasterizer.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Platform/Software/SoftwareTexture.h"
+
+#include "Platform/Software/SoftwareRendererAPI.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Unbinds the texture from every slot still holding it.
+	 */
+	SoftwareTexture2D::~SoftwareTexture2D()
+	{
+		SoftwareRendererAPI::UnbindTexture(this);
+	}
+
+	/**
+	 * @brief Binds the texture to a slot of the rasterizer.
+	 * @param p_Slot The texture slot.
+	 */
+	void SoftwareTexture2D::Bind(uint32_t p_Slot) const
+	{
+		SoftwareRendererAPI::BindTexture(p_Slot, this);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+/////////////////
+///
+/// SoftwareTexture.h
+/// Violet McAllister
+/// August 5th, 2022
+///
+/// The 2D Texture of the software renderer. The
+/// pixels live in CPU memory like the Null
+/// texture, binding one hands it to the
+/// rasterizer.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_PLATFORM_SOFTWARE_TEXTURE_H_INCLUDED__
+#define __VIOLET_ENGINE_PLATFORM_SOFTWARE_TEXTURE_H_INCLUDED__
+
+#include "Platform/Null/NullTexture.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Software Implementation of a 2D Texture object.
+	 */
+	class SoftwareTexture2D : public NullTexture2D
+	{
+	public: // Constructors & Deconstructors
+		using NullTexture2D::NullTexture2D;
+		virtual ~SoftwareTexture2D();
+	public: // Main Functionality
+		virtual void Bind(uint32_t p_Slot = 0) const override;
+	};
+}
+
+#endif // __VIOLET_ENGINE_PLATFORM_SOFTWARE_TEXTURE_H_INCLUDED__
\ No newline at end of file
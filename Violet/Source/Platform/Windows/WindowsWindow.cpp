@@ -3,7 +3,7 @@
 /// WindowsWindow.h
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 15th, 2022
+/// Updated: July 30th, 2022
 ///
 /// Using the generalized Window class we create
 /// a WindowsWindow implementation for a Windows
@@ -44,6 +44,25 @@ namespace Violet
 		VT_CORE_ERROR("GLFW Error ({0}): {1}", p_Error, p_Description);
 	}
 
+	/**
+	 * @brief Queues an event when the window has an event queue,
+	 * otherwise dispatches it immediately.
+	 * @param p_Data The window data.
+	 * @param p_Arguments The arguments to the event constructor.
+	 */
+	template<typename T, typename... Args>
+	void WindowsWindow::SubmitEvent(WindowData& p_Data, Args&&... p_Arguments)
+	{
+		if (p_Data.Queue)
+		{
+			p_Data.Queue->Push<T>(std::forward<Args>(p_Arguments)...);
+			return;
+		}
+
+		T e(std::forward<Args>(p_Arguments)...);
+		p_Data.EventCallback(e);
+	}
+
 	/**
 	 * @brief Constructs a WindowsWindow object.
 	 * @param p_Properties The window properties (title, width, height).
@@ -108,7 +127,7 @@ namespace Violet
 		}
 		
 		// Create & Initialize Context
-		m_Context = CreateRef<OpenGLContext>(m_Window);
+		m_Context = CreateScope<OpenGLContext>(m_Window);
 		m_Context->Init();
 
 		// Sets a User Pointer containing data for the window, not modified by GLFW.
@@ -133,8 +152,7 @@ namespace Violet
 			data.Height = p_Height;
 
 			// Creates a Violet Event and sets it.
-			WindowResizeEvent e(p_Width, p_Height);
-			data.EventCallback(e);
+			SubmitEvent<WindowResizeEvent>(data, p_Width, p_Height);
 		});
 
 		/**
@@ -147,8 +165,7 @@ namespace Violet
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(p_Window);
 
 			// Creates a Violet Event and sets it.
-			WindowCloseEvent e;
-			data.EventCallback(e);
+			SubmitEvent<WindowCloseEvent>(data);
 		});
 
 		/**
@@ -170,22 +187,19 @@ namespace Violet
 				// KeyPressed Action
 				case GLFW_PRESS:
 				{
-					KeyPressedEvent e(static_cast<KeyCode>(p_Key), 0);
-					data.EventCallback(e);
+					SubmitEvent<KeyPressedEvent>(data, static_cast<KeyCode>(p_Key), 0);
 					break;
 				}
 				// KeyReleased Action
 				case GLFW_RELEASE:
 				{
-					KeyReleasedEvent e(static_cast<KeyCode>(p_Key));
-					data.EventCallback(e);
+					SubmitEvent<KeyReleasedEvent>(data, static_cast<KeyCode>(p_Key));
 					break;
 				}
 				// KeyPressed Repeat Action
 				case GLFW_REPEAT:
 				{
-					KeyPressedEvent e(static_cast<KeyCode>(p_Key), 1);
-					data.EventCallback(e);
+					SubmitEvent<KeyPressedEvent>(data, static_cast<KeyCode>(p_Key), 1);
 					break;
 				}
 			}
@@ -202,8 +216,7 @@ namespace Violet
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(p_Window);
 
 			// Creates a Violet Event and sets it.
-			KeyTypedEvent e(static_cast<KeyCode>(p_KeyCode));
-			data.EventCallback(e);
+			SubmitEvent<KeyTypedEvent>(data, static_cast<KeyCode>(p_KeyCode));
 		});
 
 		/**
@@ -224,15 +237,13 @@ namespace Violet
 				// MousePressed Action
 				case GLFW_PRESS:
 				{
-					MouseButtonPressedEvent e(static_cast<MouseCode>(p_Button));
-					data.EventCallback(e);
+					SubmitEvent<MouseButtonPressedEvent>(data, static_cast<MouseCode>(p_Button));
 					break;
 				}
 				// KeyReleased Action
 				case GLFW_RELEASE:
 				{
-					MouseButtonReleasedEvent e(static_cast<MouseCode>(p_Button));
-					data.EventCallback(e);
+					SubmitEvent<MouseButtonReleasedEvent>(data, static_cast<MouseCode>(p_Button));
 					break;
 				}
 			}
@@ -250,8 +261,7 @@ namespace Violet
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(p_Window);
 
 			// Creates a Violet Event and sets it.
-			MouseScrolledEvent e((float)p_XOffset, (float)p_YOffset);
-			data.EventCallback(e);
+			SubmitEvent<MouseScrolledEvent>(data, (float)p_XOffset, (float)p_YOffset);
 		});
 
 		/**
@@ -266,8 +276,7 @@ namespace Violet
 			WindowData& data = *(WindowData*)glfwGetWindowUserPointer(p_Window);
 
 			// Creates a Violet Event and sets it.
-			MouseMovedEvent e((float)p_XPos, (float)p_YPos);
-			data.EventCallback(e);
+			SubmitEvent<MouseMovedEvent>(data, (float)p_XPos, (float)p_YPos);
 		});
 	}
 
@@ -3,7 +3,7 @@
 /// WindowsWindow.h
 /// Violet McAllister
 /// July 1st, 2022
-/// Updated: July 11th, 2022
+/// Updated: July 30th, 2022
 ///
 /// Using the generalized Window class we create
 /// a WindowsWindow definition to specify the implementation
@@ -48,6 +48,13 @@ namespace Violet
 		 */
 		void SetEventCallback(const EventCallbackFunction& p_Callback) override { m_Data.EventCallback = p_Callback; }
 
+		/**
+		 * @brief Sets the queue events are buffered into. Without a
+		 * queue, events go straight to the event callback.
+		 * @param p_Queue The event queue.
+		 */
+		void SetEventQueue(EventQueue* p_Queue) override { m_Data.Queue = p_Queue; }
+
 		/**
 		 * @brief Gets the native window pointer.
 		 * @returns The native window pointer.
@@ -71,10 +78,14 @@ namespace Violet
 			unsigned int Width, Height;
 			bool VSync;
 			EventCallbackFunction EventCallback;
+			EventQueue* Queue = nullptr;
 		};
+	private: // Event Helper
+		template<typename T, typename... Args>
+		static void SubmitEvent(WindowData& p_Data, Args&&... p_Arguments);
 	private: // Private Member Variables
 		GLFWwindow* m_Window;
-		Ref<GraphicsContext> m_Context;
+		Scope<GraphicsContext> m_Context;
 		WindowData m_Data;
 	};
 }
@@ -3,7 +3,7 @@
 /// Violet.h
 /// Violet McAllister
 /// June 30th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Contains all of the include files for the
 /// Violet API.
@@ -20,6 +20,7 @@
 #include "Violet/Core/Layer.h"
 #include "Violet/Core/Log.h"
 #include "Violet/Core/MouseCodes.h"
+#include "Violet/Core/StartupSequence.h"
 #include "Violet/Core/Timestep.h"
 
 #include "Violet/ImGui/ImGuiLayer.h"
@@ -34,4 +35,8 @@
 #include "Violet/Renderer/Texture.h"
 #include "Violet/Renderer/VertexArray.h"
 
+#include "Violet/Scene/Components.h"
+#include "Violet/Scene/Entity.h"
+#include "Violet/Scene/Scene.h"
+
 #endif // _VIOLET_ENGINE_H_INCLUDED__
\ No newline at end of file
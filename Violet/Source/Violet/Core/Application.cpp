@@ -3,7 +3,7 @@
 /// Application.cpp
 /// Violet McAllister
 /// June 30th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Contains class implementations for the Application
 /// object.
@@ -12,12 +12,15 @@
 
 #include "vtpch.h"
 
-#include <GLFW/glfw3.h>
-
 #include "Violet/Core/Application.h"
 #include "Violet/Core/Input.h"
+#include "Violet/Core/JobSystem.h"
 #include "Violet/Core/Log.h"
+#include "Violet/Core/Time.h"
+#include "Violet/Debug/FastLog.h"
+#include "Violet/Memory/LinearAllocator.h"
 #include "Violet/Renderer/Renderer.h"
+#include "Violet/Renderer/Renderer2D.h"
 
 namespace Violet
 {
@@ -25,20 +28,47 @@ namespace Violet
 	Application* Application::s_Instance = nullptr;
 
 	/**
-	 * @brief Constructs an Application object.
+	 * @brief Constructs an Application object. Only declares the
+	 * startup stages, they run in Startup once the client has
+	 * pushed its layers.
+	 * @param p_Args The command line arguments.
 	 */
-	Application::Application()
+	Application::Application(ApplicationCommandLineArgs p_Args)
+		: m_CommandLineArgs(p_Args)
 	{
 		VT_PROFILE_FUNCTION();
 
 		VT_CORE_ASSERT(!s_Instance, "Application Already Exists!");
 		s_Instance = this;
 
-		m_Window = Window::Create();
-		m_Window->SetEventCallback(VT_BIND_EVENT_FN(Application::OnEvent));
-
 		// Initialize Violet Subsystems
-		Renderer::Init();
+		FrameAllocator::Init(1024 * 1024);
+		JobSystem::Init();
+
+		StartupStageID window = m_Startup.Add("Window", StartupThread::Main, [this]()
+		{
+			m_Window = Window::Create();
+			m_Window->SetEventCallback(EventCallback::Bind<&Application::OnEvent>(this));
+			m_Window->SetEventQueue(&m_EventQueue);
+			Input::Synchronize();
+		});
+		StartupStageID api = m_Startup.Add("Renderer API", StartupThread::Main, [this]()
+		{
+			Renderer::InitAPI();
+			// Windowless renderers have no default framebuffer size.
+			Renderer::OnWindowResize(m_Window->GetWidth(), m_Window->GetHeight());
+		}, { window });
+
+		// Present a cleared frame as soon as possible instead of a blank window.
+		StartupStageID firstFrame = m_Startup.Add("First Frame", StartupThread::Main, [this]()
+		{
+			RenderCommand::SetClearColor({ 0.1f, 0.1f, 0.1f, 1.0f });
+			RenderCommand::Clear();
+			m_Window->OnUpdate();
+		}, { api });
+
+		StartupStageID sources = m_Startup.Add("Renderer Sources", StartupThread::Worker, []() { Renderer2D::LoadSources(); });
+		m_Startup.Add("Renderer", StartupThread::Main, []() { Renderer2D::Init(); }, { firstFrame, sources });
 
 		// Create & Push ImGui Layer.
 		m_ImGuiLayer = new ImGuiLayer();
@@ -52,7 +82,9 @@ namespace Violet
 	{
 		VT_PROFILE_FUNCTION();
 
+		VT_PROFILE_DISABLE_FLIGHT_RECORDER();
 		Renderer::Shutdown();
+		JobSystem::Shutdown();
 	}
 
 	/**
@@ -64,7 +96,7 @@ namespace Violet
 		VT_PROFILE_FUNCTION();
 
 		m_LayerStack.PushLayer(p_Layer);
-		p_Layer->OnAttach();
+		StartLayer(p_Layer);
 	}
 
 	/**
@@ -76,7 +108,59 @@ namespace Violet
 		VT_PROFILE_FUNCTION();
 
 		m_LayerStack.PushOverlay(p_Overlay);
-		p_Overlay->OnAttach();
+		StartLayer(p_Overlay);
+	}
+
+	/**
+	 * @brief Runs the startup sequence, then attaches every layer
+	 * pushed so far in the order they were pushed.
+	 */
+	void Application::Startup()
+	{
+		VT_PROFILE_FUNCTION();
+
+		m_Startup.Run();
+
+		for (Layer* layer : m_PendingAttach)
+			layer->OnAttach();
+		m_PendingAttach.clear();
+		m_Started = true;
+
+		// The first frame is timed from here, not from before startup.
+		m_LastFrameTime = Time::GetNanoseconds();
+
+		// Keeping the last frames of profile events times every scope, so it is opt in.
+		if (m_CommandLineArgs.Contains("--flight-recorder"))
+		{
+			VT_PROFILE_ENABLE_FLIGHT_RECORDER(FlightRecorderSettings());
+		}
+
+		// Replays drive the layers from the first frame and close once done, for repeatable runs.
+		if (const char* replay = m_CommandLineArgs.GetValue("--replay"))
+			StartInputPlayback(replay, true);
+		else if (const char* record = m_CommandLineArgs.GetValue("--record"))
+			StartInputRecording(record);
+	}
+
+	/**
+	 * @brief Adds the startup stages of a layer. Before Startup they
+	 * join the application sequence, afterwards the layer runs its
+	 * own and attaches right away.
+	 * @param p_Layer The layer which was pushed.
+	 */
+	void Application::StartLayer(Layer* p_Layer)
+	{
+		if (!m_Started)
+		{
+			p_Layer->OnStartup(m_Startup);
+			m_PendingAttach.push_back(p_Layer);
+			return;
+		}
+
+		StartupSequence sequence;
+		p_Layer->OnStartup(sequence);
+		sequence.Run();
+		p_Layer->OnAttach();
 	}
 
 	/**
@@ -88,6 +172,52 @@ namespace Violet
 		m_Running = false;
 	}
 
+	/**
+	 * @brief Starts writing the input of every frame to a file.
+	 * @param p_Filepath The path of the recording.
+	 * @returns Whether the recording started.
+	 */
+	bool Application::StartInputRecording(const std::string& p_Filepath)
+	{
+		VT_CORE_ASSERT(!m_InputPlayback.IsPlaying(), "Cannot Record Input During Playback!");
+		return m_InputRecorder.Begin(p_Filepath);
+	}
+
+	/**
+	 * @brief Stops the input recording.
+	 */
+	void Application::StopInputRecording()
+	{
+		m_InputRecorder.End();
+	}
+
+	/**
+	 * @brief Replaces live input with a recording, frames use the
+	 * recorded timesteps instead of the clock.
+	 * @param p_Filepath The path of the recording.
+	 * @param p_CloseWhenFinished Whether to close the application
+	 * after the last frame.
+	 * @returns Whether the playback started.
+	 */
+	bool Application::StartInputPlayback(const std::string& p_Filepath, bool p_CloseWhenFinished)
+	{
+		StopInputRecording();
+		m_CloseAfterPlayback = p_CloseWhenFinished;
+		return m_InputPlayback.Begin(p_Filepath);
+	}
+
+	/**
+	 * @brief Stops the playback and returns to live input.
+	 */
+	void Application::StopInputPlayback()
+	{
+		if (!m_InputPlayback.IsPlaying())
+			return;
+
+		m_InputPlayback.End();
+		Input::Synchronize();
+	}
+
 	/**
 	 * @brief Runs when an event is triggered.
 	 * @param p_Event The event being triggered.
@@ -95,18 +225,17 @@ namespace Violet
 	void Application::OnEvent(Event& p_Event)
 	{
 		VT_PROFILE_FUNCTION();
+		VT_LOG_FAST("Event {0}", p_Event.GetName());
+
+		// The input snapshot sees every event, even ones a layer handles.
+		Input::OnEvent(p_Event);
+		m_InputRecorder.RecordEvent(p_Event);
 
 		EventDispatcher dispatcher(p_Event);
-		dispatcher.Dispatch<WindowCloseEvent>(VT_BIND_EVENT_FN(Application::OnWindowClose));
-		dispatcher.Dispatch<WindowResizeEvent>(VT_BIND_EVENT_FN(Application::OnWindowResize));
+		dispatcher.Dispatch<&Application::OnWindowClose>(this);
+		dispatcher.Dispatch<&Application::OnWindowResize>(this);
 
-		// Loop through the LayerStack and look for OnEvent functions.
-		for (auto it = m_LayerStack.rbegin(); it != m_LayerStack.rend(); ++it)
-		{
-			if (p_Event.Handled)
-				break;
-			(*it)->OnEvent(p_Event);
-		}
+		m_LayerStack.OnEvent(p_Event);
 	}
 
 	/**
@@ -118,16 +247,46 @@ namespace Violet
 
 		while (m_Running)
 		{
-			VT_PROFILE_SCOPE("RunLoop");
+			VT_PROFILE_FRAME("RunLoop");
+
+			// Memory from the frame before last is released here.
+			FrameAllocator::NewFrame();
+
+			// Events polled at the end of the last frame are handled here.
+			{
+				VT_PROFILE_SCOPE("Dispatch Events");
+
+				// Live input is ignored while a recording plays back.
+				m_EventQueue.Dispatch([this](Event& p_Event)
+				{
+					if (!m_InputPlayback.IsPlaying() || !p_Event.IsInCategory(EventCategoryInput))
+						OnEvent(p_Event);
+				});
+			}
 
 			// Delta Time
-			float time = (float)glfwGetTime();
-			Timestep timestep = time - m_LastFrameTime;
+			uint64_t time = Time::GetNanoseconds();
+			Timestep timestep = (float)((time - m_LastFrameTime) * 1e-9);
 			m_LastFrameTime = time;
 
+			if (m_InputPlayback.IsPlaying() && !m_InputPlayback.NextFrame(EventCallback::Bind<&Application::OnEvent>(this), timestep))
+			{
+				VT_CORE_INFO("Input Playback Finished After {0} Frames.", m_InputPlayback.GetFrame());
+				StopInputPlayback();
+				if (m_CloseAfterPlayback)
+					Close();
+			}
+			m_InputRecorder.EndFrame(timestep);
+
 			// Update Layers
 			if (!m_Minimized)
 			{
+				if (m_FixedTimestep.Enabled)
+				{
+					RunFixedUpdates(timestep);
+					timestep = Timestep(timestep, m_InterpolationAlpha);
+				}
+
 				{
 					VT_PROFILE_SCOPE("LayerStack OnUpdate");
 
@@ -146,10 +305,45 @@ namespace Violet
 				m_ImGuiLayer->End();
 			}
 
+			Renderer::EndFrame();
+			AllocationTracker::EndFrame();
+
+			// Events polled from here on belong to the next frame.
+			Input::NewFrame();
 			m_Window->OnUpdate();
 		}
 	}
 
+	/**
+	 * @brief Runs as many fixed simulation ticks as the elapsed time
+	 * covers, within the catch-up budget, and updates the
+	 * interpolation alpha for rendering.
+	 * @param p_Timestep The duration of the frame.
+	 */
+	void Application::RunFixedUpdates(Timestep p_Timestep)
+	{
+		VT_PROFILE_SCOPE("LayerStack OnFixedUpdate");
+
+		double step = m_FixedTimestep.StepSeconds;
+		m_FixedAccumulator += p_Timestep.GetSeconds();
+
+		uint32_t steps = 0;
+		while (m_FixedAccumulator >= step && steps < m_FixedTimestep.MaxStepsPerFrame)
+		{
+			for (Layer* layer : m_LayerStack)
+				layer->OnFixedUpdate((float)step);
+
+			m_FixedAccumulator -= step;
+			steps++;
+		}
+
+		// Out of budget, the simulation falls behind instead of stalling every frame after.
+		if (m_FixedAccumulator >= step)
+			m_FixedAccumulator = fmod(m_FixedAccumulator, step);
+
+		m_InterpolationAlpha = (float)(m_FixedAccumulator / step);
+	}
+
 	/**
 	 * @brief Runs when the window close event is triggered.
 	 * @param p_Event The window close event information.
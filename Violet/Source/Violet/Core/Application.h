@@ -3,7 +3,7 @@
 /// Application.h
 /// Violet McAllister
 /// June 30th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Contains class information for the application
 /// interfacing between a Violet Engine Application
@@ -17,46 +17,147 @@
 #ifndef __VIOLET_ENGINE_CORE_APPLICATION_H_INCLUDED__
 #define __VIOLET_ENGINE_CORE_APPLICATION_H_INCLUDED__
 
+#include <cstring>
+
 #include "Violet/Core/Base.h"
+#include "Violet/Core/InputRecording.h"
 #include "Violet/Core/Layer.h"
 #include "Violet/Core/LayerStack.h"
+#include "Violet/Core/StartupSequence.h"
+#include "Violet/Core/Time.h"
 #include "Violet/Core/Timestep.h"
 #include "Violet/Core/Window.h"
 #include "Violet/Events/ApplicationEvent.h"
+#include "Violet/Events/EventQueue.h"
 #include "Violet/ImGui/ImGuiLayer.h"
 
 int main(int argc, char** argv);
 
 namespace Violet
 {
+	/**
+	 * @brief The command line the application was started with.
+	 */
+	struct ApplicationCommandLineArgs
+	{
+		int Count = 0;
+		char** Args = nullptr;
+
+		/**
+		 * @brief Gets an argument.
+		 * @param p_Index The index of the argument, 0 is the program.
+		 * @returns The argument.
+		 */
+		const char* operator[](int p_Index) const
+		{
+			VT_CORE_ASSERT(p_Index < Count, "Command Line Argument Out Of Range!");
+			return Args[p_Index];
+		}
+
+		/**
+		 * @brief Checks whether an argument was passed.
+		 * @param p_Argument The argument, like "--flight-recorder".
+		 * @returns If the argument is on the command line.
+		 */
+		bool Contains(const char* p_Argument) const
+		{
+			for (int i = 1; i < Count; i++)
+			{
+				if (strcmp(Args[i], p_Argument) == 0)
+					return true;
+			}
+			return false;
+		}
+
+		/**
+		 * @brief Gets the value following an argument.
+		 * @param p_Argument The argument, like "--replay".
+		 * @returns The next argument, or nullptr if there is none.
+		 */
+		const char* GetValue(const char* p_Argument) const
+		{
+			for (int i = 1; i + 1 < Count; i++)
+			{
+				if (strcmp(Args[i], p_Argument) == 0)
+					return Args[i + 1];
+			}
+			return nullptr;
+		}
+	};
+
 	/**
 	 * @brief Defines the functionality for an Application.
 	 */
 	class Application
 	{
 	public: // Constructors & Deconstructors
-		Application();
+		Application(ApplicationCommandLineArgs p_Args = ApplicationCommandLineArgs());
 		virtual ~Application();
 	public: // Main Functionality
 		void OnEvent(Event& p_Event);
 		void PushLayer(Layer* p_Layer);
 		void PushOverlay(Layer* p_Overlay);
 		void Close();
+
+		bool StartInputRecording(const std::string& p_Filepath);
+		void StopInputRecording();
+		bool StartInputPlayback(const std::string& p_Filepath, bool p_CloseWhenFinished = false);
+		void StopInputPlayback();
 	public: // Getters & Setters
 		Window& GetWindow() { return *m_Window; }
+		ImGuiLayer* GetImGuiLayer() { return m_ImGuiLayer; }
+		const ApplicationCommandLineArgs& GetCommandLineArgs() const { return m_CommandLineArgs; }
+		bool IsRecordingInput() const { return m_InputRecorder.IsRecording(); }
+		bool IsPlayingInput() const { return m_InputPlayback.IsPlaying(); }
+
+		/**
+		 * @brief Sets up the fixed timestep loop. While enabled, layers
+		 * get OnFixedUpdate ticks at a fixed rate before OnUpdate.
+		 * @param p_Settings The fixed timestep settings.
+		 */
+		void SetFixedTimestep(const FixedTimestepSettings& p_Settings) { m_FixedTimestep = p_Settings; m_FixedAccumulator = 0.0; }
+		const FixedTimestepSettings& GetFixedTimestep() const { return m_FixedTimestep; }
+
+		/**
+		 * @brief Gets how far the frame is between the last fixed tick
+		 * and the next, used to interpolate simulated state when
+		 * rendering in OnUpdate. OnUpdate also gets it through
+		 * Timestep::GetInterpolationAlpha.
+		 * @returns The interpolation alpha in [0, 1).
+		 */
+		float GetInterpolationAlpha() const { return m_InterpolationAlpha; }
 		static Application& Get() { return *s_Instance; }
 	private: // Event Callback
 		bool OnWindowClose(WindowCloseEvent& p_Event);
 		bool OnWindowResize(WindowResizeEvent& p_Event);
 	private: // Private Functionality
+		void Startup();
+		void StartLayer(Layer* p_Layer);
 		void Run();
+		void RunFixedUpdates(Timestep p_Timestep);
 	private: // Private Member Variables
+		ApplicationCommandLineArgs m_CommandLineArgs;
+		EventQueue m_EventQueue;
 		Scope<Window> m_Window;
 		LayerStack m_LayerStack;
 		ImGuiLayer* m_ImGuiLayer;
+
+		// Layers pushed before Startup attach once the sequence has run.
+		StartupSequence m_Startup;
+		std::vector<Layer*> m_PendingAttach;
+		bool m_Started = false;
+
 		bool m_Running = true;
 		bool m_Minimized = false;
-		float m_LastFrameTime = 0.0f;
+		uint64_t m_LastFrameTime = 0;
+
+		FixedTimestepSettings m_FixedTimestep;
+		double m_FixedAccumulator = 0.0;
+		float m_InterpolationAlpha = 0.0f;
+
+		InputRecorder m_InputRecorder;
+		InputPlayback m_InputPlayback;
+		bool m_CloseAfterPlayback = false;
 	private: // Static Instance
 		static Application* s_Instance;
 	private: // Friend Objects
@@ -65,9 +166,10 @@ namespace Violet
 
 	/**
 	 * @brief A function defined on the Client.
+	 * @param p_Args The command line arguments.
 	 * @return The application the Client is returning.
 	 */
-	Application* CreateApplication();
+	Application* CreateApplication(ApplicationCommandLineArgs p_Args);
 }
 
 #endif // __VIOLET_ENGINE_CORE_APPLICATION_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,318 @@
+/////////////////
+///
+/// AsyncLogSink.cpp
+/// Violet McAllister
+/// July 31st, 2022
+/// Updated: August 6th, 2022
+///
+/// Contains implementations for the async log
+/// sink.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Core/AsyncLogSink.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Constructs an AsyncLogSink object and starts its
+	 * background thread.
+	 * @param p_Targets The sinks the messages are written to.
+	 * @param p_Settings The settings for the queue and flushing.
+	 */
+	AsyncLogSink::AsyncLogSink(std::vector<spdlog::sink_ptr> p_Targets, const AsyncLogSettings& p_Settings)
+		: m_Targets(std::move(p_Targets)), m_Settings(p_Settings)
+	{
+		uint64_t capacity = 2;
+		while (capacity < m_Settings.QueueCapacity)
+			capacity <<= 1;
+
+		m_Cells = std::make_unique<Cell[]>(capacity);
+		m_Mask = capacity - 1;
+		for (uint64_t i = 0; i < capacity; i++)
+			m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+
+		m_Running = true;
+		m_Worker = std::thread(&AsyncLogSink::WorkerMain, this);
+	}
+
+	/**
+	 * @brief Deconstructs an AsyncLogSink object, writing out
+	 * whatever is still queued.
+	 */
+	AsyncLogSink::~AsyncLogSink()
+	{
+		Stop();
+	}
+
+	/**
+	 * @brief Queues a message. Errors and messages which do not
+	 * fit the queue wait for space, others are dropped and
+	 * counted when it is full. Once stopped, messages are
+	 * written directly since nothing drains the queue.
+	 * @param p_Message The message.
+	 */
+	void AsyncLogSink::log(const spdlog::details::log_msg& p_Message)
+	{
+		if (!m_Running.load(std::memory_order_acquire))
+		{
+			Write(p_Message);
+			return;
+		}
+
+		if (p_Message.payload.size() > MaxPayloadSize)
+		{
+			// Keep the order, everything before it is written first.
+			flush();
+			Write(p_Message);
+			return;
+		}
+
+		while (!TryPush(p_Message))
+		{
+			// Stopped while waiting for space, which would never come.
+			if (!m_Running.load(std::memory_order_acquire))
+			{
+				Write(p_Message);
+				return;
+			}
+
+			if (!m_Settings.BlockWhenFull && p_Message.level < spdlog::level::err)
+			{
+				m_Dropped.fetch_add(1, std::memory_order_relaxed);
+				m_DroppedTotal.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			std::this_thread::yield();
+		}
+
+		// A missed wake up only delays the message until the flush interval.
+		if (m_Sleeping.load(std::memory_order_relaxed))
+		{
+			std::lock_guard lock(m_Mutex);
+			m_WakeCondition.notify_one();
+		}
+	}
+
+	/**
+	 * @brief Waits until every message queued before the call
+	 * has been written and the targets have been flushed.
+	 */
+	void AsyncLogSink::flush()
+	{
+		uint64_t target = m_EnqueuePosition.load(std::memory_order_acquire);
+
+		std::unique_lock lock(m_Mutex);
+		if (!m_Running)
+		{
+			lock.unlock();
+			FlushTargets();
+			return;
+		}
+
+		m_FlushRequest = std::max(m_FlushRequest, target);
+		m_WakeCondition.notify_one();
+		m_FlushedCondition.wait(lock, [&]() { return m_FlushedPosition >= target || !m_Running; });
+	}
+
+	/**
+	 * @brief Sets the pattern of every target sink.
+	 * @param p_Pattern The pattern.
+	 */
+	void AsyncLogSink::set_pattern(const std::string& p_Pattern)
+	{
+		for (const spdlog::sink_ptr& target : m_Targets)
+			target->set_pattern(p_Pattern);
+	}
+
+	/**
+	 * @brief Sets the formatter of every target sink.
+	 * @param p_Formatter The formatter.
+	 */
+	void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> p_Formatter)
+	{
+		for (const spdlog::sink_ptr& target : m_Targets)
+			target->set_formatter(p_Formatter->clone());
+	}
+
+	/**
+	 * @brief Writes out the queue and stops the background
+	 * thread. Later messages are written directly.
+	 */
+	void AsyncLogSink::Stop()
+	{
+		{
+			std::lock_guard lock(m_Mutex);
+			if (!m_Running)
+				return;
+			m_Running = false;
+		}
+
+		m_WakeCondition.notify_one();
+		m_Worker.join();
+		m_FlushedCondition.notify_all();
+	}
+
+	/**
+	 * @brief Copies a message into the next free cell.
+	 * @param p_Message The message.
+	 * @returns If there was room in the queue.
+	 */
+	bool AsyncLogSink::TryPush(const spdlog::details::log_msg& p_Message)
+	{
+		uint64_t position = m_EnqueuePosition.load(std::memory_order_relaxed);
+		Cell* cell;
+		while (true)
+		{
+			cell = &m_Cells[position & m_Mask];
+			uint64_t sequence = cell->Sequence.load(std::memory_order_acquire);
+			int64_t difference = (int64_t)sequence - (int64_t)position;
+
+			if (difference == 0)
+			{
+				if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (difference < 0)
+				return false;
+			else
+				position = m_EnqueuePosition.load(std::memory_order_relaxed);
+		}
+
+		Entry& entry = cell->Message;
+		entry.Time = p_Message.time;
+		entry.ThreadID = p_Message.thread_id;
+		entry.LoggerName = p_Message.logger_name.data();
+		entry.LoggerNameSize = (uint16_t)p_Message.logger_name.size();
+		entry.Level = p_Message.level;
+		entry.PayloadSize = (uint16_t)p_Message.payload.size();
+		memcpy(entry.Payload, p_Message.payload.data(), p_Message.payload.size());
+
+		cell->Sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief Checks whether the next cell holds a message. Only
+	 * called on the background thread.
+	 * @returns If a message is waiting.
+	 */
+	bool AsyncLogSink::HasPending() const
+	{
+		const Cell& cell = m_Cells[m_DequeuePosition & m_Mask];
+		return cell.Sequence.load(std::memory_order_acquire) == m_DequeuePosition + 1;
+	}
+
+	/**
+	 * @brief Writes every queued message to the targets.
+	 * @returns The number of messages written.
+	 */
+	uint32_t AsyncLogSink::Drain()
+	{
+		uint32_t count = 0;
+		while (HasPending())
+		{
+			Cell& cell = m_Cells[m_DequeuePosition & m_Mask];
+			const Entry& entry = cell.Message;
+
+			spdlog::details::log_msg message(entry.Time, spdlog::source_loc(), spdlog::string_view_t(entry.LoggerName, entry.LoggerNameSize), entry.Level, spdlog::string_view_t(entry.Payload, entry.PayloadSize));
+			message.thread_id = entry.ThreadID;
+			Write(message);
+
+			cell.Sequence.store(m_DequeuePosition + m_Mask + 1, std::memory_order_release);
+			m_DequeuePosition++;
+			count++;
+		}
+
+		return count;
+	}
+
+	/**
+	 * @brief Writes a message to every target accepting its level.
+	 * @param p_Message The message.
+	 */
+	void AsyncLogSink::Write(const spdlog::details::log_msg& p_Message)
+	{
+		for (const spdlog::sink_ptr& target : m_Targets)
+		{
+			if (target->should_log(p_Message.level))
+				target->log(p_Message);
+		}
+	}
+
+	/**
+	 * @brief Flushes every target.
+	 */
+	void AsyncLogSink::FlushTargets()
+	{
+		for (const spdlog::sink_ptr& target : m_Targets)
+			target->flush();
+	}
+
+	/**
+	 * @brief Writes queued messages as they arrive, flushing
+	 * when asked to and on the flush interval.
+	 */
+	void AsyncLogSink::WorkerMain()
+	{
+		VT_PROFILE_THREAD("Log");
+
+		auto interval = std::chrono::duration<float>(m_Settings.FlushIntervalSeconds);
+		auto lastFlush = std::chrono::steady_clock::now();
+		bool unflushed = false;
+
+		while (true)
+		{
+			if (Drain() > 0)
+				unflushed = true;
+
+			uint64_t dropped = m_Dropped.exchange(0, std::memory_order_relaxed);
+			if (dropped > 0)
+			{
+				std::string payload = fmt::format("{0} Log Messages Dropped, The Queue Was Full.", dropped);
+				Write(spdlog::details::log_msg("LOG", spdlog::level::warn, payload));
+				unflushed = true;
+			}
+
+			std::unique_lock lock(m_Mutex);
+			bool flushRequested = m_FlushRequest > m_FlushedPosition;
+
+			// Messages claimed before the request may still be being copied in.
+			if (flushRequested && m_DequeuePosition < m_FlushRequest)
+				continue;
+
+			auto now = std::chrono::steady_clock::now();
+			if (flushRequested || (unflushed && now - lastFlush >= interval))
+			{
+				uint64_t position = m_DequeuePosition;
+				lock.unlock();
+				FlushTargets();
+				lock.lock();
+
+				m_FlushedPosition = std::max(m_FlushedPosition, position);
+				m_FlushedCondition.notify_all();
+				lastFlush = now;
+				unflushed = false;
+			}
+
+			if (!m_Running)
+			{
+				if (HasPending())
+					continue;
+				break;
+			}
+
+			if (HasPending() || m_FlushRequest > m_FlushedPosition)
+				continue;
+
+			m_Sleeping.store(true, std::memory_order_relaxed);
+			m_WakeCondition.wait_for(lock, interval, [&]() { return HasPending() || m_FlushRequest > m_FlushedPosition || !m_Running; });
+			m_Sleeping.store(false, std::memory_order_relaxed);
+		}
+
+		FlushTargets();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+/////////////////
+///
+/// AsyncLogSink.h
+/// Violet McAllister
+/// July 31st, 2022
+/// Updated: August 6th, 2022
+///
+/// A spdlog sink which hands messages to a
+/// background thread through a bounded lock-free
+/// queue, so console and file output never run on
+/// the logging thread.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_CORE_ASYNC_LOG_SINK_H_INCLUDED__
+#define __VIOLET_ENGINE_CORE_ASYNC_LOG_SINK_H_INCLUDED__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <spdlog/sinks/sink.h>
+
+namespace Violet
+{
+	/**
+	 * @brief Contains the settings of the async log sink.
+	 */
+	struct AsyncLogSettings
+	{
+		// Rounded up to a power of two.
+		uint32_t QueueCapacity = 4096;
+
+		// Wait for space instead of dropping messages when the queue is full.
+		bool BlockWhenFull = false;
+
+		// How often the background thread flushes while messages arrive.
+		float FlushIntervalSeconds = 1.0f;
+	};
+
+	/**
+	 * @brief Copies formatted messages into a ring and writes them
+	 * to the target sinks on a background thread. Messages too long
+	 * for a slot are written directly after the queue is drained,
+	 * and so is everything logged once the sink is stopped.
+	 * Calling flush waits until everything queued so far has been
+	 * written and flushed.
+	 */
+	class AsyncLogSink : public spdlog::sinks::sink
+	{
+	public: // Constants
+		static constexpr uint32_t MaxPayloadSize = 216;
+	public: // Constructors & Deconstructors
+		AsyncLogSink(std::vector<spdlog::sink_ptr> p_Targets, const AsyncLogSettings& p_Settings);
+		virtual ~AsyncLogSink();
+	public: // Sink Overrides
+		virtual void log(const spdlog::details::log_msg& p_Message) override;
+		virtual void flush() override;
+		virtual void set_pattern(const std::string& p_Pattern) override;
+		virtual void set_formatter(std::unique_ptr<spdlog::formatter> p_Formatter) override;
+	public: // Main Functionality
+		void Stop();
+	public: // Getters
+		const std::vector<spdlog::sink_ptr>& GetTargets() const { return m_Targets; }
+		uint64_t GetDroppedCount() const { return m_DroppedTotal.load(std::memory_order_relaxed); }
+	private: // Definitions
+		/**
+		 * @brief A copy of a log message waiting in the queue.
+		 */
+		struct Entry
+		{
+			spdlog::log_clock::time_point Time;
+			size_t ThreadID;
+			const char* LoggerName;
+			uint16_t LoggerNameSize;
+			uint16_t PayloadSize;
+			spdlog::level::level_enum Level;
+			char Payload[MaxPayloadSize];
+		};
+
+		// Sized so a cell fills four cache lines.
+		struct Cell
+		{
+			std::atomic<uint64_t> Sequence;
+			Entry Message;
+		};
+	private: // Helper
+		bool TryPush(const spdlog::details::log_msg& p_Message);
+		bool HasPending() const;
+		uint32_t Drain();
+		void Write(const spdlog::details::log_msg& p_Message);
+		void FlushTargets();
+		void WorkerMain();
+	private: // Private Member Variables
+		std::vector<spdlog::sink_ptr> m_Targets;
+		AsyncLogSettings m_Settings;
+
+		std::unique_ptr<Cell[]> m_Cells;
+		uint64_t m_Mask = 0;
+		alignas(64) std::atomic<uint64_t> m_EnqueuePosition = 0;
+		alignas(64) uint64_t m_DequeuePosition = 0;
+
+		// Messages dropped since the last report, and in total.
+		std::atomic<uint64_t> m_Dropped = 0;
+		std::atomic<uint64_t> m_DroppedTotal = 0;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_WakeCondition;
+		std::condition_variable m_FlushedCondition;
+		std::atomic<bool> m_Sleeping = false;
+		uint64_t m_FlushRequest = 0;
+		uint64_t m_FlushedPosition = 0;
+		std::atomic<bool> m_Running = false; // Changed under m_Mutex, read without it by log.
+
+		std::thread m_Worker;
+	};
+}
+
+#endif // __VIOLET_ENGINE_CORE_ASYNC_LOG_SINK_H_INCLUDED__
\ No newline at end of file
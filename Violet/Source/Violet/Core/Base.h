@@ -3,7 +3,7 @@
 /// Core.h
 /// Violet McAllister
 /// June 30th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 /// 
 /// Defines the macros required to make dll
 /// exporting work and connect the Violet
@@ -16,6 +16,8 @@
 
 #include <memory>
 
+#include "Violet/Core/Ref.h"
+
 // Platform detection using predefined macros
 #ifdef _WIN32
 	/* Windows x64/x86 */
@@ -50,8 +52,8 @@
 	#define VT_PLATFORM_ANDROID
 	#error "Android is not supported!"
 #elif defined(__linux__)
+	/* Linux is headless only, see HeadlessWindow */
 	#define VT_PLATFORM_LINUX
-	#error "Linux is not supported!"
 #else
 	/* Unknown compiler/platform */
 	#error "Unknown platform!"
@@ -76,15 +78,15 @@
 	#define VT_ASSERT(x, ...) { if (!(x)) { VT_ERROR("Assertion Failed: {0}", __VA_ARGS__); VT_DEBUGBREAK(); } }
 	#define VT_CORE_ASSERT(x, ...) { if (!(x)) { VT_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); VT_DEBUGBREAK(); } }
 #else
-	#define VT_ASSERT(x, ...)
-	#define VT_CORE_ASSERT(x, ...)
+	#define VT_ASSERT(x, ...) (void)sizeof(!(x))
+	#define VT_CORE_ASSERT(x, ...) (void)sizeof(!(x))
 #endif // VT_ENABLE_ASSERTS
 
 // Bit Operation
 #define BIT(x) (1 << x)
 
-// Event Bind Function
-#define VT_BIND_EVENT_FN(fn) std::bind(&fn, this, std::placeholders::_1)
+// Event Bind Function, a lambda so the call can be inlined.
+#define VT_BIND_EVENT_FN(fn) [this](auto&&... p_Arguments) -> decltype(auto) { return this->fn(std::forward<decltype(p_Arguments)>(p_Arguments)...); }
 
 namespace Violet
 {
@@ -102,21 +104,6 @@ namespace Violet
 	{
 		return std::make_unique<T>(std::forward<Args>(args)...);
 	}
-
-	/**
-	 * @brief Refs are similar to Scopes except that multiple
-	 * references can be made to that place in memory, with the
-	 * same perk that once there are no more references to that
-	 * place in memory it gets deallocated.
-	 */
-	template<typename T>
-	using Ref = std::shared_ptr<T>;
-
-	template<typename T, typename ... Args>
-	constexpr Ref<T> CreateRef(Args&& ... args)
-	{
-		return std::make_shared<T>(std::forward<Args>(args)...);
-	}
 }
 
 #endif // __VIOLET_ENGINE_CORE_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,52 @@
+/////////////////
+///
+/// Bounds2D.h
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// An axis aligned rectangle, for culling and
+/// picking in the xy plane.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_CORE_BOUNDS_2D_H_INCLUDED__
+#define __VIOLET_ENGINE_CORE_BOUNDS_2D_H_INCLUDED__
+
+#include <glm/glm.hpp>
+
+namespace Violet
+{
+	/**
+	 * @brief An axis aligned rectangle. Edges count as inside.
+	 */
+	struct Bounds2D
+	{
+		glm::vec2 Min = { 0.0f, 0.0f };
+		glm::vec2 Max = { 0.0f, 0.0f };
+
+		glm::vec2 GetCenter() const { return (Min + Max) * 0.5f; }
+		glm::vec2 GetSize() const { return Max - Min; }
+
+		/**
+		 * @brief Checks whether two rectangles touch.
+		 * @param p_Other The other rectangle.
+		 * @returns If they overlap.
+		 */
+		bool Overlaps(const Bounds2D& p_Other) const
+		{
+			return Min.x <= p_Other.Max.x && p_Other.Min.x <= Max.x && Min.y <= p_Other.Max.y && p_Other.Min.y <= Max.y;
+		}
+
+		/**
+		 * @brief Checks whether a point is inside the rectangle.
+		 * @param p_Point The point.
+		 * @returns If the point is inside.
+		 */
+		bool Contains(const glm::vec2& p_Point) const
+		{
+			return Min.x <= p_Point.x && p_Point.x <= Max.x && Min.y <= p_Point.y && p_Point.y <= Max.y;
+		}
+	};
+}
+
+#endif // __VIOLET_ENGINE_CORE_BOUNDS_2D_H_INCLUDED__
\ No newline at end of file
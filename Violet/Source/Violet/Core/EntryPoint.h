@@ -3,44 +3,67 @@
 /// EntryPoint.h
 /// Violet McAllister
 /// June 30th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Allows the main function to be defined
 /// and implemented on the engine side instead
-/// of the client side.
+/// of the client side. The command line is
+/// passed on to the client application.
 ///
-/// Initializes Logging.
+/// Initializes and shuts down Logging, and dumps
+/// the fast log rings on a crash.
+///
+/// Profile sessions are only opened automatically
+/// when VT_PROFILE_LEVEL includes function scopes.
+///
+/// Hooks the global allocator when allocations
+/// are tracked.
 ///
 /////////////////
 
 #ifndef __VIOLET_ENGINE_CORE_ENTRY_POINT_H_INCLUDED__
 #define __VIOLET_ENGINE_CORE_ENTRY_POINT_H_INCLUDED__
 
-#ifdef VT_PLATFORM_WINDOWS
+#if defined(VT_PLATFORM_WINDOWS) || defined(VT_PLATFORM_LINUX)
 
 #include "Violet/Core/Base.h"
+#include "Violet/Debug/FastLog.h"
+#include "Violet/Debug/ProfileClock.h"
+
+#ifdef VT_TRACK_ALLOCATIONS
+	#include "Violet/Debug/AllocationHooks.h"
+#endif
 
-extern Violet::Application* Violet::CreateApplication();
+extern Violet::Application* Violet::CreateApplication(Violet::ApplicationCommandLineArgs p_Args);
 
 int main(int p_ArgumentCount, char** p_Arguments)
 {
 	// Initialize Logger
 	Violet::Log::Init();
 
+	// Before the job workers start reading the clock.
+	Violet::ProfileClock::Calibrate();
+#if VT_ENABLE_FAST_LOG
+	Violet::FastLog::InstallCrashHandler("VioletFastLog-Crash.vtfl");
+#endif
+
 	// Initialize Application
-	VT_PROFILE_BEGIN_SESSION("Startup", "VioletProfile-Startup.json");
-	auto app = Violet::CreateApplication();
-	VT_PROFILE_END_SESSION();
+	VT_PROFILE_BEGIN_AUTO_SESSION("Startup", "VioletProfile-Startup.json");
+	auto app = Violet::CreateApplication({ p_ArgumentCount, p_Arguments });
+	app->Startup();
+	VT_PROFILE_END_AUTO_SESSION();
 
-	VT_PROFILE_BEGIN_SESSION("Runtime", "VioletProfile-Runtime.json");
+	VT_PROFILE_BEGIN_AUTO_SESSION("Runtime", "VioletProfile-Runtime.json");
 	app->Run();
-	VT_PROFILE_END_SESSION();
+	VT_PROFILE_END_AUTO_SESSION();
 
-	VT_PROFILE_BEGIN_SESSION("Shutdown", "VioletProfile-Shutdown.json");
+	VT_PROFILE_BEGIN_AUTO_SESSION("Shutdown", "VioletProfile-Shutdown.json");
 	delete app;
-	VT_PROFILE_END_SESSION();
+	VT_PROFILE_END_AUTO_SESSION();
+
+	Violet::Log::Shutdown();
 }
 
-#endif // VT_PLATFORM_WINDOWS
+#endif // VT_PLATFORM_WINDOWS || VT_PLATFORM_LINUX
 
 #endif // __VIOLET_ENGINE_CORE_ENTRY_POINT_H_INCLUDED__
\ No newline at end of file
@@ -3,6 +3,7 @@
 /// Input.cpp
 /// Violet McAllister
 /// July 15th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Used to conduct input polling on the application
 /// and client side.
@@ -13,23 +14,123 @@
 
 #include "Violet/Core/Input.h"
 
-#ifdef VT_PLATFORM_WINDOWS
+#include "Violet/Events/KeyEvent.h"
+#include "Violet/Events/MouseEvent.h"
+
+#if defined(VT_PLATFORM_WINDOWS)
 	#include "Platform/Windows/WindowsInput.h"
+#elif defined(VT_PLATFORM_LINUX)
+	#include "Platform/Linux/LinuxInput.h"
 #endif
 
 namespace Violet
 {
 	Scope<Input> Input::s_Instance = Input::Create();
+	InputState Input::s_State;
+
+	/**
+	 * @brief Updates the snapshot with an event. Must see every
+	 * event, before any layer can handle it.
+	 * @param p_Event The event.
+	 */
+	void Input::OnEvent(Event& p_Event)
+	{
+		switch (p_Event.GetEventType())
+		{
+			case EventType::KeyPressed:
+			{
+				auto& e = static_cast<KeyPressedEvent&>(p_Event);
+				uint32_t key = static_cast<uint32_t>(e.GetKeyCode());
+				if (key < InputState::KeyCount && !s_State.Keys.test(key))
+				{
+					s_State.Keys.set(key);
+					s_State.KeysPressed.set(key);
+				}
+				break;
+			}
+			case EventType::KeyReleased:
+			{
+				auto& e = static_cast<KeyReleasedEvent&>(p_Event);
+				uint32_t key = static_cast<uint32_t>(e.GetKeyCode());
+				if (key < InputState::KeyCount)
+				{
+					s_State.Keys.reset(key);
+					s_State.KeysReleased.set(key);
+				}
+				break;
+			}
+			case EventType::MouseButtonPressed:
+			{
+				auto& e = static_cast<MouseButtonPressedEvent&>(p_Event);
+				uint32_t button = static_cast<uint32_t>(e.GetMouseButton());
+				if (button < InputState::MouseButtonCount)
+				{
+					s_State.MouseButtons.set(button);
+					s_State.MouseButtonsPressed.set(button);
+				}
+				break;
+			}
+			case EventType::MouseButtonReleased:
+			{
+				auto& e = static_cast<MouseButtonReleasedEvent&>(p_Event);
+				uint32_t button = static_cast<uint32_t>(e.GetMouseButton());
+				if (button < InputState::MouseButtonCount)
+				{
+					s_State.MouseButtons.reset(button);
+					s_State.MouseButtonsReleased.set(button);
+				}
+				break;
+			}
+			case EventType::MouseMoved:
+			{
+				auto& e = static_cast<MouseMovedEvent&>(p_Event);
+				s_State.MouseX = e.GetX();
+				s_State.MouseY = e.GetY();
+				break;
+			}
+			case EventType::MouseScrolled:
+			{
+				auto& e = static_cast<MouseScrolledEvent&>(p_Event);
+				s_State.ScrollX += e.GetXOffset();
+				s_State.ScrollY += e.GetYOffset();
+				break;
+			}
+			default:
+				break;
+		}
+	}
+
+	/**
+	 * @brief Rebuilds the held keys, buttons and mouse position
+	 * by polling the platform, for when events may have been
+	 * missed, like before the window existed.
+	 */
+	void Input::Synchronize()
+	{
+		VT_PROFILE_FUNCTION();
+
+		s_State = InputState();
+		for (uint32_t key = static_cast<uint32_t>(Key::Space); key <= static_cast<uint32_t>(Key::Menu); key++)
+			s_State.Keys.set(key, s_Instance->IsKeyPressedImpl(static_cast<KeyCode>(key)));
+		for (uint32_t button = 0; button < InputState::MouseButtonCount; button++)
+			s_State.MouseButtons.set(button, s_Instance->IsMouseButtonPressedImpl(static_cast<MouseCode>(button)));
+
+		auto [x, y] = s_Instance->GetMousePositionImpl();
+		s_State.MouseX = x;
+		s_State.MouseY = y;
+	}
 
 	/**
-	 * @brief Allows the user to create an Input for the Windows
-	 * system without specifically referencing Windows.
-	 * @returns The windows input, not implemented for Windows.
+	 * @brief Allows the user to create an Input for the current
+	 * platform without specifically referencing it.
+	 * @returns The platform input.
 	 */
 	Scope<Input> Input::Create()
 	{
-	#ifdef VT_PLATFORM_WINDOWS
+	#if defined(VT_PLATFORM_WINDOWS)
 		return CreateScope<WindowsInput>();
+	#elif defined(VT_PLATFORM_LINUX)
+		return CreateScope<LinuxInput>();
 	#else
 		VT_CORE_ASSERT(false, "Unknown Platform!");
 		return nullptr;
@@ -3,7 +3,7 @@
 /// Input.h
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 16th, 2022
+/// Updated: July 26th, 2022
 ///
 /// Used to conduct input polling on the application
 /// and client side.
@@ -14,14 +14,21 @@
 #define __VIOLET_ENGINE_CORE_INPUT_H_INCLUDED__
 
 #include "Violet/Core/Base.h"
+#include "Violet/Core/InputState.h"
 #include "Violet/Core/KeyCodes.h"
 #include "Violet/Core/MouseCodes.h"
+#include "Violet/Events/Event.h"
 
 namespace Violet
 {
 	/**
 	 * @brief Main input object for Input Polling in
 	 * Violet.
+	 * 
+	 * Queries read a snapshot built from the events of the
+	 * frame, so they are bit tests and stay consistent for
+	 * the whole frame. The platform implementation is only
+	 * polled to synchronize the snapshot.
 	 */
 	class Input
 	{
@@ -30,38 +37,79 @@ namespace Violet
 	public: // Constructors For Singleton
 		Input(const Input&) = delete;
 		Input& operator=(const Input&) = delete;
+	public: // Main Functionality
+		static void NewFrame() { s_State.NewFrame(); }
+		static void OnEvent(Event& p_Event);
+		static void Synchronize();
 	public: // Static Key Events
 		/**
 		 * @brief Checks if a certain key is pressed.
 		 * @param p_KeyCode The key code of the key we're checking.
 		 * @returns If a certain key is being pressed.
 		 */
-		static bool IsKeyPressed(KeyCode p_Key) { return s_Instance->IsKeyPressedImpl(p_Key); }
+		static bool IsKeyPressed(KeyCode p_Key) { return TestKey(s_State.Keys, p_Key); }
+
+		/**
+		 * @brief Checks if a key went down this frame.
+		 * @param p_KeyCode The key code of the key we're checking.
+		 * @returns If the key was pressed this frame.
+		 */
+		static bool IsKeyJustPressed(KeyCode p_Key) { return TestKey(s_State.KeysPressed, p_Key); }
+
+		/**
+		 * @brief Checks if a key went up this frame.
+		 * @param p_KeyCode The key code of the key we're checking.
+		 * @returns If the key was released this frame.
+		 */
+		static bool IsKeyJustReleased(KeyCode p_Key) { return TestKey(s_State.KeysReleased, p_Key); }
 	public: // Static Mouse Events
 		/**
 		 * @brief Checks if a mouse button is pressed.
 		 * @param p_Button the button code of the button we are checking.
 		 * @returns If a certain mouse butotn is being pressed.
 		 */
-		static bool IsMouseButtonPressed(MouseCode p_Button) { return s_Instance->IsMouseButtonPressedImpl(p_Button); }
+		static bool IsMouseButtonPressed(MouseCode p_Button) { return TestMouseButton(s_State.MouseButtons, p_Button); }
+
+		/**
+		 * @brief Checks if a mouse button went down this frame.
+		 * @param p_Button the button code of the button we are checking.
+		 * @returns If the button was pressed this frame.
+		 */
+		static bool IsMouseButtonJustPressed(MouseCode p_Button) { return TestMouseButton(s_State.MouseButtonsPressed, p_Button); }
+
+		/**
+		 * @brief Checks if a mouse button went up this frame.
+		 * @param p_Button the button code of the button we are checking.
+		 * @returns If the button was released this frame.
+		 */
+		static bool IsMouseButtonJustReleased(MouseCode p_Button) { return TestMouseButton(s_State.MouseButtonsReleased, p_Button); }
 
 		/**
 		 * @brief Gets the mouse position.
 		 * @returns The mouse position as a std::pair
 		 */
-		static std::pair<float, float> GetMousePosition() { return s_Instance->GetMousePositionImpl(); }
+		static std::pair<float, float> GetMousePosition() { return { s_State.MouseX, s_State.MouseY }; }
 
 		/**
 		 * @brief Gets the mouse X position.
 		 * @returns The mouse X position.
 		 */
-		static float GetMouseX() { return s_Instance->GetMouseXImpl(); }
+		static float GetMouseX() { return s_State.MouseX; }
 
 		/*
 		 * @brief Gets the mouse Y position.
 		 * @returns The mouse Y position.
 		 */
-		static float GetMouseY() { return s_Instance->GetMouseYImpl(); }
+		static float GetMouseY() { return s_State.MouseY; }
+
+		/**
+		 * @brief Gets the scrolling done this frame.
+		 * @returns The scroll offsets as a std::pair
+		 */
+		static std::pair<float, float> GetMouseScroll() { return { s_State.ScrollX, s_State.ScrollY }; }
+	public: // Getters & Setters
+		static const InputState& GetState() { return s_State; }
+		static void SetState(const InputState& p_State) { s_State = p_State; }
 	public: // Creator
 		static Scope<Input> Create();
 	protected: // Key Event Implementations
@@ -71,8 +119,23 @@ namespace Violet
 		virtual std::pair<float, float> GetMousePositionImpl() = 0;
 		virtual float GetMouseXImpl() = 0;
 		virtual float GetMouseYImpl() = 0;
+	private: // Helper
+		template<size_t N>
+		static bool TestKey(const std::bitset<N>& p_Set, KeyCode p_Key)
+		{
+			uint32_t index = static_cast<uint32_t>(p_Key);
+			return index < N && p_Set.test(index);
+		}
+
+		template<size_t N>
+		static bool TestMouseButton(const std::bitset<N>& p_Set, MouseCode p_Button)
+		{
+			uint32_t index = static_cast<uint32_t>(p_Button);
+			return index < N && p_Set.test(index);
+		}
 	private: // Static Instance
 		static Scope<Input> s_Instance;
+		static InputState s_State;
 	};
 }
 
@@ -0,0 +1,400 @@
+/////////////////
+///
+/// InputRecording.cpp
+/// Violet McAllister
+/// July 26th, 2022
+/// Updated: August 6th, 2022
+///
+/// Contains implementations for the input recorder
+/// and playback.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Core/InputRecording.h"
+
+#include "Violet/Core/Input.h"
+#include "Violet/Events/ApplicationEvent.h"
+#include "Violet/Events/KeyEvent.h"
+#include "Violet/Events/MouseEvent.h"
+
+namespace Violet
+{
+	// The unsigned integer as wide as a value, for moving its bytes.
+	template<typename T>
+	using ValueBits = std::conditional_t<sizeof(T) == 1, uint8_t, std::conditional_t<sizeof(T) == 2, uint16_t, uint32_t>>;
+
+	/**
+	 * @brief Appends a value to a buffer, lowest byte first.
+	 * @param p_Buffer The buffer.
+	 * @param p_Value The value.
+	 */
+	template<typename T>
+	static void WriteValue(std::vector<uint8_t>& p_Buffer, const T& p_Value)
+	{
+		static_assert(std::is_arithmetic_v<T> && sizeof(T) <= 4, "Only Values Up To 32 Bits Are Recorded!");
+
+		ValueBits<T> bits;
+		memcpy(&bits, &p_Value, sizeof(T));
+		for (size_t byte = 0; byte < sizeof(T); byte++)
+			p_Buffer.push_back((uint8_t)(bits >> (byte * 8)));
+	}
+
+	/**
+	 * @brief Reads a value written by WriteValue.
+	 * @param p_Buffer The buffer.
+	 * @param p_Offset The read offset, advanced past the value.
+	 * @param p_Value The value.
+	 * @returns Whether the buffer held the value.
+	 */
+	template<typename T>
+	static bool ReadValue(const std::vector<uint8_t>& p_Buffer, size_t& p_Offset, T& p_Value)
+	{
+		static_assert(std::is_arithmetic_v<T> && sizeof(T) <= 4, "Only Values Up To 32 Bits Are Recorded!");
+
+		if (p_Offset + sizeof(T) > p_Buffer.size())
+			return false;
+
+		ValueBits<T> bits = 0;
+		for (size_t byte = 0; byte < sizeof(T); byte++)
+			bits |= (ValueBits<T>)((ValueBits<T>)p_Buffer[p_Offset + byte] << (byte * 8));
+		memcpy(&p_Value, &bits, sizeof(T));
+		p_Offset += sizeof(T);
+		return true;
+	}
+
+	/**
+	 * @brief Appends a bitset to a buffer, eight bits per byte.
+	 * @param p_Buffer The buffer.
+	 * @param p_Bits The bitset.
+	 */
+	template<size_t N>
+	static void WriteBits(std::vector<uint8_t>& p_Buffer, const std::bitset<N>& p_Bits)
+	{
+		for (size_t byte = 0; byte < (N + 7) / 8; byte++)
+		{
+			uint8_t value = 0;
+			for (size_t bit = 0; bit < 8 && byte * 8 + bit < N; bit++)
+				value |= (uint8_t)p_Bits.test(byte * 8 + bit) << bit;
+			p_Buffer.push_back(value);
+		}
+	}
+
+	/**
+	 * @brief Reads a bitset written by WriteBits.
+	 * @param p_Buffer The buffer.
+	 * @param p_Offset The read offset, advanced past the bitset.
+	 * @param p_Bits The bitset.
+	 * @returns Whether the buffer held the bitset.
+	 */
+	template<size_t N>
+	static bool ReadBits(const std::vector<uint8_t>& p_Buffer, size_t& p_Offset, std::bitset<N>& p_Bits)
+	{
+		for (size_t byte = 0; byte < (N + 7) / 8; byte++)
+		{
+			uint8_t value;
+			if (!ReadValue(p_Buffer, p_Offset, value))
+				return false;
+			for (size_t bit = 0; bit < 8 && byte * 8 + bit < N; bit++)
+				p_Bits.set(byte * 8 + bit, (value >> bit) & 1);
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Opens the file and writes the header with the
+	 * current input state.
+	 * @param p_Filepath The path of the recording.
+	 * @returns Whether the recording started.
+	 */
+	bool InputRecorder::Begin(const std::string& p_Filepath)
+	{
+		End();
+
+		m_Output.open(p_Filepath, std::ios::out | std::ios::binary);
+		if (!m_Output.is_open())
+		{
+			VT_CORE_ERROR("Could Not Open Input Recording '{0}'.", p_Filepath);
+			return false;
+		}
+
+		const InputState& state = Input::GetState();
+		std::vector<uint8_t> header;
+		header.insert(header.end(), InputRecordingFormat::Magic, InputRecordingFormat::Magic + 4);
+		WriteValue(header, InputRecordingFormat::Version);
+		WriteValue(header, (uint32_t)0);
+		WriteBits(header, state.Keys);
+		WriteBits(header, state.MouseButtons);
+		WriteValue(header, state.MouseX);
+		WriteValue(header, state.MouseY);
+		m_Output.write((const char*)header.data(), header.size());
+
+		m_FrameEvents.clear();
+		m_FrameEventCount = 0;
+		m_FrameCount = 0;
+
+		VT_CORE_INFO("Recording Input To '{0}'.", p_Filepath);
+		return true;
+	}
+
+	/**
+	 * @brief Writes the frame count into the header and closes
+	 * the file. Events of an unfinished frame are dropped.
+	 */
+	void InputRecorder::End()
+	{
+		if (!m_Output.is_open())
+			return;
+
+		std::vector<uint8_t> frameCount;
+		WriteValue(frameCount, m_FrameCount);
+		m_Output.seekp(sizeof(InputRecordingFormat::Magic) + sizeof(uint32_t));
+		m_Output.write((const char*)frameCount.data(), frameCount.size());
+		m_Output.close();
+
+		VT_CORE_INFO("Input Recording Finished, {0} Frames.", m_FrameCount);
+	}
+
+	/**
+	 * @brief Records an input event for the current frame.
+	 * @param p_Event The event.
+	 */
+	void InputRecorder::RecordEvent(Event& p_Event)
+	{
+		if (!IsRecording() || !(p_Event.IsInCategory(EventCategoryInput) || p_Event.GetEventType() == EventType::WindowResize))
+			return;
+
+		if (m_FrameEventCount == UINT16_MAX)
+		{
+			VT_CORE_WARN("Input Recording Frame Is Full, Dropping {0}.", p_Event.GetName());
+			return;
+		}
+
+		EventType type = p_Event.GetEventType();
+		WriteValue(m_FrameEvents, (uint8_t)type);
+		switch (type)
+		{
+			case EventType::KeyPressed:
+			{
+				auto& e = static_cast<KeyPressedEvent&>(p_Event);
+				WriteValue(m_FrameEvents, (uint16_t)e.GetKeyCode());
+				WriteValue(m_FrameEvents, (uint16_t)e.GetRepeatCount());
+				break;
+			}
+			case EventType::KeyReleased:
+			case EventType::KeyTyped:
+				WriteValue(m_FrameEvents, (uint16_t)static_cast<KeyEvent&>(p_Event).GetKeyCode());
+				break;
+			case EventType::MouseButtonPressed:
+			case EventType::MouseButtonReleased:
+				WriteValue(m_FrameEvents, (uint16_t)static_cast<MouseButtonEvent&>(p_Event).GetMouseButton());
+				break;
+			case EventType::MouseMoved:
+			{
+				auto& e = static_cast<MouseMovedEvent&>(p_Event);
+				WriteValue(m_FrameEvents, e.GetX());
+				WriteValue(m_FrameEvents, e.GetY());
+				break;
+			}
+			case EventType::MouseScrolled:
+			{
+				auto& e = static_cast<MouseScrolledEvent&>(p_Event);
+				WriteValue(m_FrameEvents, e.GetXOffset());
+				WriteValue(m_FrameEvents, e.GetYOffset());
+				break;
+			}
+			case EventType::WindowResize:
+			{
+				auto& e = static_cast<WindowResizeEvent&>(p_Event);
+				WriteValue(m_FrameEvents, (uint32_t)e.GetWidth());
+				WriteValue(m_FrameEvents, (uint32_t)e.GetHeight());
+				break;
+			}
+			default:
+				VT_CORE_ASSERT(false, "Unknown Input Event!");
+				m_FrameEvents.pop_back();
+				return;
+		}
+
+		m_FrameEventCount++;
+	}
+
+	/**
+	 * @brief Writes the events of the frame along with its timestep.
+	 * @param p_Timestep The timestep of the frame.
+	 */
+	void InputRecorder::EndFrame(Timestep p_Timestep)
+	{
+		if (!IsRecording())
+			return;
+
+		std::vector<uint8_t> frameHeader;
+		WriteValue(frameHeader, p_Timestep.GetSeconds());
+		WriteValue(frameHeader, m_FrameEventCount);
+		m_Output.write((const char*)frameHeader.data(), frameHeader.size());
+		m_Output.write((const char*)m_FrameEvents.data(), m_FrameEvents.size());
+
+		m_FrameEvents.clear();
+		m_FrameEventCount = 0;
+		m_FrameCount++;
+	}
+
+	/**
+	 * @brief Loads a recording and restores the input state it
+	 * started with.
+	 * @param p_Filepath The path of the recording.
+	 * @returns Whether the playback started.
+	 */
+	bool InputPlayback::Begin(const std::string& p_Filepath)
+	{
+		End();
+
+		std::ifstream input(p_Filepath, std::ios::in | std::ios::binary);
+		if (!input.is_open())
+		{
+			VT_CORE_ERROR("Could Not Open Input Recording '{0}'.", p_Filepath);
+			return false;
+		}
+
+		m_Data.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+
+		uint32_t version = 0;
+		m_Offset = sizeof(InputRecordingFormat::Magic);
+		if (m_Data.size() < m_Offset || memcmp(m_Data.data(), InputRecordingFormat::Magic, m_Offset) != 0)
+		{
+			VT_CORE_ERROR("'{0}' Is Not An Input Recording.", p_Filepath);
+			return false;
+		}
+
+		// Older versions are a subset of the current one.
+		InputState state;
+		if (!ReadValue(m_Data, m_Offset, version) || version == 0 || version > InputRecordingFormat::Version
+			|| !ReadValue(m_Data, m_Offset, m_FrameCount)
+			|| !ReadBits(m_Data, m_Offset, state.Keys) || !ReadBits(m_Data, m_Offset, state.MouseButtons)
+			|| !ReadValue(m_Data, m_Offset, state.MouseX) || !ReadValue(m_Data, m_Offset, state.MouseY))
+		{
+			VT_CORE_ERROR("Unsupported Input Recording '{0}' (Version {1}).", p_Filepath, version);
+			return false;
+		}
+
+		Input::SetState(state);
+		m_Frame = 0;
+		m_Playing = true;
+
+		VT_CORE_INFO("Playing Back Input From '{0}', {1} Frames.", p_Filepath, m_FrameCount);
+		return true;
+	}
+
+	/**
+	 * @brief Stops the playback and frees the recording.
+	 */
+	void InputPlayback::End()
+	{
+		m_Playing = false;
+		m_Data.clear();
+		m_Data.shrink_to_fit();
+		m_Offset = 0;
+	}
+
+	/**
+	 * @brief Sends the events of the next frame to the callback.
+	 * @param p_Callback The event callback.
+	 * @param p_Timestep The recorded timestep of the frame.
+	 * @returns False once the recording has no frames left.
+	 */
+	bool InputPlayback::NextFrame(const EventCallback& p_Callback, Timestep& p_Timestep)
+	{
+		float seconds;
+		uint16_t eventCount;
+		if (!m_Playing || m_Frame >= m_FrameCount
+			|| !ReadValue(m_Data, m_Offset, seconds) || !ReadValue(m_Data, m_Offset, eventCount))
+			return false;
+
+		for (uint16_t i = 0; i < eventCount; i++)
+		{
+			uint8_t type;
+			uint16_t code, repeat;
+			uint32_t width, height;
+			float x, y;
+			if (!ReadValue(m_Data, m_Offset, type))
+				return false;
+
+			switch ((EventType)type)
+			{
+				case EventType::KeyPressed:
+				{
+					if (!ReadValue(m_Data, m_Offset, code) || !ReadValue(m_Data, m_Offset, repeat))
+						return false;
+					KeyPressedEvent e((KeyCode)code, repeat);
+					p_Callback(e);
+					break;
+				}
+				case EventType::KeyReleased:
+				{
+					if (!ReadValue(m_Data, m_Offset, code))
+						return false;
+					KeyReleasedEvent e((KeyCode)code);
+					p_Callback(e);
+					break;
+				}
+				case EventType::KeyTyped:
+				{
+					if (!ReadValue(m_Data, m_Offset, code))
+						return false;
+					KeyTypedEvent e((KeyCode)code);
+					p_Callback(e);
+					break;
+				}
+				case EventType::MouseButtonPressed:
+				{
+					if (!ReadValue(m_Data, m_Offset, code))
+						return false;
+					MouseButtonPressedEvent e((MouseCode)code);
+					p_Callback(e);
+					break;
+				}
+				case EventType::MouseButtonReleased:
+				{
+					if (!ReadValue(m_Data, m_Offset, code))
+						return false;
+					MouseButtonReleasedEvent e((MouseCode)code);
+					p_Callback(e);
+					break;
+				}
+				case EventType::MouseMoved:
+				{
+					if (!ReadValue(m_Data, m_Offset, x) || !ReadValue(m_Data, m_Offset, y))
+						return false;
+					MouseMovedEvent e(x, y);
+					p_Callback(e);
+					break;
+				}
+				case EventType::MouseScrolled:
+				{
+					if (!ReadValue(m_Data, m_Offset, x) || !ReadValue(m_Data, m_Offset, y))
+						return false;
+					MouseScrolledEvent e(x, y);
+					p_Callback(e);
+					break;
+				}
+				case EventType::WindowResize:
+				{
+					if (!ReadValue(m_Data, m_Offset, width) || !ReadValue(m_Data, m_Offset, height))
+						return false;
+					WindowResizeEvent e(width, height);
+					p_Callback(e);
+					break;
+				}
+				default:
+					VT_CORE_ERROR("Corrupt Input Recording At Frame {0}.", m_Frame);
+					return false;
+			}
+		}
+
+		p_Timestep = seconds;
+		m_Frame++;
+		return true;
+	}
+}
\ No newline at end of file
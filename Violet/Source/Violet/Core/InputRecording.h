@@ -0,0 +1,102 @@
+/////////////////
+///
+/// InputRecording.h
+/// Violet McAllister
+/// July 26th, 2022
+/// Updated: August 6th, 2022
+///
+/// Records the input events and timestep of every
+/// frame to a compact binary file, and plays them
+/// back so runs of the same scenario are
+/// reproducible.
+///
+/// Usage: <app> --replay <file.vtir> plays a recording
+/// and closes when it ends, --record <file.vtir>
+/// records from the first frame.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_CORE_INPUT_RECORDING_H_INCLUDED__
+#define __VIOLET_ENGINE_CORE_INPUT_RECORDING_H_INCLUDED__
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Violet/Core/Timestep.h"
+#include "Violet/Events/Event.h"
+#include "Violet/Events/EventCallback.h"
+
+namespace Violet
+{
+	/**
+	 * @brief The layout of an input recording. All values are
+	 * written little endian byte by byte, whatever the host.
+	 * 
+	 * Header: "VTIR", Version (u32), FrameCount (u32), the held keys
+	 * and mouse buttons as bitsets and the mouse position (2 x f32).
+	 * 
+	 * Frame: Timestep (f32), EventCount (u16), then per event its
+	 * EventType (u8) followed by the arguments of the event.
+	 * 
+	 * Version 2 added window resizes, width and height (2 x u32).
+	 */
+	struct InputRecordingFormat
+	{
+		static constexpr char Magic[4] = { 'V', 'T', 'I', 'R' };
+		static constexpr uint32_t Version = 2;
+	};
+
+	/**
+	 * @brief Writes the input events of every frame to a file.
+	 * Events in EventCategoryInput are recorded, along with window
+	 * resizes since input coordinates depend on the window size.
+	 */
+	class InputRecorder
+	{
+	public: // Constructors & Deconstructors
+		InputRecorder() = default;
+		~InputRecorder() { End(); }
+	public: // Main Functionality
+		bool Begin(const std::string& p_Filepath);
+		void End();
+
+		void RecordEvent(Event& p_Event);
+		void EndFrame(Timestep p_Timestep);
+	public: // Getters
+		bool IsRecording() const { return m_Output.is_open(); }
+		uint32_t GetFrameCount() const { return m_FrameCount; }
+	private: // Private Member Variables
+		std::ofstream m_Output;
+		std::vector<uint8_t> m_FrameEvents;
+		uint16_t m_FrameEventCount = 0;
+		uint32_t m_FrameCount = 0;
+	};
+
+	/**
+	 * @brief Reads an input recording and replays it a frame at
+	 * a time. Begin restores the input state the recording
+	 * started with.
+	 */
+	class InputPlayback
+	{
+	public: // Main Functionality
+		bool Begin(const std::string& p_Filepath);
+		void End();
+
+		bool NextFrame(const EventCallback& p_Callback, Timestep& p_Timestep);
+	public: // Getters
+		bool IsPlaying() const { return m_Playing; }
+		uint32_t GetFrame() const { return m_Frame; }
+		uint32_t GetFrameCount() const { return m_FrameCount; }
+	private: // Private Member Variables
+		std::vector<uint8_t> m_Data;
+		size_t m_Offset = 0;
+		uint32_t m_Frame = 0;
+		uint32_t m_FrameCount = 0;
+		bool m_Playing = false;
+	};
+}
+
+#endif // __VIOLET_ENGINE_CORE_INPUT_RECORDING_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,59 @@
+/////////////////
+///
+/// InputState.h
+/// Violet McAllister
+/// July 25th, 2022
+///
+/// A snapshot of the keyboard and mouse built from
+/// the event stream once per frame.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_CORE_INPUT_STATE_H_INCLUDED__
+#define __VIOLET_ENGINE_CORE_INPUT_STATE_H_INCLUDED__
+
+#include <bitset>
+#include <cstdint>
+
+#include "Violet/Core/KeyCodes.h"
+#include "Violet/Core/MouseCodes.h"
+
+namespace Violet
+{
+	/**
+	 * @brief The state of every key and mouse button. The pressed
+	 * and released sets only hold the edges of the current frame.
+	 */
+	struct InputState
+	{
+	public: // Constants
+		static constexpr uint32_t KeyCount = 512;
+		static constexpr uint32_t MouseButtonCount = 8;
+	public: // Public Member Variables
+		std::bitset<KeyCount> Keys;
+		std::bitset<KeyCount> KeysPressed;
+		std::bitset<KeyCount> KeysReleased;
+
+		std::bitset<MouseButtonCount> MouseButtons;
+		std::bitset<MouseButtonCount> MouseButtonsPressed;
+		std::bitset<MouseButtonCount> MouseButtonsReleased;
+
+		float MouseX = 0.0f, MouseY = 0.0f;
+		float ScrollX = 0.0f, ScrollY = 0.0f;
+	public: // Main Functionality
+		/**
+		 * @brief Clears the edges and scrolling of the last frame,
+		 * keeping what is held down.
+		 */
+		void NewFrame()
+		{
+			KeysPressed.reset();
+			KeysReleased.reset();
+			MouseButtonsPressed.reset();
+			MouseButtonsReleased.reset();
+			ScrollX = ScrollY = 0.0f;
+		}
+	};
+}
+
+#endif // __VIOLET_ENGINE_CORE_INPUT_STATE_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,409 @@
+/////////////////
+///
+/// JobSystem.cpp
+/// Violet McAllister
+/// July 28th, 2022
+/// Updated: August 6th, 2022
+///
+/// Contains implementations for the job system
+/// and its work-stealing deque.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Core/JobSystem.h"
+
+#include <condition_variable>
+
+namespace Violet
+{
+	/**
+	 * @brief A fixed size Chase-Lev deque. The owning thread pushes
+	 * and pops at the bottom, other threads steal from the top.
+	 */
+	class WorkStealingQueue
+	{
+	public: // Constants
+		static constexpr int64_t Capacity = JobSystem::JobCapacity;
+	public: // Main Functionality
+		/**
+		 * @brief Pushes a job, owning thread only.
+		 * @param p_Job The job.
+		 * @returns False when the queue is full.
+		 */
+		bool Push(Job* p_Job)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			if (bottom - top >= Capacity)
+				return false;
+
+			m_Jobs[bottom & (Capacity - 1)].store(p_Job, std::memory_order_relaxed);
+			m_Bottom.store(bottom + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * @brief Pops the newest job, owning thread only.
+		 * @returns The job, or nullptr when empty.
+		 */
+		Job* Pop()
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			Job* job = m_Jobs[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// The last job, race the stealers for it.
+				if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					job = nullptr;
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			return job;
+		}
+
+		/**
+		 * @brief Steals the oldest job, any thread.
+		 * @returns The job, or nullptr when empty or contended.
+		 */
+		Job* Steal()
+		{
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+			if (top >= bottom)
+				return nullptr;
+
+			Job* job = m_Jobs[top & (Capacity - 1)].load(std::memory_order_relaxed);
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+
+			return job;
+		}
+	private: // Private Member Variables
+		std::atomic<Job*> m_Jobs[Capacity] = {};
+		alignas(64) std::atomic<int64_t> m_Top = 0;
+		alignas(64) std::atomic<int64_t> m_Bottom = 0;
+	};
+
+	/**
+	 * @brief The queue and job ring of one thread. Thread 0 is the
+	 * main thread.
+	 */
+	struct JobThreadData
+	{
+		WorkStealingQueue Queue;
+		Job Jobs[JobSystem::JobCapacity];
+		uint32_t NextJob = 0;
+	};
+
+	/**
+	 * @brief The state shared by every thread of the job system.
+	 */
+	struct JobSystemData
+	{
+		std::vector<std::unique_ptr<JobThreadData>> Threads;
+		std::vector<std::thread> Workers;
+		std::atomic<bool> Running = false;
+
+		// Idle workers sleep until a job is submitted.
+		std::mutex SleepMutex;
+		std::condition_variable SleepCondition;
+		std::atomic<int32_t> PendingJobs = 0;
+		std::atomic<uint32_t> SleepingWorkers = 0;
+
+		// Jobs held back until their dependency reaches zero, never queued before then.
+		std::mutex ParkedMutex;
+		std::vector<Job*> ParkedJobs;
+		std::atomic<uint32_t> ParkedCount = 0;
+	};
+
+	static JobSystemData s_Data;
+	static thread_local uint32_t s_ThreadIndex = UINT32_MAX;
+
+	static void Enqueue(Job* p_Job);
+
+	/**
+	 * @brief Holds a job back until its dependency reaches zero.
+	 * The count is raised before the dependency is read, and the
+	 * last job of a counter lowers it before reading the count, so
+	 * one of the two always sees the other.
+	 * @param p_Job The job, with a dependency.
+	 * @returns False when the dependency is already done.
+	 */
+	static bool Park(Job* p_Job)
+	{
+		std::lock_guard lock(s_Data.ParkedMutex);
+		s_Data.ParkedCount.fetch_add(1);
+		if (p_Job->Dependency->load() == 0)
+		{
+			s_Data.ParkedCount.fetch_sub(1);
+			return false;
+		}
+
+		s_Data.ParkedJobs.push_back(p_Job);
+		return true;
+	}
+
+	/**
+	 * @brief Takes a job parked on a counter off the parked list.
+	 * @param p_Counter The counter which reached zero.
+	 * @returns The job, or nullptr when none waits on it.
+	 */
+	static Job* Unpark(const JobCounter* p_Counter)
+	{
+		std::lock_guard lock(s_Data.ParkedMutex);
+		for (Job*& job : s_Data.ParkedJobs)
+		{
+			if (job->Dependency != p_Counter)
+				continue;
+
+			Job* parked = job;
+			job = s_Data.ParkedJobs.back();
+			s_Data.ParkedJobs.pop_back();
+			s_Data.ParkedCount.fetch_sub(1);
+			return parked;
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * @brief Runs a job and signals its counter, queueing the jobs
+	 * parked on it once it reaches zero.
+	 * @param p_Job The job.
+	 */
+	static void Execute(Job* p_Job)
+	{
+		{
+			VT_PROFILE_SCOPE_DYNAMIC(p_Job->Name);
+			p_Job->Function(*p_Job);
+		}
+
+		if (!p_Job->Counter || p_Job->Counter->fetch_sub(1) != 1 || s_Data.ParkedCount.load() == 0)
+			return;
+
+		while (Job* parked = Unpark(p_Job->Counter))
+			Enqueue(parked);
+	}
+
+	/**
+	 * @brief Queues a job on the calling thread and wakes a
+	 * sleeping worker. Runs the job right away when the queue is full.
+	 * @param p_Job The job, with its dependency done.
+	 */
+	static void Enqueue(Job* p_Job)
+	{
+		if (!s_Data.Threads[s_ThreadIndex]->Queue.Push(p_Job))
+		{
+			Execute(p_Job);
+			return;
+		}
+
+		s_Data.PendingJobs.fetch_add(1);
+		if (s_Data.SleepingWorkers.load() > 0)
+		{
+			std::lock_guard lock(s_Data.SleepMutex);
+			s_Data.SleepCondition.notify_one();
+		}
+	}
+
+	/**
+	 * @brief Runs one job, popping from the thread's own queue or
+	 * stealing from another.
+	 * @returns Whether a job ran.
+	 */
+	static bool RunOne()
+	{
+		uint32_t threadCount = (uint32_t)s_Data.Threads.size();
+		JobThreadData& self = *s_Data.Threads[s_ThreadIndex];
+
+		Job* job = self.Queue.Pop();
+		for (uint32_t i = 1; !job && i < threadCount; i++)
+			job = s_Data.Threads[(s_ThreadIndex + i) % threadCount]->Queue.Steal();
+
+		if (!job)
+			return false;
+
+		s_Data.PendingJobs.fetch_sub(1, std::memory_order_relaxed);
+
+		Execute(job);
+		return true;
+	}
+
+	/**
+	 * @brief The loop of a worker thread.
+	 * @param p_Index The thread index of the worker.
+	 */
+	static void WorkerMain(uint32_t p_Index)
+	{
+		s_ThreadIndex = p_Index;
+
+		char name[32];
+		snprintf(name, sizeof(name), "Worker %u", p_Index);
+		VT_PROFILE_THREAD(name);
+
+		uint32_t idleSpins = 0;
+		while (s_Data.Running.load(std::memory_order_acquire))
+		{
+			if (RunOne())
+			{
+				idleSpins = 0;
+				continue;
+			}
+
+			if (++idleSpins < 64)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			s_Data.SleepingWorkers.fetch_add(1);
+			{
+				std::unique_lock lock(s_Data.SleepMutex);
+				s_Data.SleepCondition.wait(lock, []() { return s_Data.PendingJobs.load() > 0 || !s_Data.Running.load(); });
+			}
+			s_Data.SleepingWorkers.fetch_sub(1);
+			idleSpins = 0;
+		}
+	}
+
+	/**
+	 * @brief Starts the workers. The calling thread becomes the
+	 * main thread of the job system.
+	 * @param p_WorkerCount The number of workers, one less than
+	 * the number of cores when zero.
+	 */
+	void JobSystem::Init(uint32_t p_WorkerCount)
+	{
+		VT_PROFILE_FUNCTION();
+
+		if (p_WorkerCount == 0)
+			p_WorkerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+		for (uint32_t i = 0; i < p_WorkerCount + 1; i++)
+			s_Data.Threads.push_back(CreateScope<JobThreadData>());
+		s_Data.ParkedJobs.reserve(JobCapacity);
+
+		s_ThreadIndex = 0;
+		VT_PROFILE_THREAD("Main Thread");
+
+		s_Data.Running.store(true, std::memory_order_release);
+		for (uint32_t i = 1; i <= p_WorkerCount; i++)
+			s_Data.Workers.emplace_back(WorkerMain, i);
+
+		VT_CORE_INFO("Job System Started With {0} Workers.", p_WorkerCount);
+	}
+
+	/**
+	 * @brief Stops and joins the workers. Jobs still queued or
+	 * parked are dropped, so wait on their counters first.
+	 */
+	void JobSystem::Shutdown()
+	{
+		VT_PROFILE_FUNCTION();
+
+		{
+			std::lock_guard lock(s_Data.SleepMutex);
+			s_Data.Running.store(false, std::memory_order_release);
+		}
+		s_Data.SleepCondition.notify_all();
+
+		for (std::thread& worker : s_Data.Workers)
+			worker.join();
+
+		s_Data.Workers.clear();
+		s_Data.Threads.clear();
+		s_Data.PendingJobs.store(0);
+		s_Data.ParkedJobs.clear();
+		s_Data.ParkedCount.store(0);
+		s_ThreadIndex = UINT32_MAX;
+	}
+
+	/**
+	 * @brief Runs jobs on the calling thread until the counter
+	 * reaches zero.
+	 * @param p_Counter The counter to wait on.
+	 */
+	void JobSystem::Wait(const JobCounter& p_Counter)
+	{
+		if (p_Counter.load(std::memory_order_acquire) == 0)
+			return;
+
+		VT_PROFILE_SCOPE("JobSystem::Wait");
+
+		VT_CORE_ASSERT(s_ThreadIndex != UINT32_MAX, "Only Job System Threads Can Wait On Jobs!");
+		while (p_Counter.load(std::memory_order_acquire) > 0)
+		{
+			if (!RunOne())
+				std::this_thread::yield();
+		}
+	}
+
+	/**
+	 * @brief Runs one queued job on the calling thread, if any,
+	 * for threads polling for something other than a counter.
+	 * @returns Whether a job ran.
+	 */
+	bool JobSystem::TryRunJob()
+	{
+		if (s_ThreadIndex == UINT32_MAX || !IsRunning())
+			return false;
+
+		return RunOne();
+	}
+
+	/**
+	 * @brief Checks whether the workers are running.
+	 * @returns If jobs run on the workers.
+	 */
+	bool JobSystem::IsRunning()
+	{
+		return s_Data.Running.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief Gets the number of worker threads.
+	 * @returns The number of workers, not counting the main thread.
+	 */
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		return (uint32_t)s_Data.Workers.size();
+	}
+
+	/**
+	 * @brief Takes the next job from the calling thread's ring.
+	 * @returns The job.
+	 */
+	Job* JobSystem::AllocateJob()
+	{
+		VT_CORE_ASSERT(s_ThreadIndex != UINT32_MAX, "Jobs Can Only Be Scheduled From Job System Threads!");
+
+		JobThreadData& thread = *s_Data.Threads[s_ThreadIndex];
+		return &thread.Jobs[thread.NextJob++ % JobCapacity];
+	}
+
+	/**
+	 * @brief Queues a job, or parks it when its dependency is not
+	 * done yet. The job finishing the dependency queues it then.
+	 * @param p_Job The job.
+	 */
+	void JobSystem::Submit(Job* p_Job)
+	{
+		if (p_Job->Dependency && Park(p_Job))
+			return;
+
+		Enqueue(p_Job);
+	}
+}
\ No newline at end of file
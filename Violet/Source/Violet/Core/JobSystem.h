@@ -0,0 +1,134 @@
+/////////////////
+///
+/// JobSystem.h
+/// Violet McAllister
+/// July 28th, 2022
+/// Updated: August 6th, 2022
+///
+/// A job system with one worker per core. Every
+/// thread owns a work-stealing deque, idle threads
+/// steal from the others, and a thread waiting on
+/// a counter runs jobs until it completes.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_CORE_JOB_SYSTEM_H_INCLUDED__
+#define __VIOLET_ENGINE_CORE_JOB_SYSTEM_H_INCLUDED__
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace Violet
+{
+	/**
+	 * @brief Counts unfinished jobs. Scheduling a job with a counter
+	 * increments it and finishing the job decrements it, so a
+	 * counter reaching zero means all of its jobs are done.
+	 */
+	using JobCounter = std::atomic<uint32_t>;
+
+	/**
+	 * @brief A unit of work. The callable is stored inline, so
+	 * scheduling never allocates.
+	 */
+	struct Job
+	{
+		static constexpr size_t StorageSize = 64;
+
+		void (*Function)(Job& p_Job) = nullptr;
+		const char* Name = nullptr;
+		JobCounter* Counter = nullptr;
+		const JobCounter* Dependency = nullptr;
+		alignas(16) uint8_t Storage[StorageSize];
+	};
+
+	/**
+	 * @brief Runs jobs on a pool of worker threads. Jobs may only
+	 * be scheduled from the main thread (the one calling Init) or
+	 * from inside other jobs, and no thread may have more than
+	 * JobCapacity jobs in flight at once.
+	 */
+	class JobSystem
+	{
+	public: // Constants
+		static constexpr uint32_t JobCapacity = 4096;
+	public: // Main Functionality
+		static void Init(uint32_t p_WorkerCount = 0);
+		static void Shutdown();
+
+		/**
+		 * @brief Schedules a job. Runs it immediately when the job
+		 * system is not running.
+		 * @param p_Name The name of the job in profiles, in static storage.
+		 * @param p_Function The callable, trivially copyable and at most
+		 * Job::StorageSize bytes. Usually a lambda capturing by reference.
+		 * @param p_Counter (optional) The counter tracking the job.
+		 * @param p_Dependency (optional) A counter which must reach zero
+		 * before the job runs. Until then the job is parked, not queued.
+		 */
+		template<typename F>
+		static void Schedule(const char* p_Name, F&& p_Function, JobCounter* p_Counter = nullptr, const JobCounter* p_Dependency = nullptr)
+		{
+			using Function = std::decay_t<F>;
+			static_assert(sizeof(Function) <= Job::StorageSize, "Job Captures Too Much, Capture By Reference Instead!");
+			static_assert(alignof(Function) <= 16, "Job Is Over-Aligned!");
+			static_assert(std::is_trivially_copyable_v<Function> && std::is_trivially_destructible_v<Function>, "Jobs Must Be Trivially Copyable!");
+
+			if (!IsRunning())
+			{
+				p_Function();
+				return;
+			}
+
+			Job* job = AllocateJob();
+			new (job->Storage) Function(std::forward<F>(p_Function));
+			job->Function = [](Job& p_Job) { (*std::launder(reinterpret_cast<Function*>(p_Job.Storage)))(); };
+			job->Name = p_Name;
+			job->Counter = p_Counter;
+			job->Dependency = p_Dependency;
+
+			if (p_Counter)
+				p_Counter->fetch_add(1, std::memory_order_relaxed);
+			Submit(job);
+		}
+
+		static void Wait(const JobCounter& p_Counter);
+		static bool TryRunJob();
+
+		/**
+		 * @brief Calls a function for every index in [0, p_Count) in
+		 * batches spread over the workers, and waits for all of them.
+		 * @param p_Name The name of the batch jobs in profiles.
+		 * @param p_Count The number of indices.
+		 * @param p_BatchSize The number of indices per job.
+		 * @param p_Function The function, called as p_Function(index).
+		 */
+		template<typename F>
+		static void ParallelFor(const char* p_Name, uint32_t p_Count, uint32_t p_BatchSize, const F& p_Function)
+		{
+			JobCounter counter = 0;
+			p_BatchSize = std::max(p_BatchSize, 1u);
+			for (uint32_t begin = 0; begin < p_Count; begin += p_BatchSize)
+			{
+				uint32_t end = std::min(begin + p_BatchSize, p_Count);
+				Schedule(p_Name, [&p_Function, begin, end]()
+				{
+					for (uint32_t index = begin; index < end; index++)
+						p_Function(index);
+				}, &counter);
+			}
+			Wait(counter);
+		}
+	public: // Getters
+		static bool IsRunning();
+		static uint32_t GetWorkerCount();
+	private: // Helper
+		static Job* AllocateJob();
+		static void Submit(Job* p_Job);
+	};
+}
+
+#endif // __VIOLET_ENGINE_CORE_JOB_SYSTEM_H_INCLUDED__
\ No newline at end of file
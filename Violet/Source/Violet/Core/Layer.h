@@ -3,7 +3,7 @@
 /// Layer.h
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// A layer object is used as the main object where
 /// code is written and allows for multiple render layers.
@@ -17,6 +17,7 @@
 #define __VIOLET_ENGINE_CORE_LAYER_H_INCLUDED__
 
 #include "Violet/Core/Base.h"
+#include "Violet/Core/StartupSequence.h"
 #include "Violet/Core/Timestep.h"
 #include "Violet/Events/Event.h"
 
@@ -37,15 +38,32 @@ namespace Violet
 			: m_DebugName(p_Name) { }
 		virtual ~Layer() = default;
 	public: // Main Functionality
+		/**
+		 * @brief Adds the stages the layer needs before it attaches,
+		 * such as decoding its assets on a worker. OnAttach runs once
+		 * every stage has finished.
+		 * @param p_Sequence The startup sequence.
+		 */
+		virtual void OnStartup(StartupSequence& p_Sequence) {}
 		virtual void OnAttach() {}
 		virtual void OnDetach() {}
 		virtual void OnUpdate(Timestep p_Timestep) {}
+		virtual void OnFixedUpdate(Timestep p_FixedTimestep) {}
 		virtual void OnImGuiRender() {}
 		virtual void OnEvent(Event& p_Event) {}
-	public: // Getters
+	public: // Getters & Setters
 		const std::string& GetName() const { return m_DebugName; }
+
+		/**
+		 * @brief Sets the event categories the layer receives, the
+		 * LayerStack skips the layer for any other event.
+		 * @param p_Categories A mask of EventCategory values.
+		 */
+		void SetEventCategories(int p_Categories) { m_EventCategories = p_Categories; }
+		int GetEventCategories() const { return m_EventCategories; }
 	protected: // Protected Member Variables
 		std::string m_DebugName;
+		int m_EventCategories = EventCategoryAll;
 	};
 }
 
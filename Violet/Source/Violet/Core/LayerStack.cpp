@@ -3,7 +3,7 @@
 /// LayerStack.cpp
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 15th, 2022
+/// Updated: July 24th, 2022
 ///
 /// An object which contains and allows for the application
 /// to easily iterate through layers, and for the user to
@@ -83,4 +83,22 @@ namespace Violet
 			m_Layers.erase(it);
 		}
 	}
+
+	/**
+	 * @brief Passes an event from the top of the LayerStack down
+	 * until it is handled, skipping layers which are not
+	 * registered for any of its categories.
+	 * @param p_Event The event to pass down.
+	 */
+	void LayerStack::OnEvent(Event& p_Event)
+	{
+		int categories = p_Event.GetCategoryFlags();
+		for (auto it = m_Layers.rbegin(); it != m_Layers.rend(); ++it)
+		{
+			if (p_Event.Handled)
+				break;
+			if ((*it)->GetEventCategories() & categories)
+				(*it)->OnEvent(p_Event);
+		}
+	}
 }
\ No newline at end of file
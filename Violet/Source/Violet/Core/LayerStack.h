@@ -3,7 +3,7 @@
 /// LayerStack.h
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 16th, 2022
+/// Updated: July 24th, 2022
 ///
 /// An object which contains and allows for the application
 /// to easily iterate through layers, and for the user to
@@ -35,6 +35,8 @@ namespace Violet
 		void PushOverlay(Layer* p_Overlay);
 		void PopLayer(Layer* p_Layer);
 		void PopOverlay(Layer* p_Overlay);
+
+		void OnEvent(Event& p_Event);
 	public: // Vector Overrides, allowing for easy iterations
 		std::vector<Layer*>::iterator begin() { return m_Layers.begin(); }
 		std::vector<Layer*>::iterator end() { return m_Layers.end(); }
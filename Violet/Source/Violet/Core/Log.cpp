@@ -3,7 +3,7 @@
 /// Log.cpp
 /// Violet McAllister
 /// June 30th, 2022
-/// Updated: July 15th, 2022
+/// Updated: July 31st, 2022
 ///
 /// Contains class implementations for the Log
 /// object.
@@ -19,14 +19,16 @@
 
 namespace Violet
 {
-	Ref<spdlog::logger> Log::s_CoreLogger;
-	Ref<spdlog::logger> Log::s_ClientLogger;
+	std::shared_ptr<spdlog::logger> Log::s_CoreLogger;
+	std::shared_ptr<spdlog::logger> Log::s_ClientLogger;
+	std::shared_ptr<AsyncLogSink> Log::s_AsyncSink;
 
 	/**
 	 * @brief Initializes the logger and file logging
 	 * systems.
+	 * @param p_Settings The settings for the logging system.
 	 */
-	void Log::Init()
+	void Log::Init(const LogSettings& p_Settings)
 	{
 		// Setup Log Sinks
 		std::vector<spdlog::sink_ptr> logSinks;
@@ -36,16 +38,44 @@ namespace Violet
 		logSinks[0]->set_pattern("%^[%T] %n: %v%$");
 		logSinks[1]->set_pattern("[%T] [%l] %n: %v");
 
+		// Both loggers share one queue and background thread.
+		if (p_Settings.Async)
+		{
+			s_AsyncSink = std::make_shared<AsyncLogSink>(logSinks, p_Settings.AsyncSettings);
+			logSinks = { s_AsyncSink };
+		}
+
 		// Setup Core Logger
 		s_CoreLogger = std::make_shared<spdlog::logger>("HAZEL", begin(logSinks), end(logSinks));
 		spdlog::register_logger(s_CoreLogger);
 		s_CoreLogger->set_level(spdlog::level::trace);
-		s_CoreLogger->flush_on(spdlog::level::trace);
+		s_CoreLogger->flush_on(p_Settings.FlushLevel);
 
 		// Setup Client Logger
 		s_ClientLogger = std::make_shared<spdlog::logger>("APP", begin(logSinks), end(logSinks));
 		spdlog::register_logger(s_ClientLogger);
 		s_ClientLogger->set_level(spdlog::level::trace);
-		s_ClientLogger->flush_on(spdlog::level::trace);
+		s_ClientLogger->flush_on(p_Settings.FlushLevel);
+	}
+
+	/**
+	 * @brief Writes out every queued message and stops the
+	 * background thread. Later messages are written directly.
+	 */
+	void Log::Shutdown()
+	{
+		if (s_AsyncSink)
+		{
+			s_AsyncSink->Stop();
+			s_CoreLogger->sinks() = s_AsyncSink->GetTargets();
+			s_ClientLogger->sinks() = s_AsyncSink->GetTargets();
+
+			if (uint64_t dropped = s_AsyncSink->GetDroppedCount())
+				VT_CORE_WARN("{0} Log Messages Were Dropped.", dropped);
+			s_AsyncSink.reset();
+		}
+
+		s_CoreLogger->flush();
+		s_ClientLogger->flush();
 	}
 }
\ No newline at end of file
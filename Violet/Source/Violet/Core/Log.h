@@ -3,13 +3,17 @@
 /// Log.h
 /// Violet McAllister
 /// June 30th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Contains class information for logging. Utilizes
 /// a static "singleton" like object in order to initialize
 /// the logging objects. Otherwise uses macros in order to
 /// log.
 ///
+/// Messages are written on a background thread
+/// unless async logging is turned off, and levels
+/// below VT_LOG_LEVEL are compiled out.
+///
 /////////////////
 
 #ifndef __VIOLET_ENGINE_LOG_H_INCLUDED__
@@ -18,17 +22,48 @@
 #include <spdlog/spdlog.h>
 #include <spdlog/fmt/ostr.h>
 
+#include "Violet/Core/AsyncLogSink.h"
 #include "Violet/Core/Base.h"
 
+// Log levels, matching spdlog.
+#define VT_LOG_LEVEL_TRACE 0
+#define VT_LOG_LEVEL_INFO 2
+#define VT_LOG_LEVEL_WARN 3
+#define VT_LOG_LEVEL_ERROR 4
+#define VT_LOG_LEVEL_CRITICAL 5
+
+// Calls below this level are removed entirely, Release and Dist keep warnings and up.
+#ifndef VT_LOG_LEVEL
+	#ifdef VT_DEBUG
+		#define VT_LOG_LEVEL VT_LOG_LEVEL_TRACE
+	#else
+		#define VT_LOG_LEVEL VT_LOG_LEVEL_WARN
+	#endif
+#endif
+
 namespace Violet
 {
+	/**
+	 * @brief Contains the settings of the logging system.
+	 */
+	struct LogSettings
+	{
+		// Write messages on a background thread instead of the calling thread.
+		bool Async = true;
+		AsyncLogSettings AsyncSettings;
+
+		// Messages at or above this level are written out before the call returns.
+		spdlog::level::level_enum FlushLevel = spdlog::level::err;
+	};
+
 	/**
 	 * @brief Defines the functionality of the logger object.
 	 */
 	class Log
 	{
 	public:
-		static void Init();
+		static void Init(const LogSettings& p_Settings = LogSettings());
+		static void Shutdown();
 	public:
 		/**
 		 * @brief Get the Core Logger object.
@@ -36,7 +71,7 @@ namespace Violet
 		 * @return std::shared_ptr<spdlog::logger>& 
 		 * @returns The core logger object.
 		 */
-		static Ref<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
+		static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
 		
 		/**
 		 * @brief Get the Client Logger object
@@ -44,25 +79,59 @@ namespace Violet
 		 * @return std::shared_ptr<spdlog::logger>& 
 		 * @returns The client logger object.
 		 */
-		static Ref<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
+		static std::shared_ptr<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
+
+		/**
+		 * @brief Takes the arguments of a compiled out log call, only
+		 * ever inside sizeof, so they count as used without running.
+		 * @returns Nothing useful.
+		 */
+		template<typename... Args>
+		static constexpr int Discard(const Args&...) { return 0; }
 	private:
-		static Ref<spdlog::logger> s_CoreLogger;
-		static Ref<spdlog::logger> s_ClientLogger;
+		static std::shared_ptr<spdlog::logger> s_CoreLogger;
+		static std::shared_ptr<spdlog::logger> s_ClientLogger;
+		static std::shared_ptr<AsyncLogSink> s_AsyncSink;
 	};
 }
 
+// Compiled out calls still name their arguments, so values only logged stay used.
+#define VT_LOG_DISCARD(...)     (void)sizeof(::Violet::Log::Discard(__VA_ARGS__))
+
 // Core log macros
-#define VT_CORE_TRACE(...)    	::Violet::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define VT_CORE_INFO(...)     	::Violet::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define VT_CORE_WARN(...)     	::Violet::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define VT_CORE_ERROR(...)    	::Violet::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define VT_CORE_CRITICAL(...)   ::Violet::Log::GetCoreLogger()->critical(__VA_ARGS__)
+#if VT_LOG_LEVEL <= VT_LOG_LEVEL_TRACE
+	#define VT_CORE_TRACE(...)    	::Violet::Log::GetCoreLogger()->trace(__VA_ARGS__)
+	#define VT_TRACE(...)	      	::Violet::Log::GetClientLogger()->trace(__VA_ARGS__)
+#else
+	#define VT_CORE_TRACE(...)    	VT_LOG_DISCARD(__VA_ARGS__)
+	#define VT_TRACE(...)	      	VT_LOG_DISCARD(__VA_ARGS__)
+#endif
 
-// Client log macros
-#define VT_TRACE(...)	      	::Violet::Log::GetClientLogger()->trace(__VA_ARGS__)
-#define VT_INFO(...)	      	::Violet::Log::GetClientLogger()->info(__VA_ARGS__)
-#define VT_WARN(...)	      	::Violet::Log::GetClientLogger()->warn(__VA_ARGS__)
-#define VT_ERROR(...)	      	::Violet::Log::GetClientLogger()->error(__VA_ARGS__)
-#define VT_CRITICAL(...)	    ::Violet::Log::GetClientLogger()->critical(__VA_ARGS__) 
+#if VT_LOG_LEVEL <= VT_LOG_LEVEL_INFO
+	#define VT_CORE_INFO(...)     	::Violet::Log::GetCoreLogger()->info(__VA_ARGS__)
+	#define VT_INFO(...)	      	::Violet::Log::GetClientLogger()->info(__VA_ARGS__)
+#else
+	#define VT_CORE_INFO(...)     	VT_LOG_DISCARD(__VA_ARGS__)
+	#define VT_INFO(...)	      	VT_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if VT_LOG_LEVEL <= VT_LOG_LEVEL_WARN
+	#define VT_CORE_WARN(...)     	::Violet::Log::GetCoreLogger()->warn(__VA_ARGS__)
+	#define VT_WARN(...)	      	::Violet::Log::GetClientLogger()->warn(__VA_ARGS__)
+#else
+	#define VT_CORE_WARN(...)     	VT_LOG_DISCARD(__VA_ARGS__)
+	#define VT_WARN(...)	      	VT_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#if VT_LOG_LEVEL <= VT_LOG_LEVEL_ERROR
+	#define VT_CORE_ERROR(...)    	::Violet::Log::GetCoreLogger()->error(__VA_ARGS__)
+	#define VT_ERROR(...)	      	::Violet::Log::GetClientLogger()->error(__VA_ARGS__)
+#else
+	#define VT_CORE_ERROR(...)    	VT_LOG_DISCARD(__VA_ARGS__)
+	#define VT_ERROR(...)	      	VT_LOG_DISCARD(__VA_ARGS__)
+#endif
+
+#define VT_CORE_CRITICAL(...)   ::Violet::Log::GetCoreLogger()->critical(__VA_ARGS__)
+#define VT_CRITICAL(...)	    ::Violet::Log::GetClientLogger()->critical(__VA_ARGS__)
 
 #endif // __VIOLET_ENGINE_LOG_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,205 @@
+/////////////////
+///
+/// Ref.h
+/// Violet McAllister
+/// July 30th, 2022
+/// Updated: August 6th, 2022
+///
+/// Intrusive reference counting. The count lives
+/// inside the object, so a Ref is a single pointer
+/// with no separate control block.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_CORE_REF_H_INCLUDED__
+#define __VIOLET_ENGINE_CORE_REF_H_INCLUDED__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace Violet
+{
+	/**
+	 * @brief Base of every object held by a Ref. The thread safe
+	 * version counts atomically, the other one is cheaper but
+	 * its Refs may only be copied and released on one thread
+	 * at a time, like renderer resources which only live on
+	 * the thread owning the graphics context.
+	 */
+	template<bool ThreadSafe>
+	class RefCountedBase
+	{
+	public: // Constructors & Deconstructors
+		RefCountedBase() = default;
+		virtual ~RefCountedBase() = default;
+
+		// Copies are new objects, they do not share the count.
+		RefCountedBase(const RefCountedBase&) { }
+		RefCountedBase& operator=(const RefCountedBase&) { return *this; }
+	public: // Main Functionality
+		/**
+		 * @brief Adds a reference to the object.
+		 */
+		void IncRef() const
+		{
+			if constexpr (ThreadSafe)
+				m_RefCount.fetch_add(1, std::memory_order_relaxed);
+			else
+				m_RefCount++;
+		}
+
+		/**
+		 * @brief Removes a reference from the object.
+		 * @returns If it was the last reference.
+		 */
+		bool DecRef() const
+		{
+			if constexpr (ThreadSafe)
+				return m_RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+			else
+				return --m_RefCount == 0;
+		}
+	public: // Getters
+		uint32_t GetRefCount() const { return m_RefCount; }
+	private: // Private Member Variables
+		mutable std::conditional_t<ThreadSafe, std::atomic<uint32_t>, uint32_t> m_RefCount = 0;
+	};
+
+	using RefCounted = RefCountedBase<true>;
+	using SingleThreadRefCounted = RefCountedBase<false>;
+
+	/**
+	 * @brief Refs are similar to Scopes except that multiple
+	 * references can be made to that place in memory, with the
+	 * same perk that once there are no more references to that
+	 * place in memory it gets deallocated. T must derive from
+	 * RefCounted or SingleThreadRefCounted.
+	 */
+	template<typename T>
+	class Ref
+	{
+	public: // Constructors & Deconstructors
+		Ref() = default;
+		Ref(std::nullptr_t) { }
+
+		explicit Ref(T* p_Instance)
+			: m_Instance(p_Instance)
+		{
+			IncRef();
+		}
+
+		Ref(const Ref& p_Other)
+			: m_Instance(p_Other.m_Instance)
+		{
+			IncRef();
+		}
+
+		Ref(Ref&& p_Other) noexcept
+			: m_Instance(p_Other.m_Instance)
+		{
+			p_Other.m_Instance = nullptr;
+		}
+
+		template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+		Ref(const Ref<U>& p_Other)
+			: m_Instance(p_Other.m_Instance)
+		{
+			IncRef();
+		}
+
+		template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+		Ref(Ref<U>&& p_Other) noexcept
+			: m_Instance(p_Other.m_Instance)
+		{
+			p_Other.m_Instance = nullptr;
+		}
+
+		~Ref()
+		{
+			DecRef();
+		}
+	public: // Operator Overrides
+		Ref& operator=(const Ref& p_Other)
+		{
+			// Adding first keeps self assignment safe.
+			p_Other.IncRef();
+			DecRef();
+			m_Instance = p_Other.m_Instance;
+			return *this;
+		}
+
+		Ref& operator=(Ref&& p_Other) noexcept
+		{
+			if (this != &p_Other)
+			{
+				DecRef();
+				m_Instance = p_Other.m_Instance;
+				p_Other.m_Instance = nullptr;
+			}
+			return *this;
+		}
+
+		Ref& operator=(std::nullptr_t)
+		{
+			DecRef();
+			m_Instance = nullptr;
+			return *this;
+		}
+
+		T* operator->() const { return m_Instance; }
+		T& operator*() const { return *m_Instance; }
+		explicit operator bool() const { return m_Instance != nullptr; }
+
+		template<typename U>
+		bool operator==(const Ref<U>& p_Other) const { return m_Instance == p_Other.get(); }
+		template<typename U>
+		bool operator!=(const Ref<U>& p_Other) const { return m_Instance != p_Other.get(); }
+		bool operator==(std::nullptr_t) const { return m_Instance == nullptr; }
+		bool operator!=(std::nullptr_t) const { return m_Instance != nullptr; }
+	public: // Main Functionality
+		T* get() const { return m_Instance; }
+
+		void reset(T* p_Instance = nullptr)
+		{
+			*this = Ref(p_Instance);
+		}
+
+		/**
+		 * @brief Casts to a derived type the object is known to be.
+		 * @returns The cast reference.
+		 */
+		template<typename U>
+		Ref<U> As() const
+		{
+			return Ref<U>(static_cast<U*>(m_Instance));
+		}
+	private: // Helper
+		void IncRef() const
+		{
+			if (m_Instance)
+				m_Instance->IncRef();
+		}
+
+		void DecRef() const
+		{
+			if (m_Instance && m_Instance->DecRef())
+				delete m_Instance;
+		}
+	private: // Private Member Variables
+		template<typename U>
+		friend class Ref;
+
+		T* m_Instance = nullptr;
+	};
+
+	template<typename T, typename ... Args>
+	Ref<T> CreateRef(Args&& ... args)
+	{
+		return Ref<T>(new T(std::forward<Args>(args)...));
+	}
+}
+
+#endif // __VIOLET_ENGINE_CORE_REF_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,170 @@
+/////////////////
+///
+/// StartupSequence.cpp
+/// Violet McAllister
+/// August 2nd, 2022
+/// Updated: August 6th, 2022
+///
+/// Contains implementations for the startup
+/// sequence.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Core/StartupSequence.h"
+
+#include "Violet/Core/Time.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Adds a stage to the sequence.
+	 * @param p_Name The name of the stage, in static storage.
+	 * @param p_Thread The thread the stage runs on.
+	 * @param p_Function The work of the stage.
+	 * @param p_Dependencies The stages which must finish first.
+	 * @returns The ID of the stage, used as a dependency.
+	 */
+	StartupStageID StartupSequence::Add(const char* p_Name, StartupThread p_Thread, std::function<void()> p_Function, std::initializer_list<StartupStageID> p_Dependencies)
+	{
+		StartupStageID id = (StartupStageID)m_Stages.size();
+		for (StartupStageID dependency : p_Dependencies)
+			VT_CORE_ASSERT(dependency == FinishedStage || dependency < id, "Startup Stages Can Only Depend On Earlier Stages!");
+
+		Scope<Stage> stage = CreateScope<Stage>();
+		stage->Name = p_Name;
+		stage->Thread = p_Thread;
+		stage->Function = std::move(p_Function);
+		stage->Dependencies = p_Dependencies;
+		m_Stages.push_back(std::move(stage));
+		return id;
+	}
+
+	/**
+	 * @brief Finds a stage by name.
+	 * @param p_Name The name of the stage.
+	 * @returns The ID of the stage, or FinishedStage if the
+	 * sequence has no such stage.
+	 */
+	StartupStageID StartupSequence::Find(const char* p_Name) const
+	{
+		for (StartupStageID id = 0; id < m_Stages.size(); id++)
+		{
+			if (strcmp(m_Stages[id]->Name, p_Name) == 0)
+				return id;
+		}
+
+		return FinishedStage;
+	}
+
+	/**
+	 * @brief Runs every stage and returns once all of them have
+	 * finished. Must be called from the main thread.
+	 */
+	void StartupSequence::Run()
+	{
+		VT_PROFILE_FUNCTION();
+
+		if (m_Stages.empty())
+			return;
+
+		uint64_t start = Time::GetNanoseconds();
+		uint32_t remaining = (uint32_t)m_Stages.size();
+		while (remaining > 0)
+		{
+			bool progressed = false;
+
+			// Worker stages go out first so they overlap the main thread stages.
+			for (Scope<Stage>& stage : m_Stages)
+			{
+				if (stage->Started || stage->Thread != StartupThread::Worker || !IsReady(*stage))
+					continue;
+
+				Stage* scheduled = stage.get();
+				stage->Started = true;
+				JobSystem::Schedule(stage->Name, [scheduled]() { RunStage(*scheduled); }, &stage->Counter);
+			}
+
+			for (Scope<Stage>& stage : m_Stages)
+			{
+				if (stage->Finished)
+					continue;
+
+				if (stage->Started)
+				{
+					if (stage->Counter.load(std::memory_order_acquire) != 0)
+						continue;
+				}
+				else if (stage->Thread == StartupThread::Main && IsReady(*stage))
+				{
+					stage->Started = true;
+					VT_PROFILE_SCOPE_DYNAMIC(stage->Name);
+					RunStage(*stage);
+				}
+				else
+				{
+					continue;
+				}
+
+				stage->Finished = true;
+				remaining--;
+				progressed = true;
+
+				// Finishing a stage can make an earlier one ready.
+				break;
+			}
+
+			if (progressed)
+				continue;
+
+			// Nothing can run on the main thread yet. Help the workers with one job, then
+			// check again, a worker stage finishing may make a main thread stage ready.
+			bool pending = false;
+			for (Scope<Stage>& stage : m_Stages)
+				pending |= stage->Started && !stage->Finished;
+
+			VT_CORE_ASSERT(pending, "Startup Stages Have Unmet Dependencies!");
+			if (!pending)
+				break;
+
+			if (!JobSystem::TryRunJob())
+				std::this_thread::yield();
+		}
+
+		uint64_t total = 0;
+		for (const Scope<Stage>& stage : m_Stages)
+			total += stage->Duration;
+
+		VT_CORE_INFO("Startup Ran {0} Stages In {1:.2f}ms ({2:.2f}ms Of Stage Work).", m_Stages.size(), (Time::GetNanoseconds() - start) * 1e-6, total * 1e-6);
+		m_Stages.clear();
+	}
+
+	/**
+	 * @brief Finds if every dependency of a stage has finished.
+	 * @param p_Stage The stage.
+	 * @returns Whether the stage can run.
+	 */
+	bool StartupSequence::IsReady(const Stage& p_Stage) const
+	{
+		for (StartupStageID dependency : p_Stage.Dependencies)
+		{
+			if (dependency != FinishedStage && !m_Stages[dependency]->Finished)
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Runs the work of a stage and times it. Worker stages
+	 * are already profiled under their job name.
+	 * @param p_Stage The stage.
+	 */
+	void StartupSequence::RunStage(Stage& p_Stage)
+	{
+		uint64_t start = Time::GetNanoseconds();
+		p_Stage.Function();
+		p_Stage.Duration = Time::GetNanoseconds() - start;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+/////////////////
+///
+/// StartupSequence.h
+/// Violet McAllister
+/// August 2nd, 2022
+///
+/// Breaks application startup into named stages
+/// with dependencies. Stages that only touch the
+/// CPU run on the job system while the main thread
+/// creates the window and GPU resources.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_CORE_STARTUP_SEQUENCE_H_INCLUDED__
+#define __VIOLET_ENGINE_CORE_STARTUP_SEQUENCE_H_INCLUDED__
+
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "Violet/Core/Base.h"
+#include "Violet/Core/JobSystem.h"
+
+namespace Violet
+{
+	/**
+	 * @brief The thread a startup stage runs on. Anything
+	 * touching the window or the graphics context must run
+	 * on the main thread.
+	 */
+	enum class StartupThread
+	{
+		Main = 0, Worker
+	};
+
+	using StartupStageID = uint32_t;
+
+	/**
+	 * @brief A set of startup stages run in dependency order.
+	 * Main stages run in the order they were added once their
+	 * dependencies finish, worker stages are scheduled as soon
+	 * as theirs do.
+	 */
+	class StartupSequence
+	{
+	public: // Constants
+		// Refers to a stage of an earlier sequence, which has already finished.
+		static constexpr StartupStageID FinishedStage = ~0u;
+	public: // Main Functionality
+		StartupStageID Add(const char* p_Name, StartupThread p_Thread, std::function<void()> p_Function, std::initializer_list<StartupStageID> p_Dependencies = {});
+		StartupStageID Find(const char* p_Name) const;
+		void Run();
+	public: // Getters
+		uint32_t GetStageCount() const { return (uint32_t)m_Stages.size(); }
+	private: // Stage
+		struct Stage
+		{
+			const char* Name;
+			StartupThread Thread;
+			std::function<void()> Function;
+			std::vector<StartupStageID> Dependencies;
+
+			JobCounter Counter = 0;
+			bool Started = false;
+			bool Finished = false;
+			uint64_t Duration = 0;
+		};
+	private: // Helper
+		bool IsReady(const Stage& p_Stage) const;
+		static void RunStage(Stage& p_Stage);
+	private: // Private Member Variables
+		// Stages are scheduled by pointer, so they must not move.
+		std::vector<Scope<Stage>> m_Stages;
+	};
+}
+
+#endif // __VIOLET_ENGINE_CORE_STARTUP_SEQUENCE_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,38 @@
+/////////////////
+///
+/// Time.cpp
+/// Violet McAllister
+/// July 27th, 2022
+///
+/// Contains implementations for the application
+/// clock.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Core/Time.h"
+
+namespace Violet
+{
+	// The clock starts with the program.
+	static const std::chrono::steady_clock::time_point s_StartTime = std::chrono::steady_clock::now();
+
+	/**
+	 * @brief Gets the time since the application started.
+	 * @returns The time in nanoseconds.
+	 */
+	uint64_t Time::GetNanoseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_StartTime).count();
+	}
+
+	/**
+	 * @brief Gets the time since the application started.
+	 * @returns The time in seconds.
+	 */
+	double Time::GetSeconds()
+	{
+		return GetNanoseconds() * 1e-9;
+	}
+}
\ No newline at end of file
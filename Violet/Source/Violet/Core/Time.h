@@ -0,0 +1,45 @@
+/////////////////
+///
+/// Time.h
+/// Violet McAllister
+/// July 27th, 2022
+///
+/// A 64-bit application clock and the settings
+/// for the fixed timestep simulation loop.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_CORE_TIME_H_INCLUDED__
+#define __VIOLET_ENGINE_CORE_TIME_H_INCLUDED__
+
+#include <cstdint>
+
+namespace Violet
+{
+	/**
+	 * @brief The application clock. Time is kept as 64-bit
+	 * nanoseconds so it does not lose precision over long
+	 * uptimes, unlike a float of seconds.
+	 */
+	class Time
+	{
+	public: // Main Functionality
+		static uint64_t GetNanoseconds();
+		static double GetSeconds();
+	};
+
+	/**
+	 * @brief Settings for running the simulation at a fixed rate.
+	 * Each frame runs as many OnFixedUpdate ticks as the elapsed
+	 * time covers, up to MaxStepsPerFrame, time past that is
+	 * dropped so a slow frame can't cause ever slower frames.
+	 */
+	struct FixedTimestepSettings
+	{
+		bool Enabled = false;
+		double StepSeconds = 1.0 / 60.0;
+		uint32_t MaxStepsPerFrame = 5;
+	};
+}
+
+#endif // __VIOLET_ENGINE_CORE_TIME_H_INCLUDED__
\ No newline at end of file
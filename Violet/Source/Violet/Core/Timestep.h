@@ -3,6 +3,7 @@
 /// Timestep.h
 /// Violet McAllister
 /// July 12th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Defines how much time has
 /// elapsed in a frame.
@@ -20,9 +21,11 @@ namespace Violet
 		/**
 		 * @brief Constructs a Timestep object.
 		 * @param p_Time The current program time.
+		 * @param p_InterpolationAlpha How far the frame is between
+		 * two fixed ticks, see Application::SetFixedTimestep.
 		 */
-		Timestep(float p_Time = 0.0f)
-			: m_Time(p_Time)
+		Timestep(float p_Time = 0.0f, float p_InterpolationAlpha = 0.0f)
+			: m_Time(p_Time), m_InterpolationAlpha(p_InterpolationAlpha)
 		{
 
 		}
@@ -44,8 +47,16 @@ namespace Violet
 		 * @returns The time in milliseconds.
 		 */
 		float GetMilliseconds() const { return m_Time * 1000.0f; }
+
+		/**
+		 * @brief Gets how far the frame is between the last fixed tick
+		 * and the next, for blending simulated state while rendering.
+		 * @returns The interpolation alpha in [0, 1), 0 without a fixed timestep.
+		 */
+		float GetInterpolationAlpha() const { return m_InterpolationAlpha; }
 	private: // Private Member Variables
 		float m_Time;
+		float m_InterpolationAlpha;
 	};
 }
 
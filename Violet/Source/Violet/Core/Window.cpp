@@ -14,22 +14,26 @@
 
 #include "Violet/Core/Window.h"
 
-#ifdef VT_PLATFORM_WINDOWS
+#if defined(VT_PLATFORM_WINDOWS)
 	#include "Platform/Windows/WindowsWindow.h"
+#elif defined(VT_PLATFORM_LINUX)
+	#include "Platform/Linux/HeadlessWindow.h"
 #endif
 
 namespace Violet
 {
 	/**
-	 * @brief Allows the user to create a Window for the Windows
-	 * system without specifically referencing Windows.
+	 * @brief Allows the user to create a Window for the current
+	 * platform without specifically referencing it.
 	 * @param p_Properties The window properties (title, width, height).
-	 * @returns The windows window, not implemented for Windows.
+	 * @returns The platform window, headless on Linux.
 	 */
 	Scope<Window> Window::Create(const WindowProperties& p_Properties)
 	{
-	#ifdef VT_PLATFORM_WINDOWS
+	#if defined(VT_PLATFORM_WINDOWS)
 		return CreateScope<WindowsWindow>(p_Properties);
+	#elif defined(VT_PLATFORM_LINUX)
+		return CreateScope<HeadlessWindow>(p_Properties);
 	#else
 		VT_CORE_ASSERT(false, "Unknown Platform!");
 		return nullptr;
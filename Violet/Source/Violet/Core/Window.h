@@ -3,7 +3,7 @@
 /// Window.h
 /// Violet McAllister
 /// July 1st, 2022
-/// Updated: July 16th, 2022
+/// Updated: July 24th, 2022
 ///
 /// Contains Window Properties and a Window
 /// interface to generalize window functionality
@@ -18,6 +18,8 @@
 
 #include "Violet/Core/Base.h"
 #include "Violet/Events/Event.h"
+#include "Violet/Events/EventCallback.h"
+#include "Violet/Events/EventQueue.h"
 
 namespace Violet
 {
@@ -51,7 +53,7 @@ namespace Violet
 	class Window
 	{
 	public: // Definitions
-		using EventCallbackFunction = std::function<void(Event&)>;
+		using EventCallbackFunction = EventCallback;
 	public: // Constructors & Deconstructors
 		virtual ~Window() = default;
 	public: // Main Functionality
@@ -62,6 +64,7 @@ namespace Violet
 		virtual void* GetNativeWindow() const = 0;
 	public: // Window Attributes
 		virtual void SetEventCallback(const EventCallbackFunction& p_Callback) = 0;
+		virtual void SetEventQueue(EventQueue* p_Queue) = 0;
 		virtual void SetVSync(bool p_Enabled) = 0;
 		virtual bool IsVSync() const = 0;
 	public: // Static Creator
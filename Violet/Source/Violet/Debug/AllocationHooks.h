@@ -0,0 +1,149 @@
+/////////////////
+///
+/// AllocationHooks.h
+/// Violet McAllister
+/// July 22nd, 2022
+/// Updated: August 6th, 2022
+///
+/// Replaces the global operator new and delete
+/// to report to the AllocationTracker. Included
+/// once by EntryPoint.h when VT_TRACK_ALLOCATIONS
+/// is defined, so the replacements end up in the
+/// client executable.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_DEBUG_ALLOCATION_HOOKS_H_INCLUDED__
+#define __VIOLET_ENGINE_DEBUG_ALLOCATION_HOOKS_H_INCLUDED__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include "Violet/Debug/AllocationTracker.h"
+
+namespace Violet::AllocationHooks
+{
+	// Every block starts with its size, padded to keep the user pointer aligned.
+	constexpr size_t HeaderSize = alignof(std::max_align_t) > sizeof(size_t) ? alignof(std::max_align_t) : sizeof(size_t);
+
+	/**
+	 * @brief Allocates a block with a size header.
+	 * @param p_Size The size requested by the caller.
+	 * @returns The user pointer, or nullptr on failure.
+	 */
+	inline void* Allocate(size_t p_Size) noexcept
+	{
+		void* block = std::malloc(p_Size + HeaderSize);
+		if (!block)
+			return nullptr;
+
+		*static_cast<size_t*>(block) = p_Size;
+		AllocationTracker::OnAllocate(p_Size);
+		return static_cast<char*>(block) + HeaderSize;
+	}
+
+	/**
+	 * @brief Frees a block allocated by Allocate.
+	 * @param p_Pointer The user pointer.
+	 */
+	inline void Free(void* p_Pointer) noexcept
+	{
+		if (!p_Pointer)
+			return;
+
+		void* block = static_cast<char*>(p_Pointer) - HeaderSize;
+		AllocationTracker::OnFree(*static_cast<size_t*>(block));
+		std::free(block);
+	}
+
+	/**
+	 * @brief Allocates an over-aligned block. The size and the
+	 * pointer malloc returned are kept right below the user
+	 * pointer, wherever alignment puts it.
+	 * @param p_Size The size requested by the caller.
+	 * @param p_Alignment The alignment, a power of two.
+	 * @returns The user pointer, or nullptr on failure.
+	 */
+	inline void* AllocateAligned(size_t p_Size, std::align_val_t p_Alignment) noexcept
+	{
+		size_t alignment = (size_t)p_Alignment;
+		void* block = std::malloc(p_Size + alignment + 2 * sizeof(void*));
+		if (!block)
+			return nullptr;
+
+		uintptr_t user = ((uintptr_t)block + 2 * sizeof(void*) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		reinterpret_cast<void**>(user)[-1] = block;
+		reinterpret_cast<size_t*>(user)[-2] = p_Size;
+		AllocationTracker::OnAllocate(p_Size);
+		return reinterpret_cast<void*>(user);
+	}
+
+	/**
+	 * @brief Frees a block allocated by AllocateAligned.
+	 * @param p_Pointer The user pointer.
+	 */
+	inline void FreeAligned(void* p_Pointer) noexcept
+	{
+		if (!p_Pointer)
+			return;
+
+		AllocationTracker::OnFree(static_cast<size_t*>(p_Pointer)[-2]);
+		std::free(static_cast<void**>(p_Pointer)[-1]);
+	}
+}
+
+void* operator new(size_t p_Size)
+{
+	void* pointer = Violet::AllocationHooks::Allocate(p_Size);
+	if (!pointer)
+		throw std::bad_alloc();
+	return pointer;
+}
+
+void* operator new[](size_t p_Size)
+{
+	void* pointer = Violet::AllocationHooks::Allocate(p_Size);
+	if (!pointer)
+		throw std::bad_alloc();
+	return pointer;
+}
+
+void* operator new(size_t p_Size, const std::nothrow_t&) noexcept { return Violet::AllocationHooks::Allocate(p_Size); }
+void* operator new[](size_t p_Size, const std::nothrow_t&) noexcept { return Violet::AllocationHooks::Allocate(p_Size); }
+
+void operator delete(void* p_Pointer) noexcept { Violet::AllocationHooks::Free(p_Pointer); }
+void operator delete[](void* p_Pointer) noexcept { Violet::AllocationHooks::Free(p_Pointer); }
+void operator delete(void* p_Pointer, size_t) noexcept { Violet::AllocationHooks::Free(p_Pointer); }
+void operator delete[](void* p_Pointer, size_t) noexcept { Violet::AllocationHooks::Free(p_Pointer); }
+void operator delete(void* p_Pointer, const std::nothrow_t&) noexcept { Violet::AllocationHooks::Free(p_Pointer); }
+void operator delete[](void* p_Pointer, const std::nothrow_t&) noexcept { Violet::AllocationHooks::Free(p_Pointer); }
+
+void* operator new(size_t p_Size, std::align_val_t p_Alignment)
+{
+	void* pointer = Violet::AllocationHooks::AllocateAligned(p_Size, p_Alignment);
+	if (!pointer)
+		throw std::bad_alloc();
+	return pointer;
+}
+
+void* operator new[](size_t p_Size, std::align_val_t p_Alignment)
+{
+	void* pointer = Violet::AllocationHooks::AllocateAligned(p_Size, p_Alignment);
+	if (!pointer)
+		throw std::bad_alloc();
+	return pointer;
+}
+
+void* operator new(size_t p_Size, std::align_val_t p_Alignment, const std::nothrow_t&) noexcept { return Violet::AllocationHooks::AllocateAligned(p_Size, p_Alignment); }
+void* operator new[](size_t p_Size, std::align_val_t p_Alignment, const std::nothrow_t&) noexcept { return Violet::AllocationHooks::AllocateAligned(p_Size, p_Alignment); }
+
+void operator delete(void* p_Pointer, std::align_val_t) noexcept { Violet::AllocationHooks::FreeAligned(p_Pointer); }
+void operator delete[](void* p_Pointer, std::align_val_t) noexcept { Violet::AllocationHooks::FreeAligned(p_Pointer); }
+void operator delete(void* p_Pointer, size_t, std::align_val_t) noexcept { Violet::AllocationHooks::FreeAligned(p_Pointer); }
+void operator delete[](void* p_Pointer, size_t, std::align_val_t) noexcept { Violet::AllocationHooks::FreeAligned(p_Pointer); }
+void operator delete(void* p_Pointer, std::align_val_t, const std::nothrow_t&) noexcept { Violet::AllocationHooks::FreeAligned(p_Pointer); }
+void operator delete[](void* p_Pointer, std::align_val_t, const std::nothrow_t&) noexcept { Violet::AllocationHooks::FreeAligned(p_Pointer); }
+
+#endif // __VIOLET_ENGINE_DEBUG_ALLOCATION_HOOKS_H_INCLUDED__
\ No newline at end of file
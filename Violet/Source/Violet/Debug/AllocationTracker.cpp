@@ -0,0 +1,40 @@
+/////////////////
+///
+/// AllocationTracker.cpp
+/// Violet McAllister
+/// July 22nd, 2022
+/// Updated: July 29th, 2022
+///
+/// Contains implementations for the allocation
+/// tracker.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Debug/AllocationTracker.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Closes the frame totals and writes them to the
+	 * profile trace as counters. Runs once per frame.
+	 */
+	void AllocationTracker::EndFrame()
+	{
+		s_LastFrameStats.Allocations = s_FrameAllocations.exchange(0, std::memory_order_relaxed);
+		s_LastFrameStats.Frees = s_FrameFrees.exchange(0, std::memory_order_relaxed);
+		s_LastFrameStats.BytesAllocated = s_FrameBytesAllocated.exchange(0, std::memory_order_relaxed);
+		s_LastFrameStats.BytesFreed = s_FrameBytesFreed.exchange(0, std::memory_order_relaxed);
+		if (s_LastFrameStats.Allocations > 0)
+			s_AllocatingFrames++;
+
+		if constexpr (IsTracking())
+		{
+			IgnoreScope ignore;
+			VT_PROFILE_COUNTER("Allocations", { "Allocations", (double)s_LastFrameStats.Allocations }, { "Frees", (double)s_LastFrameStats.Frees });
+			VT_PROFILE_COUNTER("Allocated Bytes", { "BytesAllocated", (double)s_LastFrameStats.BytesAllocated }, { "BytesFreed", (double)s_LastFrameStats.BytesFreed });
+			VT_PROFILE_COUNTER("Allocating Frames", { "Frames", (double)s_AllocatingFrames });
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+/////////////////
+///
+/// AllocationTracker.h
+/// Violet McAllister
+/// July 22nd, 2022
+/// Updated: July 29th, 2022
+///
+/// Counts heap allocations per thread and per
+/// frame. Only receives data when the build defines
+/// VT_TRACK_ALLOCATIONS, which hooks the global
+/// operator new and delete (see AllocationHooks.h).
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_DEBUG_ALLOCATION_TRACKER_H_INCLUDED__
+#define __VIOLET_ENGINE_DEBUG_ALLOCATION_TRACKER_H_INCLUDED__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Violet
+{
+	/**
+	 * @brief Contains allocation counts and byte totals.
+	 */
+	struct AllocationStats
+	{
+		uint64_t Allocations = 0;
+		uint64_t Frees = 0;
+		uint64_t BytesAllocated = 0;
+		uint64_t BytesFreed = 0;
+	};
+
+	/**
+	 * @brief Collects the allocations reported by the global
+	 * operator new and delete hooks.
+	 */
+	class AllocationTracker
+	{
+	public: // Hooks
+		/**
+		 * @brief Records an allocation on the calling thread.
+		 * @param p_Size The size of the allocation in bytes.
+		 */
+		static void OnAllocate(size_t p_Size)
+		{
+			if (s_IgnoreDepth > 0)
+				return;
+
+			s_ThreadStats.Allocations++;
+			s_ThreadStats.BytesAllocated += p_Size;
+			s_FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+			s_FrameBytesAllocated.fetch_add(p_Size, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Records a free on the calling thread.
+		 * @param p_Size The size of the freed allocation in bytes.
+		 */
+		static void OnFree(size_t p_Size)
+		{
+			if (s_IgnoreDepth > 0)
+				return;
+
+			s_ThreadStats.Frees++;
+			s_ThreadStats.BytesFreed += p_Size;
+			s_FrameFrees.fetch_add(1, std::memory_order_relaxed);
+			s_FrameBytesFreed.fetch_add(p_Size, std::memory_order_relaxed);
+		}
+	public: // Main Functionality
+		static void EndFrame();
+	public: // Getters
+		/**
+		 * @brief Checks whether the hooks are compiled in.
+		 * @returns If allocations are being tracked.
+		 */
+		static constexpr bool IsTracking()
+		{
+#ifdef VT_TRACK_ALLOCATIONS
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		/**
+		 * @brief Gets the running totals of the calling thread. Scopes
+		 * take the difference between two of these.
+		 * @returns The allocation stats of the calling thread.
+		 */
+		static const AllocationStats& GetThreadStats() { return s_ThreadStats; }
+
+		/**
+		 * @brief Gets the totals of every thread during the last
+		 * completed frame.
+		 * @returns The allocation stats of the last frame.
+		 */
+		static const AllocationStats& GetFrameStats() { return s_LastFrameStats; }
+
+		/**
+		 * @brief Gets the number of frames which allocated at least
+		 * once. Stays put once the engine reaches a steady state.
+		 * @returns The number of allocating frames.
+		 */
+		static uint64_t GetAllocatingFrames() { return s_AllocatingFrames; }
+	public: // Ignore Scope
+		/**
+		 * @brief Stops counting allocations on the calling thread while
+		 * alive, so the profiler does not count its own bookkeeping.
+		 */
+		struct IgnoreScope
+		{
+			IgnoreScope() { s_IgnoreDepth++; }
+			~IgnoreScope() { s_IgnoreDepth--; }
+		};
+	private: // Static Member Variables
+		inline static thread_local AllocationStats s_ThreadStats;
+		inline static thread_local uint32_t s_IgnoreDepth = 0;
+
+		inline static std::atomic<uint64_t> s_FrameAllocations = 0;
+		inline static std::atomic<uint64_t> s_FrameFrees = 0;
+		inline static std::atomic<uint64_t> s_FrameBytesAllocated = 0;
+		inline static std::atomic<uint64_t> s_FrameBytesFreed = 0;
+		inline static AllocationStats s_LastFrameStats;
+		inline static uint64_t s_AllocatingFrames = 0;
+	};
+}
+
+#endif // __VIOLET_ENGINE_DEBUG_ALLOCATION_TRACKER_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,369 @@
+/////////////////
+///
+/// FastLog.cpp
+/// Violet McAllister
+/// August 1st, 2022
+/// Updated: August 6th, 2022
+///
+/// Contains implementations for the fast log
+/// rings and their dumps.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Debug/FastLog.h"
+
+#include <csignal>
+#include <exception>
+#include <fstream>
+
+#ifdef VT_PLATFORM_WINDOWS
+	#include <fcntl.h>
+	#include <io.h>
+	#include <sys/stat.h>
+#else
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+namespace Violet
+{
+	/**
+	 * @brief The rings of every thread and the crash dump state.
+	 * Rings are never freed, threads may log during shutdown.
+	 * Nothing here locks or allocates once the crash handler is
+	 * installed, the handler reads it from a signal.
+	 */
+	struct FastLogData
+	{
+		static constexpr uint32_t MaxThreads = 256;
+		static constexpr uint32_t CrashBufferSize = 64 * 1024;
+
+		std::atomic<FastLogThreadBuffer*> Buffers[MaxThreads] = {};
+		std::atomic<uint32_t> BufferCount = 0;
+
+		int CrashFile = -1;
+		std::atomic<bool> Crashed = false;
+		std::terminate_handler PreviousTerminate = nullptr;
+
+		// Only touched by the crash dump, which runs once.
+		uint64_t CrashFirst[MaxThreads];
+		uint64_t CrashHead[MaxThreads];
+		char CrashBuffer[CrashBufferSize];
+		uint32_t CrashBufferUsed = 0;
+	};
+
+	static FastLogData s_Data;
+
+	/**
+	 * @brief Writes a value to a stream.
+	 * @param p_Output The stream.
+	 * @param p_Value The value.
+	 */
+	template<typename T>
+	static void WriteValue(std::ofstream& p_Output, const T& p_Value)
+	{
+		p_Output.write(reinterpret_cast<const char*>(&p_Value), sizeof(T));
+	}
+
+	/**
+	 * @brief Writes a string as its length followed by the characters.
+	 * @param p_Output The stream.
+	 * @param p_Value The string.
+	 */
+	static void WriteString(std::ofstream& p_Output, const char* p_Value)
+	{
+		uint16_t size = (uint16_t)std::min<size_t>(strlen(p_Value), UINT16_MAX);
+		WriteValue(p_Output, size);
+		p_Output.write(p_Value, size);
+	}
+
+	/**
+	 * @brief Allocates the ring of the calling thread.
+	 * @returns The ring.
+	 */
+	FastLogThreadBuffer* FastLog::CreateThreadBuffer()
+	{
+		FastLogThreadBuffer* buffer = new FastLogThreadBuffer();
+		buffer->Records = new FastLogRecord[RecordsPerThread];
+
+		// Rings past MaxThreads still record, they are just left out of dumps.
+		buffer->Index = s_Data.BufferCount.fetch_add(1, std::memory_order_relaxed);
+		VT_CORE_ASSERT(buffer->Index < FastLogData::MaxThreads, "Too Many Threads Use VT_LOG_FAST.");
+		if (buffer->Index < FastLogData::MaxThreads)
+			s_Data.Buffers[buffer->Index].store(buffer, std::memory_order_release);
+
+		s_ThreadBuffer = buffer;
+		return buffer;
+	}
+
+	/**
+	 * @brief Writes the records of every thread to a file for
+	 * the LogDecoder tool.
+	 * @param p_Filepath The path of the dump.
+	 * @returns If the dump was written.
+	 */
+	bool FastLog::Dump(const std::string& p_Filepath)
+	{
+		std::vector<FastLogThreadBuffer*> buffers;
+		uint32_t bufferCount = std::min(s_Data.BufferCount.load(std::memory_order_acquire), FastLogData::MaxThreads);
+		for (uint32_t i = 0; i < bufferCount; i++)
+		{
+			// A thread between taking its index and publishing its ring has nothing to dump yet.
+			if (FastLogThreadBuffer* buffer = s_Data.Buffers[i].load(std::memory_order_acquire))
+				buffers.push_back(buffer);
+		}
+
+		// Copy each ring, then drop what its thread overwrote meanwhile.
+		std::vector<std::vector<FastLogRecord>> threads(buffers.size());
+		std::vector<const FastLogSite*> sites;
+		for (size_t i = 0; i < buffers.size(); i++)
+		{
+			uint64_t head = buffers[i]->Head.load(std::memory_order_acquire);
+			uint64_t first = head > RecordsPerThread ? head - RecordsPerThread : 0;
+
+			std::vector<FastLogRecord>& records = threads[i];
+			for (uint64_t position = first; position < head; position++)
+				records.push_back(buffers[i]->Records[position & (RecordsPerThread - 1)]);
+
+			uint64_t newHead = buffers[i]->Head.load(std::memory_order_acquire);
+			if (newHead + 1 > first + RecordsPerThread)
+			{
+				uint64_t overwritten = std::min<uint64_t>(newHead + 1 - RecordsPerThread - first, records.size());
+				records.erase(records.begin(), records.begin() + overwritten);
+			}
+
+			for (const FastLogRecord& record : records)
+				sites.push_back(record.Site);
+		}
+
+		std::sort(sites.begin(), sites.end());
+		sites.erase(std::unique(sites.begin(), sites.end()), sites.end());
+
+		std::ofstream output(p_Filepath, std::ios::binary);
+		if (!output.is_open())
+			return false;
+
+		output.write(FastLogFormat::Magic, sizeof(FastLogFormat::Magic));
+		WriteValue(output, FastLogFormat::Version);
+		WriteValue(output, (uint32_t)sites.size());
+		WriteValue(output, (uint32_t)threads.size());
+
+		for (const FastLogSite* site : sites)
+		{
+			WriteValue(output, (uint64_t)(uintptr_t)site);
+			WriteValue(output, site->Line);
+			WriteString(output, site->Format);
+			WriteString(output, site->File);
+		}
+
+		for (size_t i = 0; i < threads.size(); i++)
+		{
+			WriteValue(output, buffers[i]->Index);
+			WriteValue(output, (uint32_t)threads[i].size());
+			for (const FastLogRecord& record : threads[i])
+			{
+				WriteValue(output, ProfileClock::ToMicroseconds(record.Ticks));
+				WriteValue(output, (uint64_t)(uintptr_t)record.Site);
+				output.write(reinterpret_cast<const char*>(record.Arguments), FastLogFormat::ArgumentSize);
+			}
+		}
+
+		return output.good();
+	}
+
+	/**
+	 * @brief Writes the whole crash buffer to the crash file,
+	 * with nothing but write(2).
+	 */
+	static void FlushCrashBuffer()
+	{
+		const char* data = s_Data.CrashBuffer;
+		uint32_t size = s_Data.CrashBufferUsed;
+		while (size > 0)
+		{
+#ifdef VT_PLATFORM_WINDOWS
+			int written = _write(s_Data.CrashFile, data, size);
+#else
+			ssize_t written = write(s_Data.CrashFile, data, size);
+			if (written < 0 && errno == EINTR)
+				continue;
+#endif
+			if (written <= 0)
+				break;
+
+			data += written;
+			size -= (uint32_t)written;
+		}
+
+		s_Data.CrashBufferUsed = 0;
+	}
+
+	/**
+	 * @brief Appends bytes to the crash buffer, flushing it
+	 * when full.
+	 * @param p_Data The bytes.
+	 * @param p_Size The number of bytes.
+	 */
+	static void WriteCrash(const void* p_Data, size_t p_Size)
+	{
+		const char* data = static_cast<const char*>(p_Data);
+		while (p_Size > 0)
+		{
+			if (s_Data.CrashBufferUsed == FastLogData::CrashBufferSize)
+				FlushCrashBuffer();
+
+			uint32_t size = (uint32_t)std::min<size_t>(p_Size, FastLogData::CrashBufferSize - s_Data.CrashBufferUsed);
+			memcpy(s_Data.CrashBuffer + s_Data.CrashBufferUsed, data, size);
+			s_Data.CrashBufferUsed += size;
+			data += size;
+			p_Size -= size;
+		}
+	}
+
+	/**
+	 * @brief Appends a string as its length followed by the
+	 * characters to the crash buffer.
+	 * @param p_Value The string.
+	 */
+	static void WriteCrashString(const char* p_Value)
+	{
+		uint16_t size = (uint16_t)std::min<size_t>(strlen(p_Value), UINT16_MAX);
+		WriteCrash(&size, sizeof(size));
+		WriteCrash(p_Value, size);
+	}
+
+	/**
+	 * @brief Dumps the rings to the crash file once, best effort.
+	 * Runs inside signal handlers, so it only reads the rings in
+	 * place and writes them to the descriptor opened by
+	 * InstallCrashHandler. Sites are written once per record
+	 * instead of sorted, the decoder keeps one of each. Records
+	 * that threads overwrite meanwhile may come out torn.
+	 */
+	static void DumpOnCrash()
+	{
+		if (s_Data.CrashFile < 0 || s_Data.Crashed.exchange(true))
+			return;
+
+		uint32_t threadCount = std::min(s_Data.BufferCount.load(std::memory_order_acquire), FastLogData::MaxThreads);
+		uint32_t siteCount = 0;
+		for (uint32_t i = 0; i < threadCount; i++)
+		{
+			// The oldest slot of a full ring is the one being overwritten next, leave it out.
+			FastLogThreadBuffer* buffer = s_Data.Buffers[i].load(std::memory_order_acquire);
+			uint64_t head = buffer ? buffer->Head.load(std::memory_order_acquire) : 0;
+			s_Data.CrashHead[i] = head;
+			s_Data.CrashFirst[i] = head >= FastLog::RecordsPerThread ? head - FastLog::RecordsPerThread + 1 : 0;
+			siteCount += (uint32_t)(head - s_Data.CrashFirst[i]);
+		}
+
+		WriteCrash(FastLogFormat::Magic, sizeof(FastLogFormat::Magic));
+		WriteCrash(&FastLogFormat::Version, sizeof(FastLogFormat::Version));
+		WriteCrash(&siteCount, sizeof(siteCount));
+		WriteCrash(&threadCount, sizeof(threadCount));
+
+		for (uint32_t i = 0; i < threadCount; i++)
+		{
+			FastLogThreadBuffer* buffer = s_Data.Buffers[i].load(std::memory_order_acquire);
+			for (uint64_t position = s_Data.CrashFirst[i]; position < s_Data.CrashHead[i]; position++)
+			{
+				const FastLogSite* site = buffer->Records[position & (FastLog::RecordsPerThread - 1)].Site;
+				uint64_t id = (uint64_t)(uintptr_t)site;
+				WriteCrash(&id, sizeof(id));
+				WriteCrash(&site->Line, sizeof(site->Line));
+				WriteCrashString(site->Format);
+				WriteCrashString(site->File);
+			}
+		}
+
+		for (uint32_t i = 0; i < threadCount; i++)
+		{
+			FastLogThreadBuffer* buffer = s_Data.Buffers[i].load(std::memory_order_acquire);
+			uint32_t recordCount = (uint32_t)(s_Data.CrashHead[i] - s_Data.CrashFirst[i]);
+			WriteCrash(&i, sizeof(i));
+			WriteCrash(&recordCount, sizeof(recordCount));
+			for (uint64_t position = s_Data.CrashFirst[i]; position < s_Data.CrashHead[i]; position++)
+			{
+				const FastLogRecord& record = buffer->Records[position & (FastLog::RecordsPerThread - 1)];
+				double time = ProfileClock::ToMicroseconds(record.Ticks);
+				uint64_t id = (uint64_t)(uintptr_t)record.Site;
+				WriteCrash(&time, sizeof(time));
+				WriteCrash(&id, sizeof(id));
+				WriteCrash(record.Arguments, FastLogFormat::ArgumentSize);
+			}
+		}
+
+		FlushCrashBuffer();
+	}
+
+	/**
+	 * @brief Dumps the rings and lets the signal continue.
+	 * @param p_Signal The signal.
+	 */
+	static void OnCrashSignal(int p_Signal)
+	{
+		DumpOnCrash();
+
+		std::signal(p_Signal, SIG_DFL);
+		std::raise(p_Signal);
+	}
+
+	/**
+	 * @brief Dumps the rings and hands over to the previous handler.
+	 */
+	static void OnTerminate()
+	{
+		DumpOnCrash();
+
+		if (s_Data.PreviousTerminate)
+			s_Data.PreviousTerminate();
+		std::abort();
+	}
+
+#ifdef VT_PLATFORM_WINDOWS
+	/**
+	 * @brief Dumps the rings when a structured exception is not
+	 * handled, such as an access violation.
+	 * @param p_Exception The exception.
+	 * @returns Continue the search for a handler.
+	 */
+	static LONG WINAPI OnUnhandledException(EXCEPTION_POINTERS* p_Exception)
+	{
+		DumpOnCrash();
+		return EXCEPTION_CONTINUE_SEARCH;
+	}
+#endif
+
+	/**
+	 * @brief Dumps the rings to a file when the process crashes.
+	 * The file is opened here, since the handler may not, and
+	 * stays empty unless the process crashes.
+	 * @param p_Filepath The path of the crash dump.
+	 */
+	void FastLog::InstallCrashHandler(const std::string& p_Filepath)
+	{
+#ifdef VT_PLATFORM_WINDOWS
+		s_Data.CrashFile = _open(p_Filepath.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+		s_Data.CrashFile = open(p_Filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+		if (s_Data.CrashFile < 0)
+		{
+			VT_CORE_WARN("Could Not Open Fast Log Crash Dump '{0}'.", p_Filepath);
+			return;
+		}
+
+		std::signal(SIGSEGV, OnCrashSignal);
+		std::signal(SIGABRT, OnCrashSignal);
+		std::signal(SIGFPE, OnCrashSignal);
+		std::signal(SIGILL, OnCrashSignal);
+		s_Data.PreviousTerminate = std::set_terminate(OnTerminate);
+
+#ifdef VT_PLATFORM_WINDOWS
+		SetUnhandledExceptionFilter(OnUnhandledException);
+#endif
+	}
+}
\ No newline at end of file
@@ -0,0 +1,230 @@
+/////////////////
+///
+/// FastLog.h
+/// Violet McAllister
+/// August 1st, 2022
+/// Updated: August 6th, 2022
+///
+/// Tracing grade logging for hot loops. A call
+/// stores its call site and raw argument bytes in
+/// a per-thread ring without formatting anything.
+/// Dumps are rendered to text offline by the
+/// LogDecoder tool.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_DEBUG_FAST_LOG_H_INCLUDED__
+#define __VIOLET_ENGINE_DEBUG_FAST_LOG_H_INCLUDED__
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "Violet/Debug/ProfileClock.h"
+
+// Fast logging is compiled into every build except Dist.
+#ifndef VT_ENABLE_FAST_LOG
+	#ifdef VT_DIST
+		#define VT_ENABLE_FAST_LOG 0
+	#else
+		#define VT_ENABLE_FAST_LOG 1
+	#endif
+#endif
+
+namespace Violet
+{
+	/**
+	 * @brief The layout of a fast log dump. All values are in
+	 * host byte order, records are copied out without swapping
+	 * so dumps decode on a machine of the same endianness.
+	 * 
+	 * Header: "VTFL", Version (u32), SiteCount (u32), ThreadCount (u32).
+	 * 
+	 * Site: ID (u64), Line (u32), Format and File as a length (u16)
+	 * followed by the characters.
+	 * 
+	 * Thread: Index (u32), RecordCount (u32), then per record its
+	 * Time in microseconds (f64), Site ID (u64) and the argument
+	 * bytes (ArgumentSize bytes).
+	 * 
+	 * Arguments: A Tag (u8) followed by its value, 8 bytes for numbers
+	 * or a length (u8) and the characters for strings, until an End tag
+	 * or the end of the record.
+	 */
+	struct FastLogFormat
+	{
+		static constexpr char Magic[4] = { 'V', 'T', 'F', 'L' };
+		static constexpr uint32_t Version = 1;
+
+		static constexpr uint32_t RecordSize = 128;
+		static constexpr uint32_t ArgumentSize = RecordSize - 16;
+
+		enum Tag : uint8_t
+		{
+			End = 0, Int, UInt, Double, Bool, Char, String, Pointer
+		};
+	};
+
+	/**
+	 * @brief A call site of VT_LOG_FAST, in static storage.
+	 */
+	struct FastLogSite
+	{
+		const char* Format;
+		const char* File;
+		uint32_t Line;
+	};
+
+	/**
+	 * @brief A single entry of a thread's ring.
+	 */
+	struct FastLogRecord
+	{
+		uint64_t Ticks;
+		const FastLogSite* Site;
+		uint8_t Arguments[FastLogFormat::ArgumentSize];
+	};
+
+	/**
+	 * @brief The ring of one thread. Only its thread writes to it.
+	 */
+	struct FastLogThreadBuffer
+	{
+		uint32_t Index;
+		std::atomic<uint64_t> Head = 0;
+		FastLogRecord* Records;
+	};
+
+	/**
+	 * @brief Writes log records into per-thread rings, keeping
+	 * the newest RecordsPerThread of each thread. Dumping while
+	 * other threads log may lose the records being written.
+	 */
+	class FastLog
+	{
+	public: // Constants
+		static constexpr uint32_t RecordsPerThread = 2048;
+	public: // Main Functionality
+		/**
+		 * @brief Records a message. The arguments are copied as raw
+		 * values, strings are copied up to the space left.
+		 * @param p_Site The call site.
+		 * @param p_Arguments The format arguments.
+		 */
+		template<typename... Args>
+		static void Write(const FastLogSite* p_Site, const Args&... p_Arguments)
+		{
+			FastLogThreadBuffer* buffer = s_ThreadBuffer ? s_ThreadBuffer : CreateThreadBuffer();
+			uint64_t head = buffer->Head.load(std::memory_order_relaxed);
+
+			FastLogRecord& record = buffer->Records[head & (RecordsPerThread - 1)];
+			record.Ticks = ProfileClock::Now();
+			record.Site = p_Site;
+
+			uint8_t* cursor = record.Arguments;
+			uint8_t* end = record.Arguments + FastLogFormat::ArgumentSize - 1;
+			(Encode(cursor, end, p_Arguments), ...);
+			*cursor = FastLogFormat::End;
+
+			buffer->Head.store(head + 1, std::memory_order_release);
+		}
+
+		static bool Dump(const std::string& p_Filepath);
+		static void InstallCrashHandler(const std::string& p_Filepath);
+	private: // Encoding
+		// Arguments which no longer fit are left out, the decoder marks them missing.
+		static void EncodeValue(uint8_t*& p_Cursor, uint8_t* p_End, FastLogFormat::Tag p_Tag, const void* p_Value)
+		{
+			if (p_End - p_Cursor < 9)
+			{
+				p_Cursor = p_End;
+				return;
+			}
+
+			*p_Cursor = p_Tag;
+			memcpy(p_Cursor + 1, p_Value, 8);
+			p_Cursor += 9;
+		}
+
+		static void EncodeString(uint8_t*& p_Cursor, uint8_t* p_End, std::string_view p_Value)
+		{
+			if (p_End - p_Cursor < 2)
+			{
+				p_Cursor = p_End;
+				return;
+			}
+
+			size_t size = std::min<size_t>({ p_Value.size(), 255, (size_t)(p_End - p_Cursor - 2) });
+			p_Cursor[0] = FastLogFormat::String;
+			p_Cursor[1] = (uint8_t)size;
+			memcpy(p_Cursor + 2, p_Value.data(), size);
+			p_Cursor += 2 + size;
+		}
+
+		template<typename T>
+		static void Encode(uint8_t*& p_Cursor, uint8_t* p_End, const T& p_Value)
+		{
+			if constexpr (std::is_same_v<T, bool>)
+			{
+				uint64_t value = p_Value;
+				EncodeValue(p_Cursor, p_End, FastLogFormat::Bool, &value);
+			}
+			else if constexpr (std::is_same_v<T, char>)
+			{
+				uint64_t value = (uint8_t)p_Value;
+				EncodeValue(p_Cursor, p_End, FastLogFormat::Char, &value);
+			}
+			else if constexpr (std::is_enum_v<T>)
+			{
+				int64_t value = (int64_t)p_Value;
+				EncodeValue(p_Cursor, p_End, FastLogFormat::Int, &value);
+			}
+			else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+			{
+				int64_t value = p_Value;
+				EncodeValue(p_Cursor, p_End, FastLogFormat::Int, &value);
+			}
+			else if constexpr (std::is_integral_v<T>)
+			{
+				uint64_t value = p_Value;
+				EncodeValue(p_Cursor, p_End, FastLogFormat::UInt, &value);
+			}
+			else if constexpr (std::is_floating_point_v<T>)
+			{
+				double value = p_Value;
+				EncodeValue(p_Cursor, p_End, FastLogFormat::Double, &value);
+			}
+			else if constexpr (std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>)
+			{
+				const char* value = p_Value;
+				EncodeString(p_Cursor, p_End, value ? value : "(null)");
+			}
+			else if constexpr (std::is_pointer_v<T>)
+			{
+				uint64_t value = (uint64_t)(uintptr_t)p_Value;
+				EncodeValue(p_Cursor, p_End, FastLogFormat::Pointer, &value);
+			}
+			else
+				static_assert(sizeof(T) == 0, "VT_LOG_FAST Only Takes Numbers, Enums, Strings And Pointers.");
+		}
+
+		static void Encode(uint8_t*& p_Cursor, uint8_t* p_End, const std::string& p_Value) { EncodeString(p_Cursor, p_End, p_Value); }
+		static void Encode(uint8_t*& p_Cursor, uint8_t* p_End, std::string_view p_Value) { EncodeString(p_Cursor, p_End, p_Value); }
+	private: // Helper
+		static FastLogThreadBuffer* CreateThreadBuffer();
+	private: // Static Member Variables
+		inline static thread_local FastLogThreadBuffer* s_ThreadBuffer = nullptr;
+	};
+}
+
+#if VT_ENABLE_FAST_LOG
+	#define VT_LOG_FAST(format, ...) do { static constexpr ::Violet::FastLogSite s_FastLogSite = { format, __FILE__, __LINE__ }; ::Violet::FastLog::Write(&s_FastLogSite, ##__VA_ARGS__); } while (0)
+#else
+	#define VT_LOG_FAST(format, ...) do {} while (0)
+#endif
+
+#endif // __VIOLET_ENGINE_DEBUG_FAST_LOG_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,179 @@
+/////////////////
+///
+/// FlightRecorder.cpp
+/// Violet McAllister
+/// July 18th, 2022
+/// Updated: August 6th, 2022
+///
+/// Contains implementations for the flight
+/// recorder.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Debug/FlightRecorder.h"
+
+#include <fstream>
+#include <iomanip>
+
+namespace Violet
+{
+	/**
+	 * @brief Allocates the event ring and starts recording. Must
+	 * be called from the main thread outside of a frame.
+	 * @param p_Settings The settings for the flight recorder.
+	 */
+	void FlightRecorder::Enable(const FlightRecorderSettings& p_Settings)
+	{
+		VT_CORE_ASSERT(p_Settings.FrameCount > 0, "Flight Recorder Needs At Least One Frame!");
+
+		// Replacing a ring in use goes through Disable, which waits for its recorders.
+		if (IsEnabled())
+			Disable();
+
+		m_Settings = p_Settings;
+
+		// Round the capacity up to a power of two so the ring index is a mask.
+		uint64_t capacity = 1;
+		while (capacity < m_Settings.EventCapacity)
+			capacity <<= 1;
+
+		JobSystem::Wait(m_DumpJob);
+		m_Events = std::make_unique<Slot[]>(capacity);
+		m_EventCapacity = capacity;
+		m_EventMask = capacity - 1;
+		m_Head.store(0, std::memory_order_relaxed);
+
+		m_FrameEnds.assign(m_Settings.FrameCount + 1, 0);
+		m_FrameIndex = 0;
+
+		// Publishes the ring to Record.
+		m_Enabled.store(true);
+		Instrumentor::Get().SetSinkEnabled(Instrumentor::FlightRecorderSink, true);
+	}
+
+	/**
+	 * @brief Stops recording and frees the event ring once no
+	 * thread is still recording into it. Must be called from the
+	 * main thread outside of a frame.
+	 */
+	void FlightRecorder::Disable()
+	{
+		Instrumentor::Get().SetSinkEnabled(Instrumentor::FlightRecorderSink, false);
+		m_Enabled.store(false);
+
+		// Workers may have passed the sink check before it was cleared and still be writing.
+		while (m_Recorders.load(std::memory_order_acquire) != 0)
+			std::this_thread::yield();
+
+		// The dump job may still be reading the ring.
+		JobSystem::Wait(m_DumpJob);
+		m_Events.reset();
+		m_EventCapacity = 0;
+		m_FrameEnds.clear();
+	}
+
+	/**
+	 * @brief Marks the end of a frame and dumps the recorded
+	 * frames from a job if it went over the threshold.
+	 * @param p_FrameTime The duration of the frame in microseconds.
+	 */
+	void FlightRecorder::EndFrame(double p_FrameTime)
+	{
+		uint64_t head = m_Head.load(std::memory_order_relaxed);
+		uint64_t slots = m_FrameEnds.size();
+		m_FrameEnds[m_FrameIndex % slots] = head;
+		m_FrameIndex++;
+
+		if (p_FrameTime < m_Settings.ThresholdMilliseconds * 1000.0)
+			return;
+
+		auto now = std::chrono::steady_clock::now();
+		if (m_DumpCount > 0 && std::chrono::duration<float>(now - m_LastDump).count() < m_Settings.CooldownSeconds)
+			return;
+		if (m_DumpJob.load(std::memory_order_acquire) != 0)
+			return;
+
+		// The oldest frame kept starts where the frame before it ended.
+		uint64_t begin = 0;
+		if (m_FrameIndex > m_Settings.FrameCount)
+			begin = m_FrameEnds[(m_FrameIndex - m_Settings.FrameCount - 1) % slots];
+
+		// Events older than the ring capacity have already been overwritten.
+		if (head - begin > m_EventCapacity)
+			begin = head - m_EventCapacity;
+
+		// Writing the file off the frame thread keeps the dump from adding a hitch of its own.
+		uint32_t dumpIndex = m_DumpCount++;
+		JobSystem::Schedule("FlightRecorder Dump", [this, begin, head, p_FrameTime, dumpIndex]()
+		{
+			Dump(begin, head, p_FrameTime, dumpIndex);
+		}, &m_DumpJob);
+		m_LastDump = now;
+	}
+
+	/**
+	 * @brief Writes a range of the event ring to a trace file. Runs
+	 * as a job while events keep being recorded, events overwritten
+	 * before they were copied are left out.
+	 * @param p_Begin The index of the first event.
+	 * @param p_End The index after the last event.
+	 * @param p_FrameTime The duration of the slow frame in microseconds.
+	 * @param p_DumpIndex The number of the dump, for the file name.
+	 */
+	void FlightRecorder::Dump(uint64_t p_Begin, uint64_t p_End, double p_FrameTime, uint32_t p_DumpIndex) const
+	{
+		VT_PROFILE_FUNCTION();
+
+		// Copy first, the ring is overwritten while the file is written.
+		std::vector<FlightRecorderEvent> events;
+		events.reserve(p_End - p_Begin);
+		for (uint64_t index = p_Begin; index < p_End; index++)
+		{
+			const Slot& slot = m_Events[index & m_EventMask];
+			uint64_t sequence = slot.Sequence.load(std::memory_order_acquire);
+			if (sequence != index * 2 + 2)
+				continue;
+
+			FlightRecorderEvent event = { slot.Name.load(std::memory_order_relaxed), slot.Start.load(std::memory_order_relaxed),
+				slot.ElapsedTime.load(std::memory_order_relaxed), slot.ThreadID.load(std::memory_order_relaxed) };
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (slot.Sequence.load(std::memory_order_relaxed) != sequence)
+				continue;
+
+			events.push_back(event);
+		}
+
+		std::string filepath = m_Settings.OutputPrefix + "-" + std::to_string(p_DumpIndex) + ".json";
+
+		std::ofstream output(filepath);
+		if (!output.is_open())
+		{
+			VT_CORE_ERROR("Flight Recorder Could Not Open Results File '{0}'.", filepath);
+			return;
+		}
+
+		output << std::setprecision(3) << std::fixed;
+		output << "{\"otherData\": {},\"traceEvents\":[";
+		for (size_t i = 0; i < events.size(); i++)
+		{
+			const FlightRecorderEvent& event = events[i];
+
+			if (i != 0)
+				output << ',';
+			output << '{';
+			output << "\"cat\":\"function\",";
+			output << "\"dur\":" << event.ElapsedTime << ',';
+			output << "\"name\":\"" << event.Name << "\",";
+			output << "\"ph\":\"X\",";
+			output << "\"pid\":0,";
+			output << "\"tid\":" << event.ThreadID << ",";
+			output << "\"ts\":" << event.Start;
+			output << '}';
+		}
+		output << "]}";
+
+		VT_CORE_WARN("Slow Frame ({0:.2f}ms), Flight Record Written To '{1}'.", p_FrameTime / 1000.0, filepath);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,155 @@
+/////////////////
+///
+/// FlightRecorder.h
+/// Violet McAllister
+/// July 18th, 2022
+/// Updated: August 6th, 2022
+///
+/// Keeps the most recent frames of profile
+/// events in memory and dumps them to a trace
+/// file whenever a frame takes too long. Off
+/// until enabled, see Application::Startup.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_DEBUG_FLIGHT_RECORDER_H_INCLUDED__
+#define __VIOLET_ENGINE_DEBUG_FLIGHT_RECORDER_H_INCLUDED__
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Violet/Core/JobSystem.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Contains the settings for the flight recorder.
+	 */
+	struct FlightRecorderSettings
+	{
+		uint32_t FrameCount = 120;
+		uint32_t EventCapacity = 1 << 16;
+		float ThresholdMilliseconds = 50.0f;
+		float CooldownSeconds = 10.0f;
+		std::string OutputPrefix = "VioletFlightRecord";
+	};
+
+	/**
+	 * @brief A single recorded profile element. The name
+	 * must point to static storage.
+	 */
+	struct FlightRecorderEvent
+	{
+		const char* Name;
+		double Start;
+		double ElapsedTime;
+		std::thread::id ThreadID;
+	};
+
+	/**
+	 * @brief Records profile events into a fixed ring and
+	 * writes out the last few frames when a slow frame is
+	 * detected. Frames are delimited by VT_PROFILE_FRAME.
+	 */
+	class FlightRecorder
+	{
+	public: // Constructors & Deconstructors
+		FlightRecorder(const FlightRecorder&) = delete;
+		FlightRecorder(FlightRecorder&&) = delete;
+	public: // Main Functionality
+		void Enable(const FlightRecorderSettings& p_Settings);
+		void Disable();
+
+		/**
+		 * @brief Records a profile event into the ring, overwriting
+		 * the oldest event when the ring is full.
+		 * @param p_Name The name of the event.
+		 * @param p_Start The start of the event in microseconds.
+		 * @param p_ElapsedTime The duration of the event in microseconds.
+		 * @param p_ThreadID The thread the event happened on.
+		 */
+		void Record(const char* p_Name, double p_Start, double p_ElapsedTime, std::thread::id p_ThreadID)
+		{
+			// Disable waits for recorders already counted here before it frees the ring.
+			m_Recorders.fetch_add(1);
+			if (!m_Enabled.load())
+			{
+				m_Recorders.fetch_sub(1, std::memory_order_release);
+				return;
+			}
+
+			// Odd while the slot is written, 2 * (index + 1) once it holds event index.
+			uint64_t index = m_Head.fetch_add(1, std::memory_order_relaxed);
+			Slot& slot = m_Events[index & m_EventMask];
+			slot.Sequence.store(index * 2 + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			slot.Name.store(p_Name, std::memory_order_relaxed);
+			slot.Start.store(p_Start, std::memory_order_relaxed);
+			slot.ElapsedTime.store(p_ElapsedTime, std::memory_order_relaxed);
+			slot.ThreadID.store(p_ThreadID, std::memory_order_relaxed);
+			slot.Sequence.store(index * 2 + 2, std::memory_order_release);
+
+			m_Recorders.fetch_sub(1, std::memory_order_release);
+		}
+
+		void EndFrame(double p_FrameTime);
+	public: // Getters & Setters
+		/**
+		 * @brief Gets the flight recorder instance.
+		 * @returns The flight recorder instance.
+		 */
+		static FlightRecorder& Get()
+		{
+			static FlightRecorder instance;
+			return instance;
+		}
+
+		bool IsEnabled() const { return m_Enabled.load(std::memory_order_relaxed); }
+		const FlightRecorderSettings& GetSettings() const { return m_Settings; }
+		uint32_t GetDumpCount() const { return m_DumpCount; }
+	private: // Constructors
+		FlightRecorder() = default;
+	private: // Private Structures
+		/**
+		 * @brief A ring slot. Written by any thread while the dump
+		 * job reads it, the sequence tells the reader whether the
+		 * event it copied is whole and the one it asked for.
+		 */
+		struct Slot
+		{
+			std::atomic<uint64_t> Sequence = 0;
+			std::atomic<const char*> Name = nullptr;
+			std::atomic<double> Start = 0.0;
+			std::atomic<double> ElapsedTime = 0.0;
+			std::atomic<std::thread::id> ThreadID = std::thread::id();
+		};
+	private: // Helper
+		void Dump(uint64_t p_Begin, uint64_t p_End, double p_FrameTime, uint32_t p_DumpIndex) const;
+	private: // Private Member Variables
+		FlightRecorderSettings m_Settings;
+		std::atomic<bool> m_Enabled = false;
+		std::atomic<uint32_t> m_Recorders = 0; // Threads inside Record.
+
+		std::unique_ptr<Slot[]> m_Events;
+		uint64_t m_EventCapacity = 0;
+		uint64_t m_EventMask = 0;
+		std::atomic<uint64_t> m_Head = 0;
+
+		// Ring of event indices at the end of each frame, one more than FrameCount.
+		std::vector<uint64_t> m_FrameEnds;
+		uint64_t m_FrameIndex = 0;
+
+		std::chrono::steady_clock::time_point m_LastDump;
+		uint32_t m_DumpCount = 0;
+
+		// Dumps are written by a job, at most one at a time.
+		JobCounter m_DumpJob = 0;
+	};
+}
+
+#endif // __VIOLET_ENGINE_DEBUG_FLIGHT_RECORDER_H_INCLUDED__
\ No newline at end of file
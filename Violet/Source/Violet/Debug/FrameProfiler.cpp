@@ -0,0 +1,153 @@
+/////////////////
+///
+/// FrameProfiler.cpp
+/// Violet McAllister
+/// July 19th, 2022
+/// Updated: July 29th, 2022
+///
+/// Contains implementations for the frame
+/// profiler.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Debug/FrameProfiler.h"
+
+#include "Violet/Memory/STLAllocator.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Starts collecting profile results.
+	 */
+	void FrameProfiler::Enable()
+	{
+		Reset();
+
+		m_Enabled = true;
+		Instrumentor::Get().SetSinkEnabled(Instrumentor::FrameProfilerSink, true);
+	}
+
+	/**
+	 * @brief Stops collecting profile results. The collected
+	 * statistics are kept until the next Enable or Reset.
+	 */
+	void FrameProfiler::Disable()
+	{
+		Instrumentor::Get().SetSinkEnabled(Instrumentor::FrameProfilerSink, false);
+		m_Enabled = false;
+	}
+
+	/**
+	 * @brief Clears every collected statistic.
+	 */
+	void FrameProfiler::Reset()
+	{
+		std::lock_guard lock(m_Mutex);
+
+		m_Scopes.clear();
+		m_ScopeIndices.clear();
+		m_CurrentFrame.clear();
+		m_LastFrame.clear();
+		m_LastFrameStart = 0.0;
+		m_LastFrameTime = 0.0f;
+
+		m_FrameTimes.assign(FrameHistoryCount, 0.0f);
+		m_FrameTimeOffset = 0;
+	}
+
+	/**
+	 * @brief Records a profile element for the current frame.
+	 * @param p_Name The name of the element, in static storage.
+	 * @param p_Start The start of the element in microseconds.
+	 * @param p_ElapsedTime The duration of the element in microseconds.
+	 * @param p_ThreadID The thread the element happened on.
+	 */
+	void FrameProfiler::Record(const char* p_Name, double p_Start, float p_ElapsedTime, std::thread::id p_ThreadID)
+	{
+		std::lock_guard lock(m_Mutex);
+		if (!m_Paused)
+			m_CurrentFrame.push_back({ p_Name, p_Start, p_ElapsedTime, p_ThreadID });
+	}
+
+	/**
+	 * @brief Folds the current frame into the statistics and
+	 * keeps its events for display.
+	 * @param p_FrameTime The duration of the frame in microseconds.
+	 */
+	void FrameProfiler::EndFrame(float p_FrameTime)
+	{
+		std::lock_guard lock(m_Mutex);
+		if (m_Paused)
+		{
+			m_CurrentFrame.clear();
+			return;
+		}
+
+		for (ProfileScopeStats& stats : m_Scopes)
+		{
+			stats.FrameCallCount = 0;
+			stats.FrameTime = 0.0f;
+		}
+
+		for (const FrameProfilerEvent& event : m_CurrentFrame)
+		{
+			auto [it, inserted] = m_ScopeIndices.try_emplace(event.Name, (uint32_t)m_Scopes.size());
+			if (inserted)
+			{
+				ProfileScopeStats& created = m_Scopes.emplace_back();
+				created.Name = event.Name;
+				created.Samples.reserve(SampleCount);
+			}
+
+			ProfileScopeStats& stats = m_Scopes[it->second];
+			stats.CallCount++;
+			stats.TotalTime += event.ElapsedTime;
+			stats.MinTime = std::min(stats.MinTime, event.ElapsedTime);
+			stats.MaxTime = std::max(stats.MaxTime, event.ElapsedTime);
+			stats.FrameCallCount++;
+			stats.FrameTime += event.ElapsedTime;
+
+			if (stats.Samples.size() < SampleCount)
+				stats.Samples.push_back(event.ElapsedTime);
+			else
+				stats.Samples[stats.SampleIndex] = event.ElapsedTime;
+			stats.SampleIndex = (stats.SampleIndex + 1) % SampleCount;
+		}
+
+		// The frame scope is recorded last, but it starts first.
+		m_LastFrameTime = p_FrameTime;
+		m_LastFrameStart = m_CurrentFrame.empty() ? 0.0 : m_CurrentFrame.back().Start;
+		std::swap(m_CurrentFrame, m_LastFrame);
+		m_CurrentFrame.clear();
+
+		m_FrameTimes[m_FrameTimeOffset] = p_FrameTime / 1000.0f;
+		m_FrameTimeOffset = (m_FrameTimeOffset + 1) % FrameHistoryCount;
+	}
+
+	/**
+	 * @brief Computes percentiles over the recent samples of a scope.
+	 * @param p_Stats The scope statistics.
+	 * @param p_P50 The median time.
+	 * @param p_P95 The 95th percentile time.
+	 * @param p_P99 The 99th percentile time.
+	 */
+	void FrameProfiler::GetPercentiles(const ProfileScopeStats& p_Stats, float& p_P50, float& p_P95, float& p_P99)
+	{
+		if (p_Stats.Samples.empty())
+		{
+			p_P50 = p_P95 = p_P99 = 0.0f;
+			return;
+		}
+
+		// Only called from the main thread, the copy lives in frame memory.
+		FrameVector<float> sorted(p_Stats.Samples.begin(), p_Stats.Samples.end());
+		std::sort(sorted.begin(), sorted.end());
+
+		size_t last = sorted.size() - 1;
+		p_P50 = sorted[(size_t)(last * 0.50f)];
+		p_P95 = sorted[(size_t)(last * 0.95f)];
+		p_P99 = sorted[(size_t)(last * 0.99f)];
+	}
+}
\ No newline at end of file
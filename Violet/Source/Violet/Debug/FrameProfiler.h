@@ -0,0 +1,127 @@
+/////////////////
+///
+/// FrameProfiler.h
+/// Violet McAllister
+/// July 19th, 2022
+///
+/// Aggregates profile scopes in memory for
+/// in-engine display: per-scope statistics, a
+/// frame-time history, and the events of the
+/// last completed frame.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_DEBUG_FRAME_PROFILER_H_INCLUDED__
+#define __VIOLET_ENGINE_DEBUG_FRAME_PROFILER_H_INCLUDED__
+
+#include <cfloat>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Violet
+{
+	/**
+	 * @brief Contains the statistics of a single profile scope.
+	 * Times are in microseconds.
+	 */
+	struct ProfileScopeStats
+	{
+		const char* Name = nullptr;
+
+		uint64_t CallCount = 0;
+		double TotalTime = 0.0;
+		float MinTime = FLT_MAX;
+		float MaxTime = 0.0f;
+
+		// Calls and time spent in the last completed frame.
+		uint32_t FrameCallCount = 0;
+		float FrameTime = 0.0f;
+
+		// Ring of the most recent call times used for percentiles.
+		std::vector<float> Samples;
+		uint32_t SampleIndex = 0;
+
+		float GetAverageTime() const { return CallCount ? (float)(TotalTime / CallCount) : 0.0f; }
+	};
+
+	/**
+	 * @brief A single profile element of the last frame.
+	 */
+	struct FrameProfilerEvent
+	{
+		const char* Name;
+		double Start;
+		float ElapsedTime;
+		std::thread::id ThreadID;
+	};
+
+	/**
+	 * @brief Collects profile results while enabled. Frames are
+	 * delimited by VT_PROFILE_FRAME. Readers must own lock on
+	 * the mutex returned by GetMutex.
+	 */
+	class FrameProfiler
+	{
+	public: // Constants
+		static constexpr uint32_t SampleCount = 256;
+		static constexpr uint32_t FrameHistoryCount = 240;
+	public: // Constructors & Deconstructors
+		FrameProfiler(const FrameProfiler&) = delete;
+		FrameProfiler(FrameProfiler&&) = delete;
+	public: // Main Functionality
+		void Enable();
+		void Disable();
+		void Reset();
+
+		void Record(const char* p_Name, double p_Start, float p_ElapsedTime, std::thread::id p_ThreadID);
+		void EndFrame(float p_FrameTime);
+
+		static void GetPercentiles(const ProfileScopeStats& p_Stats, float& p_P50, float& p_P95, float& p_P99);
+	public: // Getters & Setters
+		/**
+		 * @brief Gets the frame profiler instance.
+		 * @returns The frame profiler instance.
+		 */
+		static FrameProfiler& Get()
+		{
+			static FrameProfiler instance;
+			return instance;
+		}
+
+		bool IsEnabled() const { return m_Enabled; }
+		bool IsPaused() const { return m_Paused; }
+		void SetPaused(bool p_Paused) { m_Paused = p_Paused; }
+
+		std::mutex& GetMutex() { return m_Mutex; }
+		const std::vector<ProfileScopeStats>& GetScopes() const { return m_Scopes; }
+		const std::vector<FrameProfilerEvent>& GetLastFrameEvents() const { return m_LastFrame; }
+		double GetLastFrameStart() const { return m_LastFrameStart; }
+		float GetLastFrameTime() const { return m_LastFrameTime; }
+
+		// Frame times in milliseconds, oldest first starting at the offset.
+		const std::vector<float>& GetFrameTimes() const { return m_FrameTimes; }
+		uint32_t GetFrameTimeOffset() const { return m_FrameTimeOffset; }
+	private: // Constructors
+		FrameProfiler() = default;
+	private: // Private Member Variables
+		std::mutex m_Mutex;
+		bool m_Enabled = false;
+		bool m_Paused = false;
+
+		std::vector<ProfileScopeStats> m_Scopes;
+		std::unordered_map<const char*, uint32_t> m_ScopeIndices;
+
+		std::vector<FrameProfilerEvent> m_CurrentFrame;
+		std::vector<FrameProfilerEvent> m_LastFrame;
+		double m_LastFrameStart = 0.0;
+		float m_LastFrameTime = 0.0f;
+
+		std::vector<float> m_FrameTimes;
+		uint32_t m_FrameTimeOffset = 0;
+	};
+}
+
+#endif // __VIOLET_ENGINE_DEBUG_FRAME_PROFILER_H_INCLUDED__
\ No newline at end of file
@@ -3,36 +3,65 @@
 /// Instrumentor.h
 /// Violet McAllister
 /// July 15th, 2022
+/// Updated: August 6th, 2022
 /// 
 /// Instrumentation information and
 /// implementations.
 ///
+/// Profiling is split into compile-time levels
+/// (see VT_PROFILE_LEVEL) and a runtime switch.
+/// When no sink (a session, the flight recorder or
+/// the frame profiler) is capturing, a scope costs a single branch on a
+/// global flag.
+///
 /////////////////
 
 #ifndef __VIOLET_ENGINE_DEBUG_INSTRUMENTOR_H_INCLUDED__
 #define __VIOLET_ENGINE_DEBUG_INSTRUMENTOR_H_INCLUDED__
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <fstream>
+#include <initializer_list>
 #include <iomanip>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
+
+#include "Violet/Debug/AllocationTracker.h"
+#include "Violet/Debug/FlightRecorder.h"
+#include "Violet/Debug/FrameProfiler.h"
+#include "Violet/Debug/ProfileClock.h"
 
 namespace Violet
 {
 	using FloatingPointMicroseconds = std::chrono::duration<double, std::micro>;
 
 	/**
-	 * @brief Contains the name, start, end, and thread ID of
-	 * a profile element.
+	 * @brief Contains the name, start, duration, and thread ID of
+	 * a profile element. The name points to static storage. The
+	 * allocation counts are only filled in when allocations are
+	 * tracked.
 	 */
 	struct ProfileResult
 	{
-		std::string Name;
+		const char* Name;
 		FloatingPointMicroseconds Start;
-		std::chrono::microseconds ElapsedTime;
+		FloatingPointMicroseconds ElapsedTime;
 		std::thread::id ThreadID;
+		uint64_t Allocations = 0;
+		uint64_t AllocatedBytes = 0;
+	};
+
+	/**
+	 * @brief A named value of a counter track.
+	 */
+	struct ProfileCounterValue
+	{
+		const char* Name;
+		double Value;
 	};
 
 	/**
@@ -50,14 +79,18 @@ namespace Violet
 	 */
 	class Instrumentor
 	{
+	public: // Sinks
+		static constexpr uint32_t SessionSink = 1 << 0;
+		static constexpr uint32_t FlightRecorderSink = 1 << 1;
+		static constexpr uint32_t FrameProfilerSink = 1 << 2;
 	public: // Constructor
 		/**
 		 * @brief Constructs an Instrumentor object. 
 		 */
 		Instrumentor()
-			: m_CurrentSession(nullptr)
+			: m_CurrentSession(nullptr), m_Enabled(true), m_Sinks(0), m_FramesRemaining(0)
 		{
-
+			ProfileClock::Calibrate();
 		}
 	public: // Main Functionality
 		/**
@@ -68,28 +101,7 @@ namespace Violet
 		void BeginSession(const std::string& p_Name, const std::string& p_Filepath = "results.json")
 		{
 			std::lock_guard lock(m_Mutex);
-			if (m_CurrentSession) {
-				// If there is already a current session, then close it before beginning new one.
-				// Subsequent profiling output meant for the original session will end up in the
-				// newly opened session instead.  That's better than having badly formatted
-				// profiling output.
-				if (Log::GetCoreLogger()) { // Edge case: BeginSession() might be before Log::Init()
-					VT_CORE_ERROR("Instrumentor::BeginSession('{0}') when session '{1}' already open.", p_Name, m_CurrentSession->Name);
-				}
-				InternalEndSession();
-			}
-
-			m_OutputStream.open(p_Filepath);
-
-			if (m_OutputStream.is_open()) {
-				m_CurrentSession = new InstrumentationSession({ p_Name });
-				WriteHeader();
-			}
-			else {
-				if (Log::GetCoreLogger()) { // Edge case: BeginSession() might be before Log::Init()
-					VT_CORE_ERROR("Instrumentor could not open results file '{0}'.", p_Filepath);
-				}
-			}
+			InternalBeginSession(p_Name, p_Filepath);
 		}
 
 		/**
@@ -101,6 +113,42 @@ namespace Violet
 			InternalEndSession();
 		}
 
+		/**
+		 * @brief Begins a session which automatically ends after
+		 * a number of frames (see VT_PROFILE_FRAME) have completed.
+		 * Frames count while profiling is disabled too.
+		 * @param p_Name The name of the session.
+		 * @param p_Filepath The path to the results file.
+		 * @param p_FrameCount The number of frames to capture.
+		 */
+		void CaptureFrames(const std::string& p_Name, const std::string& p_Filepath, uint32_t p_FrameCount)
+		{
+			// One lock, so no frame can end between opening and counting.
+			std::lock_guard lock(m_Mutex);
+			InternalBeginSession(p_Name, p_Filepath);
+			if (m_CurrentSession)
+				m_FramesRemaining.store(p_FrameCount, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Runs when a frame scope finishes. Ends a frame
+		 * capture once the requested number of frames is written.
+		 */
+		void OnFrameEnd()
+		{
+			if (m_FramesRemaining.load(std::memory_order_relaxed) == 0)
+				return;
+
+			std::lock_guard lock(m_Mutex);
+			uint32_t remaining = m_FramesRemaining.load(std::memory_order_relaxed);
+			if (remaining > 0)
+			{
+				m_FramesRemaining.store(remaining - 1, std::memory_order_relaxed);
+				if (remaining == 1)
+					InternalEndSession();
+			}
+		}
+
 		/**
 		 * @brief Writes profile information into the instrumentation
 		 * file.
@@ -108,26 +156,107 @@ namespace Violet
 		 */
 		void WriteProfile(const ProfileResult& p_Result)
 		{
-			std::stringstream json;
-
-			json << std::setprecision(3) << std::fixed;
-			json << ",{";
-			json << "\"cat\":\"function\",";
-			json << "\"dur\":" << (p_Result.ElapsedTime.count()) << ',';
-			json << "\"name\":\"" << p_Result.Name << "\",";
-			json << "\"ph\":\"X\",";
-			json << "\"pid\":0,";
-			json << "\"tid\":" << p_Result.ThreadID << ",";
-			json << "\"ts\":" << p_Result.Start.count();
-			json << "}";
+			// Written straight into the file buffer, without a temporary string.
+			std::lock_guard lock(m_Mutex);
+			if (!m_CurrentSession)
+				return;
+
+			m_OutputStream << ",{";
+			if constexpr (AllocationTracker::IsTracking())
+				m_OutputStream << "\"args\":{\"allocs\":" << p_Result.Allocations << ",\"bytes\":" << p_Result.AllocatedBytes << "},";
+			m_OutputStream << "\"cat\":\"function\",";
+			m_OutputStream << "\"dur\":" << (p_Result.ElapsedTime.count()) << ',';
+			m_OutputStream << "\"name\":\"" << p_Result.Name << "\",";
+			m_OutputStream << "\"ph\":\"X\",";
+			m_OutputStream << "\"pid\":0,";
+			m_OutputStream << "\"tid\":" << p_Result.ThreadID << ",";
+			m_OutputStream << "\"ts\":" << p_Result.Start.count();
+			m_OutputStream << "}";
+			m_OutputStream.flush();
+		}
+
+		/**
+		 * @brief Writes a counter event, drawn as a graph track per
+		 * counter name with one series per value.
+		 * @param p_Name The name of the counter track.
+		 * @param p_Values The values of the counter at this moment.
+		 */
+		void WriteCounter(const char* p_Name, std::initializer_list<ProfileCounterValue> p_Values)
+		{
+			double timestamp = ProfileClock::ToMicroseconds(ProfileClock::Now());
 
 			std::lock_guard lock(m_Mutex);
-			if (m_CurrentSession) {
-				m_OutputStream << json.str();
-				m_OutputStream.flush();
+			if (!m_CurrentSession)
+				return;
+
+			m_OutputStream << ",{";
+			m_OutputStream << "\"args\":{";
+			for (const ProfileCounterValue& value : p_Values)
+			{
+				if (&value != p_Values.begin())
+					m_OutputStream << ',';
+				m_OutputStream << "\"" << value.Name << "\":" << value.Value;
+			}
+			m_OutputStream << "},";
+			m_OutputStream << "\"cat\":\"counter\",";
+			m_OutputStream << "\"name\":\"" << p_Name << "\",";
+			m_OutputStream << "\"ph\":\"C\",";
+			m_OutputStream << "\"pid\":0,";
+			m_OutputStream << "\"ts\":" << timestamp;
+			m_OutputStream << "}";
+			m_OutputStream.flush();
+		}
+
+		/**
+		 * @brief Writes a GPU timing onto its own track, shown as a
+		 * separate "GPU" process in the trace.
+		 * @param p_Name The name of the GPU scope.
+		 * @param p_Start The start of the scope in microseconds.
+		 * @param p_ElapsedTime The GPU duration in microseconds.
+		 */
+		void WriteGPUProfile(const char* p_Name, double p_Start, double p_ElapsedTime)
+		{
+			std::lock_guard lock(m_Mutex);
+			if (!m_CurrentSession)
+				return;
+
+			if (!m_GPUTrackNamed) {
+				m_OutputStream << ",{\"args\":{\"name\":\"GPU\"},\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1}";
+				m_GPUTrackNamed = true;
 			}
+
+			m_OutputStream << ",{";
+			m_OutputStream << "\"cat\":\"gpu\",";
+			m_OutputStream << "\"dur\":" << p_ElapsedTime << ',';
+			m_OutputStream << "\"name\":\"" << p_Name << "\",";
+			m_OutputStream << "\"ph\":\"X\",";
+			m_OutputStream << "\"pid\":1,";
+			m_OutputStream << "\"tid\":0,";
+			m_OutputStream << "\"ts\":" << p_Start;
+			m_OutputStream << "}";
+			m_OutputStream.flush();
+		}
+
+		/**
+		 * @brief Names the calling thread in the trace. The name is
+		 * kept and written to every session opened afterwards.
+		 * @param p_Name The name of the thread.
+		 */
+		void SetThreadName(const std::string& p_Name)
+		{
+			std::thread::id threadID = std::this_thread::get_id();
+
+			std::lock_guard lock(m_Mutex);
+			auto it = std::find_if(m_ThreadNames.begin(), m_ThreadNames.end(), [&](const auto& p_Entry) { return p_Entry.first == threadID; });
+			if (it != m_ThreadNames.end())
+				it->second = p_Name;
+			else
+				m_ThreadNames.emplace_back(threadID, p_Name);
+
+			if (m_CurrentSession)
+				WriteThreadName(threadID, p_Name);
 		}
-	public: // Getter
+	public: // Getters & Setters
 		/**
 		 * @brief Gets the instrumentor instance.
 		 * @returns The instrumentor instance.
@@ -137,13 +266,71 @@ namespace Violet
 			static Instrumentor instance;
 			return instance;
 		}
+
+		/**
+		 * @brief Gets the sinks currently capturing profile results.
+		 * This is the only check a profile scope performs when
+		 * profiling is switched off.
+		 * @returns The mask of active sinks.
+		 */
+		static uint32_t GetActiveSinks() { return s_ActiveSinks.load(std::memory_order_relaxed); }
+
+		/**
+		 * @brief Checks whether profile results are currently being
+		 * captured by any sink.
+		 * @returns If profile results are being captured.
+		 */
+		static bool IsActive() { return GetActiveSinks() != 0; }
+
+		/**
+		 * @brief Sets the runtime profiling switch. While disabled,
+		 * sessions stay open but no sink receives results.
+		 * @param p_Enabled Whether profiling is enabled or not.
+		 */
+		void SetEnabled(bool p_Enabled)
+		{
+			std::lock_guard lock(m_Mutex);
+			m_Enabled = p_Enabled;
+			UpdateActive();
+		}
+
+		/**
+		 * @brief Gets the runtime profiling switch.
+		 * @returns Whether profiling is enabled or not.
+		 */
+		bool IsEnabled() const { return m_Enabled; }
+
+		/**
+		 * @brief Turns a sink other than the session on or off.
+		 * @param p_Sink The sink to change.
+		 * @param p_Enabled Whether the sink receives results.
+		 */
+		void SetSinkEnabled(uint32_t p_Sink, bool p_Enabled)
+		{
+			std::lock_guard lock(m_Mutex);
+			m_Sinks = p_Enabled ? (m_Sinks | p_Sink) : (m_Sinks & ~p_Sink);
+			UpdateActive();
+		}
 	private: // Helper
 		/**
 		 * @brief Writes the JSON file header.
 		 */
 		void WriteHeader()
 		{
-			m_OutputStream << "{\"otherData\": {},\"traceEvents\":[";
+			// Events are written with a leading comma, so the list starts with an empty one.
+			m_OutputStream << "{\"otherData\": {},\"traceEvents\":[{}";
+			m_OutputStream.flush();
+		}
+
+		/**
+		 * @brief Writes the name of a thread as trace metadata. NOTE:
+		 * You must own lock on m_Mutex before calling this.
+		 * @param p_ThreadID The thread.
+		 * @param p_Name The name of the thread.
+		 */
+		void WriteThreadName(std::thread::id p_ThreadID, const std::string& p_Name)
+		{
+			m_OutputStream << ",{\"args\":{\"name\":\"" << p_Name << "\"},\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << p_ThreadID << "}";
 			m_OutputStream.flush();
 		}
 
@@ -156,6 +343,41 @@ namespace Violet
 			m_OutputStream.flush();
 		}
 
+		/**
+		 * @brief Begins a session internally. NOTE: You
+		 * must own lock on m_Mutex before calling this.
+		 */
+		void InternalBeginSession(const std::string& p_Name, const std::string& p_Filepath)
+		{
+			if (m_CurrentSession) {
+				// If there is already a current session, then close it before beginning new one.
+				// Subsequent profiling output meant for the original session will end up in the
+				// newly opened session instead.  That's better than having badly formatted
+				// profiling output.
+				if (Log::GetCoreLogger()) { // Edge case: BeginSession() might be before Log::Init()
+					VT_CORE_ERROR("Instrumentor::BeginSession('{0}') when session '{1}' already open.", p_Name, m_CurrentSession->Name);
+				}
+				InternalEndSession();
+			}
+
+			m_OutputStream.open(p_Filepath);
+			m_OutputStream << std::setprecision(3) << std::fixed;
+
+			if (m_OutputStream.is_open()) {
+				m_CurrentSession = new InstrumentationSession({ p_Name });
+				m_GPUTrackNamed = false;
+				WriteHeader();
+				for (const auto& [threadID, name] : m_ThreadNames)
+					WriteThreadName(threadID, name);
+				UpdateActive();
+			}
+			else {
+				if (Log::GetCoreLogger()) { // Edge case: BeginSession() might be before Log::Init()
+					VT_CORE_ERROR("Instrumentor could not open results file '{0}'.", p_Filepath);
+				}
+			}
+		}
+
 		/**
 		 * @brief Ends the session internally. NOTE: You
 		 * must own lock on m_Mutex before calling this.
@@ -166,25 +388,53 @@ namespace Violet
 				m_OutputStream.close();
 				delete m_CurrentSession;
 				m_CurrentSession = nullptr;
+				m_FramesRemaining.store(0, std::memory_order_relaxed);
+				UpdateActive();
 			}
 		}
+
+		/**
+		 * @brief Recomputes the global active sinks. NOTE: You
+		 * must own lock on m_Mutex before calling this.
+		 */
+		void UpdateActive()
+		{
+			uint32_t sinks = m_Sinks | (m_CurrentSession ? SessionSink : 0);
+			s_ActiveSinks.store(m_Enabled ? sinks : 0, std::memory_order_relaxed);
+		}
 	private: // Private Member Variables
 		std::mutex m_Mutex;
 		InstrumentationSession* m_CurrentSession;
 		std::ofstream m_OutputStream;
+		bool m_Enabled;
+		uint32_t m_Sinks;
+		std::atomic<uint32_t> m_FramesRemaining;
+		bool m_GPUTrackNamed = false;
+		std::vector<std::pair<std::thread::id, std::string>> m_ThreadNames;
+	private: // Static Member Variables
+		inline static std::atomic<uint32_t> s_ActiveSinks = 0;
 	};
 
 	class InstrumentationTimer
 	{
 	public: // Constructors & Deconstructors
 		/**
-		 * @brief Constructs an Instrumentation Timer with a name.
+		 * @brief Constructs an Instrumentation Timer with a name. The
+		 * timer is born stopped when nothing is being captured, except
+		 * frame timers, which always count down a frame capture.
 		 * @param p_Name The name of the timer.
+		 * @param p_Frame Whether the timer marks the end of a frame.
 		 */
-		InstrumentationTimer(const char* p_Name)
-			: m_Name(p_Name), m_Stopped(false)
+		InstrumentationTimer(const char* p_Name, bool p_Frame = false)
+			: m_Name(p_Name), m_Frame(p_Frame), m_Stopped(!p_Frame && !Instrumentor::IsActive())
 		{
-			m_StartTimepoint = std::chrono::steady_clock::now();
+			if (!m_Stopped)
+			{
+#ifdef VT_TRACK_ALLOCATIONS
+				m_StartAllocations = AllocationTracker::GetThreadStats();
+#endif
+				m_StartTicks = ProfileClock::Now();
+			}
 		}
 
 		/**
@@ -202,17 +452,49 @@ namespace Violet
 		 */
 		void Stop()
 		{
-			auto endTimepoint = std::chrono::steady_clock::now();
-			auto highResStart = FloatingPointMicroseconds{ m_StartTimepoint.time_since_epoch() };
-			auto elapsedTime = std::chrono::time_point_cast<std::chrono::microseconds>(endTimepoint).time_since_epoch() - std::chrono::time_point_cast<std::chrono::microseconds>(m_StartTimepoint).time_since_epoch();
+			uint64_t endTicks = ProfileClock::Now();
+			double start = ProfileClock::ToMicroseconds(m_StartTicks);
+			double elapsedTime = ProfileClock::DurationToMicroseconds(endTicks - m_StartTicks);
 
-			Instrumentor::Get().WriteProfile({ m_Name, highResStart, elapsedTime, std::this_thread::get_id() });
+			ProfileResult result = { m_Name, FloatingPointMicroseconds{ start }, FloatingPointMicroseconds{ elapsedTime }, std::this_thread::get_id() };
+#ifdef VT_TRACK_ALLOCATIONS
+			const AllocationStats& endAllocations = AllocationTracker::GetThreadStats();
+			result.Allocations = endAllocations.Allocations - m_StartAllocations.Allocations;
+			result.AllocatedBytes = endAllocations.BytesAllocated - m_StartAllocations.BytesAllocated;
+#endif
+
+			// The sinks' own allocations are not charged to the enclosing scopes.
+			AllocationTracker::IgnoreScope ignoreAllocations;
+
+			uint32_t sinks = Instrumentor::GetActiveSinks();
+			if (sinks & Instrumentor::SessionSink)
+				Instrumentor::Get().WriteProfile(result);
+			if (m_Frame)
+				Instrumentor::Get().OnFrameEnd();
+
+			if (sinks & Instrumentor::FlightRecorderSink)
+			{
+				FlightRecorder::Get().Record(m_Name, start, elapsedTime, std::this_thread::get_id());
+				if (m_Frame)
+					FlightRecorder::Get().EndFrame(elapsedTime);
+			}
+
+			if (sinks & Instrumentor::FrameProfilerSink)
+			{
+				FrameProfiler::Get().Record(m_Name, start, (float)elapsedTime, std::this_thread::get_id());
+				if (m_Frame)
+					FrameProfiler::Get().EndFrame((float)elapsedTime);
+			}
 
 			m_Stopped = true;
 		}
 	private: // Private Member Variables
 		const char* m_Name;
-		std::chrono::time_point<std::chrono::steady_clock> m_StartTimepoint;
+		uint64_t m_StartTicks = 0;
+#ifdef VT_TRACK_ALLOCATIONS
+		AllocationStats m_StartAllocations;
+#endif
+		bool m_Frame;
 		bool m_Stopped;
 	};
 
@@ -246,39 +528,101 @@ namespace Violet
 	}
 }
 
-#define VT_PROFILE 1
-#if VT_PROFILE
-	// Resolve which function signature macro will be used. Note that this only
-		// is resolved when the (pre)compiler starts, so the syntax highlighting
-		// could mark the wrong one in your editor!
-	#if defined(__GNUC__) || (defined(__MWERKS__) && (__MWERKS__ >= 0x3000)) || (defined(__ICC) && (__ICC >= 600)) || defined(__ghs__)
-		#define VT_FUNC_SIG __PRETTY_FUNCTION__
-	#elif defined(__DMC__) && (__DMC__ >= 0x810)
-		#define VT_FUNC_SIG __PRETTY_FUNCTION__
-	#elif (defined(__FUNCSIG__) || (_MSC_VER))
-		#define VT_FUNC_SIG __FUNCSIG__
-	#elif (defined(__INTEL_COMPILER) && (__INTEL_COMPILER >= 600)) || (defined(__IBMCPP__) && (__IBMCPP__ >= 500))
-		#define VT_FUNC_SIG __FUNCTION__
-	#elif defined(__BORLANDC__) && (__BORLANDC__ >= 0x550)
-		#define VT_FUNC_SIG __FUNC__
-	#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901)
-		#define VT_FUNC_SIG __func__
-	#elif defined(__cplusplus) && (__cplusplus >= 201103)
-		#define VT_FUNC_SIG __func__
+// Profiling levels. Each level includes the scopes of the levels below it.
+//     OFF      - No profiling code is compiled.
+//     FRAME    - Only frame scopes (VT_PROFILE_FRAME) and sessions.
+//     FUNCTION - Adds VT_PROFILE_FUNCTION and VT_PROFILE_SCOPE.
+//     VERBOSE  - Adds per-call scopes on hot paths (binds, draw calls).
+// Override by defining VT_PROFILE_LEVEL in the build configuration.
+#define VT_PROFILE_LEVEL_OFF 0
+#define VT_PROFILE_LEVEL_FRAME 1
+#define VT_PROFILE_LEVEL_FUNCTION 2
+#define VT_PROFILE_LEVEL_VERBOSE 3
+
+#ifndef VT_PROFILE_LEVEL
+	#ifdef VT_DIST
+		#define VT_PROFILE_LEVEL VT_PROFILE_LEVEL_FRAME
 	#else
-		#define VT_FUNC_SIG "HZ_FUNC_SIG unknown!"
+		#define VT_PROFILE_LEVEL VT_PROFILE_LEVEL_FUNCTION
 	#endif
+#endif
+
+#define VT_PROFILE (VT_PROFILE_LEVEL > VT_PROFILE_LEVEL_OFF)
 
+// Resolve which function signature macro will be used. Note that this only
+// is resolved when the (pre)compiler starts, so the syntax highlighting
+// could mark the wrong one in your editor!
+#if defined(__GNUC__) || (defined(__MWERKS__) && (__MWERKS__ >= 0x3000)) || (defined(__ICC) && (__ICC >= 600)) || defined(__ghs__)
+	#define VT_FUNC_SIG __PRETTY_FUNCTION__
+#elif defined(__DMC__) && (__DMC__ >= 0x810)
+	#define VT_FUNC_SIG __PRETTY_FUNCTION__
+#elif (defined(__FUNCSIG__) || (_MSC_VER))
+	#define VT_FUNC_SIG __FUNCSIG__
+#elif (defined(__INTEL_COMPILER) && (__INTEL_COMPILER >= 600)) || (defined(__IBMCPP__) && (__IBMCPP__ >= 500))
+	#define VT_FUNC_SIG __FUNCTION__
+#elif defined(__BORLANDC__) && (__BORLANDC__ >= 0x550)
+	#define VT_FUNC_SIG __FUNC__
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901)
+	#define VT_FUNC_SIG __func__
+#elif defined(__cplusplus) && (__cplusplus >= 201103)
+	#define VT_FUNC_SIG __func__
+#else
+	#define VT_FUNC_SIG "VT_FUNC_SIG unknown!"
+#endif
+
+// Pastes __LINE__ after expansion so several scopes can live in one block.
+#define VT_PROFILE_CONCAT_INTERNAL(a, b) a##b
+#define VT_PROFILE_CONCAT(a, b) VT_PROFILE_CONCAT_INTERNAL(a, b)
+
+// The cleaned up name is static so the timer only ever holds a pointer to it.
+#define VT_PROFILE_SCOPE_INTERNAL(name, line, frame) static constexpr auto VT_PROFILE_CONCAT(fixedName, line) = ::Violet::InstrumentorUtils::CleanupOutputString(name, "__cdecl ");\
+									::Violet::InstrumentationTimer VT_PROFILE_CONCAT(timer, line)(VT_PROFILE_CONCAT(fixedName, line).Data, frame)
+
+#if VT_PROFILE_LEVEL >= VT_PROFILE_LEVEL_FRAME
 	#define VT_PROFILE_BEGIN_SESSION(name, filepath) ::Violet::Instrumentor::Get().BeginSession(name, filepath)
 	#define VT_PROFILE_END_SESSION() ::Violet::Instrumentor::Get().EndSession()
-	#define VT_PROFILE_SCOPE(name) constexpr auto fixedName = ::Violet::InstrumentorUtils::CleanupOutputString(name, "__cdecl ");\
-									::Violet::InstrumentationTimer timer##__LINE__(fixedName.Data)
-	#define VT_PROFILE_FUNCTION() VT_PROFILE_SCOPE(VT_FUNC_SIG)
+	#define VT_PROFILE_CAPTURE_FRAMES(name, filepath, count) ::Violet::Instrumentor::Get().CaptureFrames(name, filepath, count)
+	#define VT_PROFILE_SET_ENABLED(enabled) ::Violet::Instrumentor::Get().SetEnabled(enabled)
+	#define VT_PROFILE_ENABLE_FLIGHT_RECORDER(settings) ::Violet::FlightRecorder::Get().Enable(settings)
+	#define VT_PROFILE_DISABLE_FLIGHT_RECORDER() ::Violet::FlightRecorder::Get().Disable()
+	#define VT_PROFILE_FRAME(name) VT_PROFILE_SCOPE_INTERNAL(name, __LINE__, true)
+	#define VT_PROFILE_COUNTER(name, ...) do { if (::Violet::Instrumentor::GetActiveSinks() & ::Violet::Instrumentor::SessionSink) ::Violet::Instrumentor::Get().WriteCounter(name, { __VA_ARGS__ }); } while (0)
+	#define VT_PROFILE_THREAD(name) ::Violet::Instrumentor::Get().SetThreadName(name)
 #else
 	#define VT_PROFILE_BEGIN_SESSION(name, filepath)
 	#define VT_PROFILE_END_SESSION()
+	#define VT_PROFILE_CAPTURE_FRAMES(name, filepath, count)
+	#define VT_PROFILE_SET_ENABLED(enabled)
+	#define VT_PROFILE_ENABLE_FLIGHT_RECORDER(settings)
+	#define VT_PROFILE_DISABLE_FLIGHT_RECORDER()
+	#define VT_PROFILE_FRAME(name)
+	#define VT_PROFILE_COUNTER(name, ...) do { } while (0)
+	#define VT_PROFILE_THREAD(name)
+#endif
+
+#if VT_PROFILE_LEVEL >= VT_PROFILE_LEVEL_FUNCTION
+	// Sessions opened automatically for the whole lifetime of the application.
+	// Builds below this level only capture on demand.
+	#define VT_PROFILE_BEGIN_AUTO_SESSION(name, filepath) VT_PROFILE_BEGIN_SESSION(name, filepath)
+	#define VT_PROFILE_END_AUTO_SESSION() VT_PROFILE_END_SESSION()
+	#define VT_PROFILE_SCOPE(name) VT_PROFILE_SCOPE_INTERNAL(name, __LINE__, false)
+	#define VT_PROFILE_FUNCTION() VT_PROFILE_SCOPE(VT_FUNC_SIG)
+	// For names only known at runtime, the name must still be in static storage.
+	#define VT_PROFILE_SCOPE_DYNAMIC(name) ::Violet::InstrumentationTimer VT_PROFILE_CONCAT(timer, __LINE__)(name)
+#else
+	#define VT_PROFILE_BEGIN_AUTO_SESSION(name, filepath)
+	#define VT_PROFILE_END_AUTO_SESSION()
 	#define VT_PROFILE_SCOPE(name)
 	#define VT_PROFILE_FUNCTION()
-#endif 
+	#define VT_PROFILE_SCOPE_DYNAMIC(name)
+#endif
+
+#if VT_PROFILE_LEVEL >= VT_PROFILE_LEVEL_VERBOSE
+	#define VT_PROFILE_VERBOSE_SCOPE(name) VT_PROFILE_SCOPE(name)
+	#define VT_PROFILE_VERBOSE_FUNCTION() VT_PROFILE_FUNCTION()
+#else
+	#define VT_PROFILE_VERBOSE_SCOPE(name)
+	#define VT_PROFILE_VERBOSE_FUNCTION()
+#endif
 
 #endif // __VIOLET_ENGINE_DEBUG_INSTRUMENTOR_H_INCLUDED__
\ No newline at end of file
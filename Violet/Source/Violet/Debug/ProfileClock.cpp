@@ -0,0 +1,83 @@
+/////////////////
+///
+/// ProfileClock.cpp
+/// Violet McAllister
+/// July 21st, 2022
+/// Updated: August 6th, 2022
+///
+/// Contains implementations for the profile
+/// clock.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Debug/ProfileClock.h"
+
+#if VT_PROFILE_CLOCK_TSC && !defined(_MSC_VER)
+	#include <cpuid.h>
+#endif
+
+namespace Violet
+{
+	/**
+	 * @brief Measures the tick rate against steady_clock and sets
+	 * the point both timelines are anchored at. Only the first call
+	 * calibrates, it must run before other threads read the clock:
+	 * later calls do nothing, so the conversion never changes under
+	 * a reader and recorded timestamps never shift.
+	 */
+	void ProfileClock::Calibrate()
+	{
+		using namespace std::chrono;
+
+		static bool s_Calibrated = false;
+		if (s_Calibrated)
+			return;
+		s_Calibrated = true;
+
+		// The source is picked once, so a scope never mixes tick kinds.
+		s_UsingTSC = IsTSCInvariant();
+		if (!s_UsingTSC)
+			return;
+
+		// Sample both clocks over a short window and use the ratio.
+		auto steadyStart = steady_clock::now();
+		uint64_t ticksStart = Now();
+		auto steadyEnd = steadyStart;
+		while (steadyEnd - steadyStart < milliseconds(10))
+			steadyEnd = steady_clock::now();
+		uint64_t ticksEnd = Now();
+
+		double elapsedMicroseconds = duration<double, std::micro>(steadyEnd - steadyStart).count();
+		s_MicrosecondsPerTick = elapsedMicroseconds / (double)(ticksEnd - ticksStart);
+		s_BaseTicks = ticksEnd;
+		s_BaseMicroseconds = duration<double, std::micro>(steadyEnd.time_since_epoch()).count();
+	}
+
+	/**
+	 * @brief Checks whether the time stamp counter runs at a
+	 * constant rate in every power state (CPUID 0x80000007, EDX
+	 * bit 8).
+	 * @returns If the TSC can be used as a clock.
+	 */
+	bool ProfileClock::IsTSCInvariant()
+	{
+#if VT_PROFILE_CLOCK_TSC
+		unsigned int registers[4] = { 0 };
+	#ifdef _MSC_VER
+		__cpuid((int*)registers, 0x80000000);
+		if (registers[0] < 0x80000007)
+			return false;
+		__cpuid((int*)registers, 0x80000007);
+	#else
+		if (!__get_cpuid(0x80000000, &registers[0], &registers[1], &registers[2], &registers[3]) || registers[0] < 0x80000007)
+			return false;
+		__get_cpuid(0x80000007, &registers[0], &registers[1], &registers[2], &registers[3]);
+	#endif
+		return (registers[3] & (1 << 8)) != 0;
+#else
+		return false;
+#endif
+	}
+}
\ No newline at end of file
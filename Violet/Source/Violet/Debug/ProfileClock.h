@@ -0,0 +1,84 @@
+/////////////////
+///
+/// ProfileClock.h
+/// Violet McAllister
+/// July 21st, 2022
+/// Updated: August 6th, 2022
+///
+/// Clock source for profile timestamps. Reads the
+/// CPU time stamp counter when it is invariant and
+/// falls back to std::chrono::steady_clock.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_DEBUG_PROFILE_CLOCK_H_INCLUDED__
+#define __VIOLET_ENGINE_DEBUG_PROFILE_CLOCK_H_INCLUDED__
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(__x86_64__)
+	#define VT_PROFILE_CLOCK_TSC 1
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#else
+		#include <x86intrin.h>
+	#endif
+#else
+	#define VT_PROFILE_CLOCK_TSC 0
+#endif
+
+namespace Violet
+{
+	/**
+	 * @brief Reads raw profile ticks and converts them to
+	 * microseconds on the steady_clock timeline, so profile
+	 * timestamps line up with every other steady_clock time.
+	 */
+	class ProfileClock
+	{
+	public: // Main Functionality
+		/**
+		 * @brief Reads the current time in ticks.
+		 * @returns The current time in ticks.
+		 */
+		static uint64_t Now()
+		{
+#if VT_PROFILE_CLOCK_TSC
+			if (s_UsingTSC)
+				return __rdtsc();
+#endif
+			return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		/**
+		 * @brief Converts a tick timestamp to microseconds.
+		 * @param p_Ticks The timestamp in ticks.
+		 * @returns The timestamp in microseconds.
+		 */
+		static double ToMicroseconds(uint64_t p_Ticks)
+		{
+			return s_BaseMicroseconds + (double)(int64_t)(p_Ticks - s_BaseTicks) * s_MicrosecondsPerTick;
+		}
+
+		/**
+		 * @brief Converts a tick duration to microseconds.
+		 * @param p_Ticks The duration in ticks.
+		 * @returns The duration in microseconds.
+		 */
+		static double DurationToMicroseconds(uint64_t p_Ticks) { return (double)p_Ticks * s_MicrosecondsPerTick; }
+
+		static void Calibrate();
+	public: // Getters
+		static bool IsUsingTSC() { return s_UsingTSC; }
+	private: // Helper
+		static bool IsTSCInvariant();
+	private: // Static Member Variables
+		inline static bool s_UsingTSC = false;
+		inline static uint64_t s_BaseTicks = 0;
+		inline static double s_BaseMicroseconds = 0.0;
+		inline static double s_MicrosecondsPerTick = 0.001;
+	};
+}
+
+#endif // __VIOLET_ENGINE_DEBUG_PROFILE_CLOCK_H_INCLUDED__
\ No newline at end of file
@@ -3,7 +3,7 @@
 /// Event.h
 /// Violet McAllister
 /// June 30th, 2022
-/// Updated: July 16th, 2022
+/// Updated: July 24th, 2022
 ///
 /// Contains Event Types, Categories, and a Dispatcher.
 /// 
@@ -51,7 +51,8 @@ namespace Violet
 		EventCategoryInput			= BIT(1),
 		EventCategoryKeyboard		= BIT(2),
 		EventCategoryMouse			= BIT(3),
-		EventCategoryMouseButton	= BIT(4)
+		EventCategoryMouseButton	= BIT(4),
+		EventCategoryAll			= ~0
 	};
 
 	/**
@@ -69,13 +70,8 @@ namespace Violet
 	/**
 	 * @brief Defines the functionality of a Violet Event.
 	 * 
-	 * Event in Violet are currently blocking, meaning that when
-	 * an event occurs it immediately gets dispatched and must be
-	 * dealt with right then and there.
-	 * 
-	 * For the future, a better strategy might be to buffer events
-	 * in an event bus and process them during the "event" part of
-	 * the update stage.
+	 * Window events are buffered in an EventQueue while polling
+	 * and dispatched together at the start of the next frame.
 	 * 
 	 */
 	class Event
@@ -115,9 +111,26 @@ namespace Violet
 		bool Handled = false;
 	};
 
+	/**
+	 * @brief Deduces the class and event type of an event
+	 * handler member function, bool C::Fn(T&).
+	 */
+	template<typename F>
+	struct EventHandlerTraits;
+
+	template<typename C, typename T>
+	struct EventHandlerTraits<bool(C::*)(T&)>
+	{
+		using Class = C;
+		using Type = T;
+	};
+
 	/**
 	 * @brief The object which handles the events and determines
 	 * which events are run at which time.
+	 * 
+	 * The event type is read once on construction, so every
+	 * following Dispatch is a single integer comparison.
 	 */
 	class EventDispatcher
 	{
@@ -127,7 +140,7 @@ namespace Violet
 		 * @param p_Event The event we are listening for.
 		 */
 		EventDispatcher(Event& p_Event)
-			: m_Event(p_Event)
+			: m_Event(p_Event), m_Type(p_Event.GetEventType())
 		{
 
 		}
@@ -143,7 +156,7 @@ namespace Violet
 		{
 			// If the type of the internal event is the same as the 
 			// event passed through the dispatcher, run the event function.
-			if (m_Event.GetEventType() == T::GetStaticType())
+			if (m_Type == T::GetStaticType())
 			{
 				// Wizard Referencing & Dereferencing
 				m_Event.Handled = p_Function(static_cast<T&>(m_Event));
@@ -152,8 +165,35 @@ namespace Violet
 			
 			return false;
 		}
+
+		/**
+		 * @brief When the event is triggered, runs the member function
+		 * given as the template argument. The event type is deduced from
+		 * the handler and the call is resolved at compile time.
+		 * 
+		 * dispatcher.Dispatch<&Application::OnWindowClose>(this);
+		 * 
+		 * @param p_Instance The object to call the handler on.
+		 * @returns Verification on if the even has successfully occured.
+		 */
+		template<auto Handler>
+		bool Dispatch(typename EventHandlerTraits<decltype(Handler)>::Class* p_Instance)
+		{
+			using T = typename EventHandlerTraits<decltype(Handler)>::Type;
+
+			if (m_Type == T::GetStaticType())
+			{
+				m_Event.Handled = (p_Instance->*Handler)(static_cast<T&>(m_Event));
+				return true;
+			}
+
+			return false;
+		}
+	public: // Getters
+		EventType GetEventType() const { return m_Type; }
 	private: // Member Variables
 		Event& m_Event;
+		EventType m_Type;
 	};
 
 	/**
@@ -0,0 +1,66 @@
+/////////////////
+///
+/// EventCallback.h
+/// Violet McAllister
+/// July 24th, 2022
+///
+/// A non-owning delegate for event callbacks,
+/// two pointers in size, which never allocates.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_EVENTS_EVENT_CALLBACK_H_INCLUDED__
+#define __VIOLET_ENGINE_EVENTS_EVENT_CALLBACK_H_INCLUDED__
+
+#include "Violet/Events/Event.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Calls a member or free function with an event. The
+	 * function is a template argument, so the call through the
+	 * stored thunk is direct. The instance must outlive the callback.
+	 */
+	class EventCallback
+	{
+	public: // Constructors & Deconstructors
+		EventCallback() = default;
+	public: // Static Creators
+		/**
+		 * @brief Creates a callback calling a member function.
+		 * 
+		 * EventCallback::Bind<&Application::OnEvent>(this);
+		 * 
+		 * @param p_Instance The object to call the function on.
+		 * @returns The callback.
+		 */
+		template<auto Method, typename C>
+		static EventCallback Bind(C* p_Instance)
+		{
+			EventCallback callback;
+			callback.m_Instance = p_Instance;
+			callback.m_Function = [](void* p_Instance, Event& p_Event) { (static_cast<C*>(p_Instance)->*Method)(p_Event); };
+			return callback;
+		}
+
+		/**
+		 * @brief Creates a callback calling a free function.
+		 * @returns The callback.
+		 */
+		template<void(*Function)(Event&)>
+		static EventCallback Bind()
+		{
+			EventCallback callback;
+			callback.m_Function = [](void*, Event& p_Event) { Function(p_Event); };
+			return callback;
+		}
+	public: // Main Functionality
+		void operator()(Event& p_Event) const { m_Function(m_Instance, p_Event); }
+		explicit operator bool() const { return m_Function != nullptr; }
+	private: // Private Member Variables
+		void* m_Instance = nullptr;
+		void (*m_Function)(void*, Event&) = nullptr;
+	};
+}
+
+#endif // __VIOLET_ENGINE_EVENTS_EVENT_CALLBACK_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,43 @@
+/////////////////
+///
+/// EventQueue.cpp
+/// Violet McAllister
+/// July 23rd, 2022
+///
+/// Contains implementations for the event
+/// queue.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Events/EventQueue.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Constructs an EventQueue and allocates both arenas
+	 * up front.
+	 */
+	EventQueue::EventQueue()
+	{
+		for (Buffer& buffer : m_Buffers)
+		{
+			buffer.Arena = new uint8_t[ArenaSize];
+			buffer.Events = new Event*[MaxEvents];
+		}
+	}
+
+	/**
+	 * @brief Deconstructs an EventQueue. Queued events are
+	 * trivially destructible, so the arenas are simply freed.
+	 */
+	EventQueue::~EventQueue()
+	{
+		for (Buffer& buffer : m_Buffers)
+		{
+			delete[] buffer.Arena;
+			delete[] buffer.Events;
+		}
+	}
+}
\ No newline at end of file
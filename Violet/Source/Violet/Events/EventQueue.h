@@ -0,0 +1,122 @@
+/////////////////
+///
+/// EventQueue.h
+/// Violet McAllister
+/// July 23rd, 2022
+///
+/// Buffers events raised while polling the window
+/// so they can be dispatched in one phase of the
+/// run loop instead of inside platform callbacks.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_EVENTS_EVENT_QUEUE_H_INCLUDED__
+#define __VIOLET_ENGINE_EVENTS_EVENT_QUEUE_H_INCLUDED__
+
+#include <new>
+#include <type_traits>
+
+#include "Violet/Events/ApplicationEvent.h"
+#include "Violet/Events/Event.h"
+#include "Violet/Events/MouseEvent.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Collects events into a frame-local arena. Events are
+	 * constructed in place, so queueing never touches the heap.
+	 * Two arenas are swapped on dispatch, so events raised by a
+	 * handler are queued for the next dispatch.
+	 */
+	class EventQueue
+	{
+	public: // Constants
+		static constexpr uint32_t ArenaSize = 64 * 1024;
+		static constexpr uint32_t MaxEvents = 2048;
+	public: // Constructors & Deconstructors
+		EventQueue();
+		~EventQueue();
+
+		EventQueue(const EventQueue&) = delete;
+		EventQueue& operator=(const EventQueue&) = delete;
+	public: // Main Functionality
+		/**
+		 * @brief Constructs an event at the back of the queue. When
+		 * coalescing, a MouseMoved or WindowResize event replaces one
+		 * of the same type directly in front of it.
+		 * @param p_Arguments The arguments to the event constructor.
+		 * @returns If the event was queued.
+		 */
+		template<typename T, typename... Args>
+		bool Push(Args&&... p_Arguments)
+		{
+			static_assert(std::is_base_of_v<Event, T>, "Only events can be queued!");
+			static_assert(std::is_trivially_destructible_v<T>, "Queued events are never destroyed!");
+
+			Buffer& buffer = m_Buffers[m_WriteIndex];
+
+			if constexpr (std::is_same_v<T, MouseMovedEvent> || std::is_same_v<T, WindowResizeEvent>)
+			{
+				if (m_Coalescing && buffer.Count > 0 && buffer.Events[buffer.Count - 1]->GetEventType() == T::GetStaticType())
+				{
+					new (buffer.Events[buffer.Count - 1]) T(std::forward<Args>(p_Arguments)...);
+					m_CoalescedCount++;
+					return true;
+				}
+			}
+
+			uint32_t offset = (buffer.Used + alignof(T) - 1) & ~(uint32_t)(alignof(T) - 1);
+			if (buffer.Count == MaxEvents || offset + sizeof(T) > ArenaSize)
+			{
+				m_DroppedCount++;
+				return false;
+			}
+
+			buffer.Events[buffer.Count++] = new (buffer.Arena + offset) T(std::forward<Args>(p_Arguments)...);
+			buffer.Used = offset + (uint32_t)sizeof(T);
+			return true;
+		}
+
+		/**
+		 * @brief Dispatches every queued event in order and empties
+		 * the queue.
+		 * @param p_Callback Called with each event.
+		 */
+		template<typename F>
+		void Dispatch(const F& p_Callback)
+		{
+			Buffer& buffer = m_Buffers[m_WriteIndex];
+			m_WriteIndex ^= 1;
+
+			for (uint32_t i = 0; i < buffer.Count; i++)
+				p_Callback(*buffer.Events[i]);
+
+			buffer.Count = 0;
+			buffer.Used = 0;
+		}
+	public: // Getters & Setters
+		void SetCoalescing(bool p_Enabled) { m_Coalescing = p_Enabled; }
+		bool IsCoalescing() const { return m_Coalescing; }
+
+		uint32_t GetQueuedCount() const { return m_Buffers[m_WriteIndex].Count; }
+		uint32_t GetCoalescedCount() const { return m_CoalescedCount; }
+		uint32_t GetDroppedCount() const { return m_DroppedCount; }
+	private: // Buffer
+		struct Buffer
+		{
+			uint8_t* Arena = nullptr;
+			Event** Events = nullptr;
+			uint32_t Used = 0;
+			uint32_t Count = 0;
+		};
+	private: // Private Member Variables
+		Buffer m_Buffers[2];
+		uint32_t m_WriteIndex = 0;
+		bool m_Coalescing = true;
+
+		uint32_t m_CoalescedCount = 0;
+		uint32_t m_DroppedCount = 0;
+	};
+}
+
+#endif // __VIOLET_ENGINE_EVENTS_EVENT_QUEUE_H_INCLUDED__
\ No newline at end of file
@@ -2,4 +2,6 @@
 
 #define IMGUI_IMPL_OPENGL_LOADER_GLAD
 #include <examples/imgui_impl_opengl3.cpp>
-#include <examples/imgui_impl_glfw.cpp>
\ No newline at end of file
+#ifdef VT_PLATFORM_WINDOWS
+	#include <examples/imgui_impl_glfw.cpp>
+#endif
\ No newline at end of file
@@ -3,7 +3,7 @@
 /// ImGuiLayer.cpp
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// Defines the implementation for an ImGuiLayer.
 ///
@@ -14,52 +14,75 @@
 #include "Violet/ImGui/ImGuiLayer.h"
 
 #include <imgui.h>
-#include <examples/imgui_impl_glfw.h>
 #include <examples/imgui_impl_opengl3.h>
 
 // Temporary
-#include <GLFW/glfw3.h>
+#ifdef VT_PLATFORM_WINDOWS
+	#include <examples/imgui_impl_glfw.h>
+	#include <GLFW/glfw3.h>
+#endif
 #include <glad/glad.h>
 
 #include "Violet/Core/Application.h"
+#include "Violet/Core/Time.h"
+#include "Violet/Renderer/GPUProfiler.h"
+#include "Violet/Renderer/Renderer.h"
 
 namespace Violet
 {
 	/**
-	 * @brief Runs when the layer is attached to the layerstack.
+	 * @brief Adds the stages setting up ImGui. The context and
+	 * font atlas are built on a worker while the window is being
+	 * created, the backends need the window. Headless windows
+	 * have no platform backend, so viewports are turned off.
+	 * @param p_Sequence The startup sequence.
 	 */
-	void ImGuiLayer::OnAttach()
+	void ImGuiLayer::OnStartup(StartupSequence& p_Sequence)
 	{
-		VT_PROFILE_FUNCTION();
-
-		IMGUI_CHECKVERSION();
-		ImGui::CreateContext();
-		ImGuiIO& io = ImGui::GetIO(); (void)io;
-		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;       // Enable Keyboard Controls
-		//io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
-		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;           // Enable Docking
-		io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;         // Enable Multi-Viewport / Platform Windows
-		//io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoTaskBarIcons;
-		//io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoMerge;
-
-		// Setup Dear ImGui style
-		ImGui::StyleColorsDark();
-		//ImGui::StyleColorsClassic();
-
-		// When viewports are enabled we tweak WindowRounding/WindowBg so platform windows can look identical to regular ones.
-		ImGuiStyle& style = ImGui::GetStyle();
-		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+		StartupStageID context = p_Sequence.Add("ImGui Context", StartupThread::Worker, []()
 		{
-			style.WindowRounding = 0.0f;
-			style.Colors[ImGuiCol_WindowBg].w = 1.0f;
-		}
-
-		Application& app = Application::Get();
-		GLFWwindow* window = static_cast<GLFWwindow*>(app.GetWindow().GetNativeWindow());
-
-		// Setup Platform/Renderer bindings
-		ImGui_ImplGlfw_InitForOpenGL(window, true);
-		ImGui_ImplOpenGL3_Init("#version 410");
+			IMGUI_CHECKVERSION();
+			ImGui::CreateContext();
+			ImGuiIO& io = ImGui::GetIO(); (void)io;
+			io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;       // Enable Keyboard Controls
+			//io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
+			io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;           // Enable Docking
+			io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;         // Enable Multi-Viewport / Platform Windows
+			//io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoTaskBarIcons;
+			//io.ConfigFlags |= ImGuiConfigFlags_ViewportsNoMerge;
+
+			// Setup Dear ImGui style
+			ImGui::StyleColorsDark();
+			//ImGui::StyleColorsClassic();
+
+			// When viewports are enabled we tweak WindowRounding/WindowBg so platform windows can look identical to regular ones.
+			ImGuiStyle& style = ImGui::GetStyle();
+			if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+			{
+				style.WindowRounding = 0.0f;
+				style.Colors[ImGuiCol_WindowBg].w = 1.0f;
+			}
+
+			// Rasterize the font atlas here, the backend only uploads it.
+			io.Fonts->Build();
+		});
+
+		p_Sequence.Add("ImGui Backends", StartupThread::Main, []()
+		{
+			// Setup Platform/Renderer bindings
+		#ifdef VT_PLATFORM_WINDOWS
+			Application& app = Application::Get();
+			GLFWwindow* window = static_cast<GLFWwindow*>(app.GetWindow().GetNativeWindow());
+			ImGui_ImplGlfw_InitForOpenGL(window, true);
+		#else
+			ImGui::GetIO().ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+		#endif
+			// The Null renderer builds the frames but has nothing to draw them with.
+			if (Renderer::GetAPI() == RendererAPI::API::OpenGL)
+				ImGui_ImplOpenGL3_Init("#version 410");
+			else
+				ImGui::GetIO().ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+		}, { context, p_Sequence.Find("Renderer API") });
 	}
 
 	/**
@@ -69,8 +92,11 @@ namespace Violet
 	{
 		VT_PROFILE_FUNCTION();
 
-		ImGui_ImplOpenGL3_Shutdown();
+		if (Renderer::GetAPI() == RendererAPI::API::OpenGL)
+			ImGui_ImplOpenGL3_Shutdown();
+	#ifdef VT_PLATFORM_WINDOWS
 		ImGui_ImplGlfw_Shutdown();
+	#endif
 		ImGui::DestroyContext();
 	}
 
@@ -85,6 +111,14 @@ namespace Violet
 		p_Event.Handled |= p_Event.IsInCategory(EventCategoryKeyboard) & io.WantCaptureKeyboard;
 	}
 
+	/**
+	 * @brief Renders the engine owned ImGui panels.
+	 */
+	void ImGuiLayer::OnImGuiRender()
+	{
+		m_ProfilerPanel.OnImGuiRender();
+	}
+
 	/**
 	 * @brief Begins an ImGui context.
 	 */
@@ -93,8 +127,20 @@ namespace Violet
 		VT_PROFILE_FUNCTION();
 
 		// Initialize
-		ImGui_ImplOpenGL3_NewFrame();
+		if (Renderer::GetAPI() == RendererAPI::API::OpenGL)
+			ImGui_ImplOpenGL3_NewFrame();
+	#ifdef VT_PLATFORM_WINDOWS
 		ImGui_ImplGlfw_NewFrame();
+	#else
+		// Without a platform backend the size and delta time are ours to set.
+		ImGuiIO& io = ImGui::GetIO();
+		Application& app = Application::Get();
+		io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
+
+		double time = Time::GetSeconds();
+		io.DeltaTime = m_Time > 0.0 && time > m_Time ? (float)(time - m_Time) : 1.0f / 60.0f;
+		m_Time = time;
+	#endif
 		ImGui::NewFrame();
 	}
 
@@ -112,8 +158,13 @@ namespace Violet
 
 		// Rendering
 		ImGui::Render();
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		if (Renderer::GetAPI() == RendererAPI::API::OpenGL)
+		{
+			VT_PROFILE_GPU_SCOPE("ImGuiLayer::End");
+			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		}
 
+	#ifdef VT_PLATFORM_WINDOWS
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
 		{
 			GLFWwindow* backup_current_context = glfwGetCurrentContext();
@@ -121,5 +172,6 @@ namespace Violet
 			ImGui::RenderPlatformWindowsDefault();
 			glfwMakeContextCurrent(backup_current_context);
 		}
+	#endif
 	}
 }
\ No newline at end of file
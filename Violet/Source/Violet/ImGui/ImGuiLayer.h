@@ -3,7 +3,7 @@
 /// ImGuiLayer.h
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// Layer to display ImGui items. Defined by application, pushed to
 /// LayerStack on client side.
@@ -17,6 +17,7 @@
 #include "Violet/Events/ApplicationEvent.h"
 #include "Violet/Events/KeyEvent.h"
 #include "Violet/Events/MouseEvent.h"
+#include "Violet/ImGui/ProfilerPanel.h"
 
 namespace Violet
 {
@@ -27,17 +28,21 @@ namespace Violet
 	{
 	public: // Constructors & Deconstructors
 		ImGuiLayer()
-			: Layer("ImGuiLayer") { }
+			: Layer("ImGuiLayer") { SetEventCategories(EventCategoryMouse | EventCategoryKeyboard); }
 		~ImGuiLayer() = default;
 	public: // Overrides
-		virtual void OnAttach() override;
+		virtual void OnStartup(StartupSequence& p_Sequence) override;
 		virtual void OnDetach() override;
 		virtual void OnEvent(Event& p_Event) override;
+		virtual void OnImGuiRender() override;
 	public: // Main Functionality
 		void Begin();
 		void End();
+	public: // Getters & Setters
+		ProfilerPanel& GetProfilerPanel() { return m_ProfilerPanel; }
 	private: // Private Member Variables
-		float m_Time = 0.0f;
+		double m_Time = 0.0;
+		ProfilerPanel m_ProfilerPanel;
 	};
 }
 
@@ -0,0 +1,305 @@
+/////////////////
+///
+/// ProfilerPanel.cpp
+/// Violet McAllister
+/// July 19th, 2022
+/// Updated: August 6th, 2022
+///
+/// Defines the implementation for the profiler
+/// panel.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/ImGui/ProfilerPanel.h"
+
+#include <imgui.h>
+
+#include "Violet/Debug/AllocationTracker.h"
+#include "Violet/Debug/FrameProfiler.h"
+#include "Violet/Memory/STLAllocator.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Opens or closes the panel, turning the frame
+	 * profiler on or off with it.
+	 * @param p_Open Whether the panel is open.
+	 */
+	void ProfilerPanel::SetOpen(bool p_Open)
+	{
+		if (m_Open == p_Open)
+			return;
+
+		m_Open = p_Open;
+		if (m_Open)
+			FrameProfiler::Get().Enable();
+		else
+			FrameProfiler::Get().Disable();
+	}
+
+	/**
+	 * @brief Draws the panel.
+	 */
+	void ProfilerPanel::OnImGuiRender()
+	{
+		if (!m_Open)
+			return;
+
+		CopyProfilerData();
+
+		bool open = true;
+		ImGui::Begin("Profiler", &open);
+
+		bool paused = m_Paused;
+		if (ImGui::Checkbox("Pause", &paused))
+		{
+			FrameProfiler& profiler = FrameProfiler::Get();
+			std::lock_guard lock(profiler.GetMutex());
+			profiler.SetPaused(paused);
+		}
+		ImGui::SameLine();
+		if (ImGui::Button("Reset"))
+			m_ResetRequested = true;
+		ImGui::SameLine();
+		ImGui::Text("Last Frame: %.3f ms", m_LastFrameTime / 1000.0f);
+		if constexpr (AllocationTracker::IsTracking())
+		{
+			const AllocationStats& allocations = AllocationTracker::GetFrameStats();
+			ImGui::SameLine();
+			ImGui::Text("| Allocations: %llu (%llu bytes), Frees: %llu, Allocating Frames: %llu", (unsigned long long)allocations.Allocations, (unsigned long long)allocations.BytesAllocated, (unsigned long long)allocations.Frees, (unsigned long long)AllocationTracker::GetAllocatingFrames());
+		}
+
+		ImGui::PlotLines("##FrameTimes", m_FrameTimes.data(), (int)m_FrameTimes.size(), (int)m_FrameTimeOffset, "Frame Time (ms)", 0.0f, FLT_MAX, ImVec2(ImGui::GetContentRegionAvail().x, 60.0f));
+
+		if (ImGui::CollapsingHeader("Scopes"))
+			DrawScopeTable();
+		if (ImGui::CollapsingHeader("Flame Chart"))
+			DrawFlameChart();
+
+		ImGui::End();
+
+		if (m_ResetRequested)
+		{
+			FrameProfiler::Get().Reset();
+			m_ResetRequested = false;
+		}
+
+		if (!open)
+			SetOpen(false);
+	}
+
+	/**
+	 * @brief Copies what the panel draws out of the frame profiler.
+	 * The copies reuse their storage between frames.
+	 */
+	void ProfilerPanel::CopyProfilerData()
+	{
+		// NOTE: Nothing in here may be profiled, the sink needs this lock.
+		FrameProfiler& profiler = FrameProfiler::Get();
+		std::lock_guard lock(profiler.GetMutex());
+
+		m_Paused = profiler.IsPaused();
+		m_Scopes = profiler.GetScopes();
+		m_Events = profiler.GetLastFrameEvents();
+		m_FrameTimes = profiler.GetFrameTimes();
+		m_FrameTimeOffset = profiler.GetFrameTimeOffset();
+		m_LastFrameStart = profiler.GetLastFrameStart();
+		m_LastFrameTime = profiler.GetLastFrameTime();
+	}
+
+	/**
+	 * @brief Draws every scope as a row of a table sorted by
+	 * the selected column.
+	 */
+	void ProfilerPanel::DrawScopeTable()
+	{
+		const std::vector<ProfileScopeStats>& scopes = m_Scopes;
+
+		// Percentiles are computed once per scope per frame, three values each.
+		m_Percentiles.resize(scopes.size() * 3);
+		m_SortedScopes.resize(scopes.size());
+		for (uint32_t i = 0; i < scopes.size(); i++)
+		{
+			FrameProfiler::GetPercentiles(scopes[i], m_Percentiles[i * 3 + 0], m_Percentiles[i * 3 + 1], m_Percentiles[i * 3 + 2]);
+			m_SortedScopes[i] = i;
+		}
+
+		auto key = [&](uint32_t p_Index) -> double
+		{
+			const ProfileScopeStats& stats = scopes[p_Index];
+			switch (m_SortColumn)
+			{
+				case SortColumn::Calls:     return stats.FrameCallCount;
+				case SortColumn::FrameTime: return stats.FrameTime;
+				case SortColumn::Average:   return stats.GetAverageTime();
+				case SortColumn::Min:       return stats.MinTime;
+				case SortColumn::Max:       return stats.MaxTime;
+				case SortColumn::P50:       return m_Percentiles[p_Index * 3 + 0];
+				case SortColumn::P95:       return m_Percentiles[p_Index * 3 + 1];
+				case SortColumn::P99:       return m_Percentiles[p_Index * 3 + 2];
+				default:                    break;
+			}
+
+			return 0.0;
+		};
+
+		std::sort(m_SortedScopes.begin(), m_SortedScopes.end(), [&](uint32_t p_A, uint32_t p_B)
+		{
+			if (m_SortColumn == SortColumn::Name)
+			{
+				int compare = strcmp(scopes[p_A].Name, scopes[p_B].Name);
+				return m_SortDescending ? compare > 0 : compare < 0;
+			}
+
+			return m_SortDescending ? key(p_A) > key(p_B) : key(p_A) < key(p_B);
+		});
+
+		// Header, clicking a column sorts by it and clicking again flips the order.
+		static const char* s_Headers[] = { "Scope", "Calls", "Frame (ms)", "Avg (ms)", "Min (ms)", "Max (ms)", "p50 (ms)", "p95 (ms)", "p99 (ms)" };
+		constexpr int columnCount = sizeof(s_Headers) / sizeof(s_Headers[0]);
+
+		ImGui::Columns(columnCount, "ProfilerScopes");
+		for (int column = 0; column < columnCount; column++)
+		{
+			bool selected = (int)m_SortColumn == column;
+			char label[32];
+			snprintf(label, sizeof(label), "%s%s", s_Headers[column], selected ? (m_SortDescending ? " v" : " ^") : "");
+
+			if (ImGui::Selectable(label, selected))
+			{
+				if (selected)
+					m_SortDescending = !m_SortDescending;
+				else
+					m_SortColumn = (SortColumn)column;
+			}
+			ImGui::NextColumn();
+		}
+		ImGui::Separator();
+
+		for (uint32_t index : m_SortedScopes)
+		{
+			const ProfileScopeStats& stats = scopes[index];
+
+			ImGui::TextUnformatted(stats.Name); ImGui::NextColumn();
+			ImGui::Text("%u", stats.FrameCallCount); ImGui::NextColumn();
+			ImGui::Text("%.3f", stats.FrameTime / 1000.0f); ImGui::NextColumn();
+			ImGui::Text("%.3f", stats.GetAverageTime() / 1000.0f); ImGui::NextColumn();
+			ImGui::Text("%.3f", stats.MinTime / 1000.0f); ImGui::NextColumn();
+			ImGui::Text("%.3f", stats.MaxTime / 1000.0f); ImGui::NextColumn();
+			ImGui::Text("%.3f", m_Percentiles[index * 3 + 0] / 1000.0f); ImGui::NextColumn();
+			ImGui::Text("%.3f", m_Percentiles[index * 3 + 1] / 1000.0f); ImGui::NextColumn();
+			ImGui::Text("%.3f", m_Percentiles[index * 3 + 2] / 1000.0f); ImGui::NextColumn();
+		}
+
+		ImGui::Columns(1);
+	}
+
+	/**
+	 * @brief Draws the events of the last frame as a flame chart,
+	 * one band of rows per thread.
+	 */
+	void ProfilerPanel::DrawFlameChart()
+	{
+		const std::vector<FrameProfilerEvent>& events = m_Events;
+		float frameTime = m_LastFrameTime;
+		if (events.empty() || frameTime <= 0.0f)
+		{
+			ImGui::Text("No Frame Captured.");
+			return;
+		}
+
+		ImGui::SliderFloat("Zoom", &m_FlameChartZoom, 1.0f, 32.0f);
+
+		// Order by thread, then start time, with enclosing scopes first.
+		FrameVector<std::thread::id> threads;
+		auto threadIndex = [&](std::thread::id p_ThreadID) -> uint32_t
+		{
+			auto it = std::find(threads.begin(), threads.end(), p_ThreadID);
+			if (it != threads.end())
+				return (uint32_t)(it - threads.begin());
+			threads.push_back(p_ThreadID);
+			return (uint32_t)threads.size() - 1;
+		};
+
+		m_FlameOrder.resize(events.size());
+		for (uint32_t i = 0; i < events.size(); i++)
+			m_FlameOrder[i] = i;
+		for (const FrameProfilerEvent& event : events)
+			threadIndex(event.ThreadID);
+
+		std::sort(m_FlameOrder.begin(), m_FlameOrder.end(), [&](uint32_t p_A, uint32_t p_B)
+		{
+			const FrameProfilerEvent& a = events[p_A];
+			const FrameProfilerEvent& b = events[p_B];
+			if (a.ThreadID != b.ThreadID)
+				return threadIndex(a.ThreadID) < threadIndex(b.ThreadID);
+			if (a.Start != b.Start)
+				return a.Start < b.Start;
+			return a.ElapsedTime > b.ElapsedTime;
+		});
+
+		// The depth of an event is the number of still open events on its thread.
+		m_FlameRows.resize(events.size());
+		FrameVector<double> openEnds;
+		uint32_t bandRow = 0, bandDepth = 0;
+		std::thread::id bandThread = events[m_FlameOrder[0]].ThreadID;
+		for (uint32_t index : m_FlameOrder)
+		{
+			const FrameProfilerEvent& event = events[index];
+			if (event.ThreadID != bandThread)
+			{
+				bandRow += bandDepth + 1;
+				bandDepth = 0;
+				bandThread = event.ThreadID;
+				openEnds.clear();
+			}
+
+			while (!openEnds.empty() && openEnds.back() <= event.Start)
+				openEnds.pop_back();
+
+			m_FlameRows[index] = bandRow + (uint32_t)openEnds.size();
+			bandDepth = std::max(bandDepth, (uint32_t)openEnds.size());
+			openEnds.push_back(event.Start + event.ElapsedTime);
+		}
+		uint32_t rowCount = bandRow + bandDepth + 1;
+
+		ImGui::BeginChild("FlameChart", ImVec2(0.0f, 0.0f), true, ImGuiWindowFlags_HorizontalScrollbar);
+
+		ImDrawList* drawList = ImGui::GetWindowDrawList();
+		ImVec2 origin = ImGui::GetCursorScreenPos();
+		float width = ImGui::GetContentRegionAvail().x * m_FlameChartZoom;
+		float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+		double frameStart = m_LastFrameStart;
+
+		for (uint32_t i = 0; i < events.size(); i++)
+		{
+			const FrameProfilerEvent& event = events[i];
+
+			float x0 = origin.x + (float)((event.Start - frameStart) / frameTime) * width;
+			float x1 = std::max(x0 + (event.ElapsedTime / frameTime) * width, x0 + 1.0f);
+			float y0 = origin.y + m_FlameRows[i] * rowHeight;
+			ImVec2 min = { x0, y0 };
+			ImVec2 max = { x1, y0 + rowHeight - 1.0f };
+
+			// Color each scope by its name so it stays stable between frames.
+			uint32_t hash = (uint32_t)(((uintptr_t)event.Name >> 4) * 2654435761u);
+			ImU32 color = IM_COL32(80 + (hash & 0x7F), 80 + ((hash >> 8) & 0x7F), 80 + ((hash >> 16) & 0x7F), 255);
+			drawList->AddRectFilled(min, max, color);
+
+			if (x1 - x0 > 8.0f)
+			{
+				drawList->PushClipRect(min, max, true);
+				drawList->AddText(ImVec2(x0 + 2.0f, y0), IM_COL32(0, 0, 0, 255), event.Name);
+				drawList->PopClipRect();
+			}
+
+			if (ImGui::IsMouseHoveringRect(min, max))
+				ImGui::SetTooltip("%s\n%.3f ms", event.Name, event.ElapsedTime / 1000.0f);
+		}
+
+		ImGui::Dummy(ImVec2(width, rowCount * rowHeight));
+		ImGui::EndChild();
+	}
+}
\ No newline at end of file
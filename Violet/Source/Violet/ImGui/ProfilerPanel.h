@@ -0,0 +1,68 @@
+/////////////////
+///
+/// ProfilerPanel.h
+/// Violet McAllister
+/// July 19th, 2022
+/// Updated: August 6th, 2022
+///
+/// ImGui panel displaying the frame profiler as a
+/// sortable table of scopes, a frame-time graph
+/// and a flame chart of the last frame.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_IMGUI_PROFILER_PANEL_H_INCLUDED__
+#define __VIOLET_ENGINE_IMGUI_PROFILER_PANEL_H_INCLUDED__
+
+#include <cstdint>
+#include <vector>
+
+#include "Violet/Debug/FrameProfiler.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Displays the statistics gathered by the FrameProfiler.
+	 * The profiler only collects while the panel is open.
+	 */
+	class ProfilerPanel
+	{
+	public: // Main Functionality
+		void OnImGuiRender();
+	public: // Getters & Setters
+		bool IsOpen() const { return m_Open; }
+		void SetOpen(bool p_Open);
+	private: // Enums
+		enum class SortColumn
+		{
+			Name = 0, Calls, FrameTime, Average, Min, Max, P50, P95, P99
+		};
+	private: // Helper
+		void CopyProfilerData();
+		void DrawScopeTable();
+		void DrawFlameChart();
+	private: // Private Member Variables
+		bool m_Open = false;
+		SortColumn m_SortColumn = SortColumn::FrameTime;
+		bool m_SortDescending = true;
+		float m_FlameChartZoom = 1.0f;
+		bool m_ResetRequested = false;
+
+		// Copied from the frame profiler each frame, so drawing does not hold its lock.
+		bool m_Paused = false;
+		std::vector<ProfileScopeStats> m_Scopes;
+		std::vector<FrameProfilerEvent> m_Events;
+		std::vector<float> m_FrameTimes;
+		uint32_t m_FrameTimeOffset = 0;
+		double m_LastFrameStart = 0.0;
+		float m_LastFrameTime = 0.0f;
+
+		// Reused between frames to avoid reallocating.
+		std::vector<uint32_t> m_SortedScopes;
+		std::vector<float> m_Percentiles;
+		std::vector<uint32_t> m_FlameOrder;
+		std::vector<uint32_t> m_FlameRows;
+	};
+}
+
+#endif // __VIOLET_ENGINE_IMGUI_PROFILER_PANEL_H_INCLUDED__
\ No newline at end of file
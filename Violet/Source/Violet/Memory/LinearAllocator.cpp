@@ -0,0 +1,152 @@
+/////////////////
+///
+/// LinearAllocator.cpp
+/// Violet McAllister
+/// July 29th, 2022
+/// Updated: August 6th, 2022
+///
+/// Contains implementations for the linear and
+/// frame allocators.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Memory/LinearAllocator.h"
+
+namespace Violet
+{
+	LinearAllocator FrameAllocator::s_Allocators[2];
+	uint32_t FrameAllocator::s_Current = 0;
+
+	/**
+	 * @brief Finds the first offset into a buffer whose address
+	 * has an alignment. The buffer itself is only aligned for
+	 * max_align_t, so the address is aligned rather than the offset.
+	 * @param p_Buffer The buffer.
+	 * @param p_Offset The first free offset.
+	 * @param p_Alignment The alignment, a power of two.
+	 * @returns The aligned offset.
+	 */
+	static size_t AlignOffset(const uint8_t* p_Buffer, size_t p_Offset, size_t p_Alignment)
+	{
+		uintptr_t address = reinterpret_cast<uintptr_t>(p_Buffer) + p_Offset;
+		uintptr_t aligned = (address + p_Alignment - 1) & ~(uintptr_t)(p_Alignment - 1);
+		return p_Offset + (size_t)(aligned - address);
+	}
+
+	/**
+	 * @brief Constructs a LinearAllocator object.
+	 * @param p_Capacity The initial size of the buffer in bytes.
+	 */
+	LinearAllocator::LinearAllocator(size_t p_Capacity)
+	{
+		Reserve(p_Capacity);
+	}
+
+	/**
+	 * @brief Deconstructs a LinearAllocator object, freeing
+	 * every buffer.
+	 */
+	LinearAllocator::~LinearAllocator()
+	{
+		Reset();
+		delete[] m_Buffer;
+	}
+
+	/**
+	 * @brief Allocates memory which lives until the next Reset.
+	 * @param p_Size The size in bytes.
+	 * @param p_Alignment The alignment, a power of two.
+	 * @returns The memory.
+	 */
+	void* LinearAllocator::Allocate(size_t p_Size, size_t p_Alignment)
+	{
+		VT_CORE_ASSERT(p_Alignment && (p_Alignment & (p_Alignment - 1)) == 0, "Alignment Must Be A Power Of Two!");
+
+		size_t offset = AlignOffset(m_Buffer, m_Offset, p_Alignment);
+		if (!m_Buffer || offset + p_Size > m_Capacity)
+		{
+			// The extra alignment bytes cover any start address.
+			Grow(p_Size + p_Alignment);
+			offset = AlignOffset(m_Buffer, m_Offset, p_Alignment);
+		}
+
+		void* memory = m_Buffer + offset;
+		m_Offset = offset + p_Size;
+		m_HighWater = std::max(m_HighWater, GetUsed());
+		return memory;
+	}
+
+	/**
+	 * @brief Frees every allocation at once, along with the
+	 * buffers outgrown since the last Reset.
+	 */
+	void LinearAllocator::Reset()
+	{
+		for (uint8_t* buffer : m_Retired)
+			delete[] buffer;
+		m_Retired.clear();
+		m_RetiredUsed = 0;
+		m_Offset = 0;
+	}
+
+	/**
+	 * @brief Makes sure the buffer holds at least a number of
+	 * bytes. Must only be called right after a Reset.
+	 * @param p_Capacity The size in bytes.
+	 */
+	void LinearAllocator::Reserve(size_t p_Capacity)
+	{
+		if (p_Capacity <= m_Capacity)
+			return;
+
+		VT_CORE_ASSERT(GetUsed() == 0, "Linear Allocator Reserved While In Use!");
+		delete[] m_Buffer;
+		m_Buffer = new uint8_t[p_Capacity];
+		m_Capacity = p_Capacity;
+	}
+
+	/**
+	 * @brief Swaps in a bigger buffer. The old one is kept until
+	 * Reset, since its allocations are still in use.
+	 * @param p_MinimumSize The size the new buffer must fit.
+	 */
+	void LinearAllocator::Grow(size_t p_MinimumSize)
+	{
+		if (m_Buffer)
+		{
+			m_Retired.push_back(m_Buffer);
+			m_RetiredUsed += m_Offset;
+		}
+
+		m_Capacity = std::max({ m_Capacity * 2, p_MinimumSize, (size_t)4096 });
+		m_Buffer = new uint8_t[m_Capacity];
+		m_Offset = 0;
+	}
+
+	/**
+	 * @brief Sets the starting size of both frame buffers.
+	 * @param p_Capacity The size of each buffer in bytes.
+	 */
+	void FrameAllocator::Init(size_t p_Capacity)
+	{
+		for (LinearAllocator& allocator : s_Allocators)
+		{
+			allocator.Reset();
+			allocator.Reserve(p_Capacity);
+		}
+	}
+
+	/**
+	 * @brief Starts a new frame. The buffer of the frame before
+	 * last is freed and becomes the current one.
+	 */
+	void FrameAllocator::NewFrame()
+	{
+		VT_PROFILE_COUNTER("Frame Memory", { "Used", (double)s_Allocators[s_Current].GetUsed() }, { "Capacity", (double)s_Allocators[s_Current].GetCapacity() });
+
+		s_Current = 1 - s_Current;
+		s_Allocators[s_Current].Reset();
+	}
+}
\ No newline at end of file
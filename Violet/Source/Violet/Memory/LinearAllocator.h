@@ -0,0 +1,105 @@
+/////////////////
+///
+/// LinearAllocator.h
+/// Violet McAllister
+/// July 29th, 2022
+///
+/// A bump allocator which frees everything at
+/// once, and the double buffered per frame
+/// allocator built on it.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_MEMORY_LINEAR_ALLOCATOR_H_INCLUDED__
+#define __VIOLET_ENGINE_MEMORY_LINEAR_ALLOCATOR_H_INCLUDED__
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Violet
+{
+	/**
+	 * @brief Hands out memory by bumping an offset and frees it all
+	 * with Reset. When the buffer runs out a bigger one replaces it
+	 * on the next Reset, so after warming up it stops allocating.
+	 * Destructors are never run. Not thread safe.
+	 */
+	class LinearAllocator
+	{
+	public: // Constructors & Deconstructors
+		LinearAllocator(size_t p_Capacity = 0);
+		~LinearAllocator();
+
+		LinearAllocator(const LinearAllocator&) = delete;
+		LinearAllocator& operator=(const LinearAllocator&) = delete;
+	public: // Main Functionality
+		void* Allocate(size_t p_Size, size_t p_Alignment = alignof(std::max_align_t));
+		void Reset();
+		void Reserve(size_t p_Capacity);
+
+		/**
+		 * @brief Constructs an object in the allocator. Its destructor
+		 * is never called.
+		 * @param p_Arguments The constructor arguments.
+		 * @returns The object.
+		 */
+		template<typename T, typename... Args>
+		T* New(Args&&... p_Arguments)
+		{
+			return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(p_Arguments)...);
+		}
+
+		/**
+		 * @brief Allocates an uninitialized array.
+		 * @param p_Count The number of elements.
+		 * @returns The array.
+		 */
+		template<typename T>
+		T* AllocateArray(size_t p_Count)
+		{
+			return static_cast<T*>(Allocate(sizeof(T) * p_Count, alignof(T)));
+		}
+	public: // Getters
+		size_t GetUsed() const { return m_RetiredUsed + m_Offset; }
+		size_t GetCapacity() const { return m_Capacity; }
+		size_t GetHighWater() const { return m_HighWater; }
+	private: // Helper
+		void Grow(size_t p_MinimumSize);
+	private: // Private Member Variables
+		uint8_t* m_Buffer = nullptr;
+		size_t m_Capacity = 0;
+		size_t m_Offset = 0;
+		size_t m_HighWater = 0;
+
+		// Outgrown buffers, still in use until the next Reset.
+		std::vector<uint8_t*> m_Retired;
+		size_t m_RetiredUsed = 0;
+	};
+
+	/**
+	 * @brief Per frame scratch memory. Two linear allocators take
+	 * turns, so memory from the last frame stays valid for the
+	 * whole current frame. Main thread only.
+	 */
+	class FrameAllocator
+	{
+	public: // Main Functionality
+		static void Init(size_t p_Capacity);
+		static void NewFrame();
+
+		static void* Allocate(size_t p_Size, size_t p_Alignment = alignof(std::max_align_t)) { return s_Allocators[s_Current].Allocate(p_Size, p_Alignment); }
+
+		template<typename T>
+		static T* AllocateArray(size_t p_Count) { return s_Allocators[s_Current].AllocateArray<T>(p_Count); }
+	public: // Getters
+		static const LinearAllocator& GetCurrent() { return s_Allocators[s_Current]; }
+	private: // Static Member Variables
+		static LinearAllocator s_Allocators[2];
+		static uint32_t s_Current;
+	};
+}
+
+#endif // __VIOLET_ENGINE_MEMORY_LINEAR_ALLOCATOR_H_INCLUDED__
\ No newline at end of file
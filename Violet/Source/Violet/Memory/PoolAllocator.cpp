@@ -0,0 +1,85 @@
+/////////////////
+///
+/// PoolAllocator.cpp
+/// Violet McAllister
+/// July 29th, 2022
+///
+/// Contains implementations for the pool
+/// allocator.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Memory/PoolAllocator.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Constructs a PoolAllocator object.
+	 * @param p_BlockSize The size of every block in bytes.
+	 * @param p_BlocksPerChunk The number of blocks allocated at once.
+	 * @param p_Alignment The alignment of every block.
+	 */
+	PoolAllocator::PoolAllocator(size_t p_BlockSize, size_t p_BlocksPerChunk, size_t p_Alignment)
+		: m_BlocksPerChunk(p_BlocksPerChunk), m_Alignment(std::max(p_Alignment, alignof(FreeBlock)))
+	{
+		// Free blocks hold the free list, and every block stays aligned.
+		m_BlockSize = std::max(p_BlockSize, sizeof(FreeBlock));
+		m_BlockSize = (m_BlockSize + m_Alignment - 1) & ~(m_Alignment - 1);
+	}
+
+	/**
+	 * @brief Deconstructs a PoolAllocator object, freeing every
+	 * chunk. Objects still allocated are not destroyed.
+	 */
+	PoolAllocator::~PoolAllocator()
+	{
+		for (void* chunk : m_Chunks)
+			::operator delete(chunk, std::align_val_t(m_Alignment));
+	}
+
+	/**
+	 * @brief Allocates a block.
+	 * @returns The block.
+	 */
+	void* PoolAllocator::Allocate()
+	{
+		if (!m_FreeList)
+			AddChunk();
+
+		FreeBlock* block = m_FreeList;
+		m_FreeList = block->Next;
+		m_UsedBlocks++;
+		return block;
+	}
+
+	/**
+	 * @brief Returns a block to the pool.
+	 * @param p_Block The block.
+	 */
+	void PoolAllocator::Free(void* p_Block)
+	{
+		FreeBlock* block = static_cast<FreeBlock*>(p_Block);
+		block->Next = m_FreeList;
+		m_FreeList = block;
+		m_UsedBlocks--;
+	}
+
+	/**
+	 * @brief Allocates another chunk and puts its blocks on the
+	 * free list.
+	 */
+	void PoolAllocator::AddChunk()
+	{
+		uint8_t* chunk = static_cast<uint8_t*>(::operator new(m_BlockSize * m_BlocksPerChunk, std::align_val_t(m_Alignment)));
+		m_Chunks.push_back(chunk);
+
+		for (size_t i = m_BlocksPerChunk; i > 0; i--)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + (i - 1) * m_BlockSize);
+			block->Next = m_FreeList;
+			m_FreeList = block;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+/////////////////
+///
+/// PoolAllocator.h
+/// Violet McAllister
+/// July 29th, 2022
+///
+/// Allocators for many objects of the same size,
+/// reusing freed blocks through a free list.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_MEMORY_POOL_ALLOCATOR_H_INCLUDED__
+#define __VIOLET_ENGINE_MEMORY_POOL_ALLOCATOR_H_INCLUDED__
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Violet
+{
+	/**
+	 * @brief Hands out fixed size blocks. Freed blocks are kept in
+	 * a free list and memory is only returned when the pool is
+	 * destroyed. Not thread safe.
+	 */
+	class PoolAllocator
+	{
+	public: // Constructors & Deconstructors
+		PoolAllocator(size_t p_BlockSize, size_t p_BlocksPerChunk = 256, size_t p_Alignment = alignof(std::max_align_t));
+		~PoolAllocator();
+
+		PoolAllocator(const PoolAllocator&) = delete;
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+	public: // Main Functionality
+		void* Allocate();
+		void Free(void* p_Block);
+	public: // Getters
+		size_t GetBlockSize() const { return m_BlockSize; }
+		size_t GetUsedBlocks() const { return m_UsedBlocks; }
+		size_t GetCapacity() const { return m_Chunks.size() * m_BlocksPerChunk; }
+	private: // Helper
+		void AddChunk();
+	private: // Private Member Variables
+		struct FreeBlock
+		{
+			FreeBlock* Next;
+		};
+
+		size_t m_BlockSize;
+		size_t m_BlocksPerChunk;
+		size_t m_Alignment;
+		size_t m_UsedBlocks = 0;
+		FreeBlock* m_FreeList = nullptr;
+		std::vector<void*> m_Chunks;
+	};
+
+	/**
+	 * @brief A typed PoolAllocator constructing and destroying
+	 * its objects.
+	 */
+	template<typename T>
+	class ObjectPool
+	{
+	public: // Constructors & Deconstructors
+		ObjectPool(size_t p_ObjectsPerChunk = 256)
+			: m_Pool(sizeof(T), p_ObjectsPerChunk, alignof(T)) { }
+	public: // Main Functionality
+		template<typename... Args>
+		T* New(Args&&... p_Arguments)
+		{
+			return new (m_Pool.Allocate()) T(std::forward<Args>(p_Arguments)...);
+		}
+
+		void Delete(T* p_Object)
+		{
+			if (!p_Object)
+				return;
+
+			p_Object->~T();
+			m_Pool.Free(p_Object);
+		}
+	public: // Getters
+		size_t GetUsedObjects() const { return m_Pool.GetUsedBlocks(); }
+	private: // Private Member Variables
+		PoolAllocator m_Pool;
+	};
+}
+
+#endif // __VIOLET_ENGINE_MEMORY_POOL_ALLOCATOR_H_INCLUDED__
\ No newline at end of file
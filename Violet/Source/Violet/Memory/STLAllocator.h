@@ -0,0 +1,86 @@
+/////////////////
+///
+/// STLAllocator.h
+/// Violet McAllister
+/// July 29th, 2022
+///
+/// Adapters letting standard containers use the
+/// frame and linear allocators.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_MEMORY_STL_ALLOCATOR_H_INCLUDED__
+#define __VIOLET_ENGINE_MEMORY_STL_ALLOCATOR_H_INCLUDED__
+
+#include <string>
+#include <vector>
+
+#include "Violet/Memory/LinearAllocator.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Allocates container memory from the FrameAllocator.
+	 * Deallocating does nothing, the memory goes away with the
+	 * frame, so the container must not outlive the next frame.
+	 */
+	template<typename T>
+	class FrameSTLAllocator
+	{
+	public: // Definitions
+		using value_type = T;
+	public: // Constructors
+		FrameSTLAllocator() = default;
+
+		template<typename U>
+		FrameSTLAllocator(const FrameSTLAllocator<U>&) { }
+	public: // Main Functionality
+		T* allocate(size_t p_Count) { return FrameAllocator::AllocateArray<T>(p_Count); }
+		void deallocate(T*, size_t) { }
+	public: // Operators
+		template<typename U>
+		bool operator==(const FrameSTLAllocator<U>&) const { return true; }
+
+		template<typename U>
+		bool operator!=(const FrameSTLAllocator<U>&) const { return false; }
+	};
+
+	/**
+	 * @brief Allocates container memory from a LinearAllocator.
+	 * Deallocating does nothing, the memory goes away with the
+	 * allocator's next Reset.
+	 */
+	template<typename T>
+	class LinearSTLAllocator
+	{
+	public: // Definitions
+		using value_type = T;
+	public: // Constructors
+		LinearSTLAllocator(LinearAllocator& p_Allocator)
+			: m_Allocator(&p_Allocator) { }
+
+		template<typename U>
+		LinearSTLAllocator(const LinearSTLAllocator<U>& p_Other)
+			: m_Allocator(p_Other.GetAllocator()) { }
+	public: // Main Functionality
+		T* allocate(size_t p_Count) { return m_Allocator->AllocateArray<T>(p_Count); }
+		void deallocate(T*, size_t) { }
+	public: // Getters
+		LinearAllocator* GetAllocator() const { return m_Allocator; }
+	public: // Operators
+		template<typename U>
+		bool operator==(const LinearSTLAllocator<U>& p_Other) const { return m_Allocator == p_Other.GetAllocator(); }
+
+		template<typename U>
+		bool operator!=(const LinearSTLAllocator<U>& p_Other) const { return m_Allocator != p_Other.GetAllocator(); }
+	private: // Private Member Variables
+		LinearAllocator* m_Allocator;
+	};
+
+	// Containers living for a single frame.
+	template<typename T>
+	using FrameVector = std::vector<T, FrameSTLAllocator<T>>;
+	using FrameString = std::basic_string<char, std::char_traits<char>, FrameSTLAllocator<char>>;
+}
+
+#endif // __VIOLET_ENGINE_MEMORY_STL_ALLOCATOR_H_INCLUDED__
\ No newline at end of file
@@ -16,6 +16,7 @@
 
 #include "Violet/Renderer/Buffer.h"
 
+#include "Platform/Null/NullBuffer.h"
 #include "Platform/OpenGL/OpenGLBuffer.h"
 
 #include "Violet/Renderer/Renderer.h"
@@ -32,6 +33,8 @@ namespace Violet
 		{
 			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(p_Size);
+			case RendererAPI::API::Null:    return CreateRef<NullVertexBuffer>(p_Size);
+			case RendererAPI::API::Software: return CreateRef<NullVertexBuffer>(p_Size);
 		}
 
 		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -49,6 +52,8 @@ namespace Violet
 		{
 			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(p_Vertices, p_Size);
+			case RendererAPI::API::Null:    return CreateRef<NullVertexBuffer>(p_Vertices, p_Size);
+			case RendererAPI::API::Software: return CreateRef<NullVertexBuffer>(p_Vertices, p_Size);
 		}
 
 		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -66,6 +71,8 @@ namespace Violet
 		{
 			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLIndexBuffer>(p_Indices, p_Count);
+			case RendererAPI::API::Null:    return CreateRef<NullIndexBuffer>(p_Indices, p_Count);
+			case RendererAPI::API::Software: return CreateRef<NullIndexBuffer>(p_Indices, p_Count);
 		}
 
 		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
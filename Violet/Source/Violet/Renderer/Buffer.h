@@ -3,7 +3,7 @@
 /// Buffer.h
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 15th, 2022
+/// Updated: July 30th, 2022
 ///
 /// Contains Vertex & Index Buffer objects used
 /// to store information regarding the vertices
@@ -15,6 +15,8 @@
 #ifndef __VIOLET_ENGINE_RENDERER_BUFFER_H_INCLUDED__
 #define __VIOLET_ENGINE_RENDERER_BUFFER_H_INCLUDED__
 
+#include "Violet/Core/Base.h"
+
 namespace Violet
 {
 	enum class ShaderDataType
@@ -160,7 +162,7 @@ namespace Violet
 	/**
 	 * @brief Contains Vertex information for OpenGL
 	 */
-	class VertexBuffer
+	class VertexBuffer : public SingleThreadRefCounted
 	{
 	public: // Deconstructor
 		virtual ~VertexBuffer() = default;
@@ -179,7 +181,7 @@ namespace Violet
 	/**
 	 * @brief Contsins Index information for OpenGL.
 	 */
-	class IndexBuffer
+	class IndexBuffer : public SingleThreadRefCounted
 	{
 	public: // Deconstructor
 		virtual ~IndexBuffer() = default;
@@ -0,0 +1,59 @@
+/////////////////
+///
+/// GPUProfiler.cpp
+/// Violet McAllister
+/// July 20th, 2022
+///
+/// Creates the GPU profiler for the current
+/// API and implements the GPU profile scope.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Renderer/GPUProfiler.h"
+
+#include "Platform/Null/NullGPUProfiler.h"
+#include "Platform/OpenGL/OpenGLGPUProfiler.h"
+
+#include "Violet/Renderer/Renderer.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Creates a GPUProfiler object based on the current API.
+	 */
+	Scope<GPUProfiler> GPUProfiler::Create()
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:  return CreateScope<OpenGLGPUProfiler>();
+			case RendererAPI::API::Null:    return CreateScope<NullGPUProfiler>();
+			case RendererAPI::API::Software: return CreateScope<NullGPUProfiler>();
+		}
+
+		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	/**
+	 * @brief Begins a GPU query when a session is capturing.
+	 * @param p_Name The name of the scope, in static storage.
+	 */
+	GPUProfileScope::GPUProfileScope(const char* p_Name)
+		: m_Query(GPUProfiler::InvalidQuery)
+	{
+		if (Instrumentor::GetActiveSinks() & Instrumentor::SessionSink)
+			m_Query = Renderer::GetGPUProfiler().BeginQuery(p_Name);
+	}
+
+	/**
+	 * @brief Ends the GPU query if one was started.
+	 */
+	GPUProfileScope::~GPUProfileScope()
+	{
+		if (m_Query != GPUProfiler::InvalidQuery)
+			Renderer::GetGPUProfiler().EndQuery(m_Query);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+/////////////////
+///
+/// GPUProfiler.h
+/// Violet McAllister
+/// July 20th, 2022
+///
+/// Measures how long the GPU spends on scopes of
+/// submitted work. Results are read back a few
+/// frames later so the CPU never waits on them,
+/// then written to the profile trace on a GPU track.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_RENDERER_GPU_PROFILER_H_INCLUDED__
+#define __VIOLET_ENGINE_RENDERER_GPU_PROFILER_H_INCLUDED__
+
+#include "Violet/Core/Base.h"
+#include "Violet/Debug/Instrumentor.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Class definition of a GPU profiler.
+	 */
+	class GPUProfiler
+	{
+	public: // Constants
+		static constexpr uint32_t InvalidQuery = 0xFFFFFFFF;
+	public: // Deconstructor
+		virtual ~GPUProfiler() = default;
+	public: // Main Functionality
+		virtual uint32_t BeginQuery(const char* p_Name) = 0;
+		virtual void EndQuery(uint32_t p_Query) = 0;
+		virtual void EndFrame() = 0;
+	public: // Creator
+		static Scope<GPUProfiler> Create();
+	};
+
+	/**
+	 * @brief Times the GPU work submitted during its lifetime
+	 * while a profile session is open.
+	 */
+	class GPUProfileScope
+	{
+	public: // Constructors & Deconstructors
+		GPUProfileScope(const char* p_Name);
+		~GPUProfileScope();
+	private: // Private Member Variables
+		uint32_t m_Query;
+	};
+}
+
+#if VT_PROFILE_LEVEL >= VT_PROFILE_LEVEL_FUNCTION
+	#define VT_PROFILE_GPU_SCOPE(name) ::Violet::GPUProfileScope VT_PROFILE_CONCAT(gpuTimer, __LINE__)(name)
+#else
+	#define VT_PROFILE_GPU_SCOPE(name)
+#endif
+
+#endif // __VIOLET_ENGINE_RENDERER_GPU_PROFILER_H_INCLUDED__
\ No newline at end of file
@@ -14,7 +14,13 @@
 
 #include "Violet/Renderer/GraphicsContext.h"
 
-#include "Platform/OpenGL/OpenGLContext.h"
+#include "Platform/Null/NullContext.h"
+#ifdef VT_PLATFORM_WINDOWS
+	#include "Platform/OpenGL/OpenGLContext.h"
+#endif
+#ifdef VT_PLATFORM_LINUX
+	#include "Platform/OpenGL/OpenGLHeadlessContext.h"
+#endif
 
 #include "Violet/Renderer/Renderer.h"
 
@@ -29,7 +35,37 @@ namespace Violet
 		switch (Renderer::GetAPI())
 		{
 			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		#ifdef VT_PLATFORM_WINDOWS
 			case RendererAPI::API::OpenGL:  return CreateScope<OpenGLContext>(static_cast<GLFWwindow*>(p_Window));
+		#else
+			case RendererAPI::API::OpenGL:  VT_CORE_ASSERT(false, "Windowed OpenGL Is Not Supported On This Platform!"); return nullptr;
+		#endif
+			case RendererAPI::API::Null:    return CreateScope<NullContext>();
+			case RendererAPI::API::Software: return CreateScope<NullContext>(); // Nothing to create either.
+		}
+
+		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	/**
+	 * @brief Creates an offscreen GraphicsContext object based on
+	 * the current API.
+	 * @param p_Width The width of the offscreen surface.
+	 * @param p_Height The height of the offscreen surface.
+	 */
+	Scope<GraphicsContext> GraphicsContext::CreateHeadless(uint32_t p_Width, uint32_t p_Height)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		#ifdef VT_PLATFORM_LINUX
+			case RendererAPI::API::OpenGL:  return CreateScope<OpenGLHeadlessContext>(p_Width, p_Height);
+		#else
+			case RendererAPI::API::OpenGL:  VT_CORE_ASSERT(false, "Headless OpenGL Is Not Supported On This Platform!"); return nullptr;
+		#endif
+			case RendererAPI::API::Null:    return CreateScope<NullContext>();
+			case RendererAPI::API::Software: return CreateScope<NullContext>(); // Nothing to create either.
 		}
 
 		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -26,6 +26,7 @@ namespace Violet
 		virtual void SwapBuffers() = 0;
 	public: // Creator
 		static Scope<GraphicsContext> Create(void* p_Window);
+		static Scope<GraphicsContext> CreateHeadless(uint32_t p_Width, uint32_t p_Height);
 	};
 }
 
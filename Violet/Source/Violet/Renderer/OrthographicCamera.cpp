@@ -3,7 +3,7 @@
 /// OrthographicCamera.cpp
 /// Violet McAllister
 /// July 12th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 6th, 2022
 ///
 /// An Orthographic Camera is a camera which
 /// shoots parallel rays from a camera. All
@@ -28,11 +28,13 @@ namespace Violet
 	 * @param p_Top Number furthest up on the y-axis.
 	 */
 	OrthographicCamera::OrthographicCamera(float p_Left, float p_Right, float p_Bottom, float p_Top)
-		: m_ProjectionMatrix(glm::ortho(p_Left, p_Right, p_Bottom, p_Top, -1.0f, 1.0f)), m_ViewMatrix(1.0f)
+		: m_ProjectionMatrix(glm::ortho(p_Left, p_Right, p_Bottom, p_Top, -1.0f, 1.0f)), m_ViewMatrix(1.0f),
+		m_ProjectionBounds({ { p_Left, p_Bottom }, { p_Right, p_Top } })
 	{
 		VT_PROFILE_FUNCTION();
 
 		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+		RecalculateViewBounds();
 	}
 
 	/**
@@ -48,6 +50,8 @@ namespace Violet
 
 		m_ProjectionMatrix = glm::ortho(p_Left, p_Right, p_Bottom, p_Top, -1.0f, 1.0f);
 		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+		m_ProjectionBounds = { { p_Left, p_Bottom }, { p_Right, p_Top } };
+		RecalculateViewBounds();
 	}
 
 	/**
@@ -63,5 +67,32 @@ namespace Violet
 
 		m_ViewMatrix = glm::inverse(transform);
 		m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
+		RecalculateViewBounds();
+	}
+
+	/**
+	 * @brief Recalculates the world space view bounds from the
+	 * projection bounds and the transform.
+	 */
+	void OrthographicCamera::RecalculateViewBounds()
+	{
+		if (m_Rotation == 0.0f)
+		{
+			glm::vec2 position = { m_Position.x, m_Position.y };
+			m_ViewBounds = { m_ProjectionBounds.Min + position, m_ProjectionBounds.Max + position };
+			return;
+		}
+
+		float radians = glm::radians(m_Rotation);
+		float cosine = cosf(radians), sine = sinf(radians);
+
+		// The corners of a rotated rectangle reach out by the rotated half size.
+		glm::vec2 halfSize = m_ProjectionBounds.GetSize() * 0.5f;
+		glm::vec2 extent = { halfSize.x * fabsf(cosine) + halfSize.y * fabsf(sine), halfSize.x * fabsf(sine) + halfSize.y * fabsf(cosine) };
+
+		// The projection need not be centered on the camera.
+		glm::vec2 offset = m_ProjectionBounds.GetCenter();
+		glm::vec2 center = { m_Position.x + offset.x * cosine - offset.y * sine, m_Position.y + offset.x * sine + offset.y * cosine };
+		m_ViewBounds = { center - extent, center + extent };
 	}
 }
\ No newline at end of file
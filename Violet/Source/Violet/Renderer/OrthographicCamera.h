@@ -3,7 +3,7 @@
 /// OrthographicCamera.h
 /// Violet McAllister
 /// July 12th, 2022
-/// Updated July 13th, 2022
+/// Updated: August 6th, 2022
 ///
 /// An Orthographic Camera is a camera which
 /// shoots parallel rays from a camera. All
@@ -17,6 +17,8 @@
 
 #include <glm/glm.hpp>
 
+#include "Violet/Core/Bounds2D.h"
+
 namespace Violet
 {
 	class OrthographicCamera
@@ -67,12 +69,22 @@ namespace Violet
 		 * @returns The view projection matrix.
 		 */
 		const glm::mat4& GetViewProjectionMatrix() const { return m_ViewProjectionMatrix; }
+
+		/**
+		 * @brief Gets the world space rectangle the camera sees,
+		 * grown to stay axis aligned when the camera is rotated.
+		 * @returns The view bounds.
+		 */
+		const Bounds2D& GetViewBounds() const { return m_ViewBounds; }
 	private: // Helpers
 		void RecalculateViewMatrix();
+		void RecalculateViewBounds();
 	private: // Matrix Info
 		glm::mat4 m_ProjectionMatrix;
 		glm::mat4 m_ViewMatrix;
 		glm::mat4 m_ViewProjectionMatrix;
+		Bounds2D m_ProjectionBounds;
+		Bounds2D m_ViewBounds;
 	private: // Camera Info
 		glm::vec3 m_Position = { 0.0f, 0.0f, 0.0f };
 		float m_Rotation = 0.0f;
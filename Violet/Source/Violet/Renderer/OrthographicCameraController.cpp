@@ -3,7 +3,7 @@
 /// OrthographicCameraController.cpp
 /// Violet McAllister
 /// July 13th, 2022
-/// Updated: July 15th, 2022
+/// Updated: July 24th, 2022
 ///
 /// Controller for an Orthographic Controller.
 /// 
@@ -92,8 +92,8 @@ namespace Violet
 		VT_PROFILE_FUNCTION();
 
 		EventDispatcher dispatcher(p_Event);
-		dispatcher.Dispatch<MouseScrolledEvent>(VT_BIND_EVENT_FN(OrthographicCameraController::OnMouseScrolled));
-		dispatcher.Dispatch<WindowResizeEvent>(VT_BIND_EVENT_FN(OrthographicCameraController::OnWindowResized));
+		dispatcher.Dispatch<&OrthographicCameraController::OnMouseScrolled>(this);
+		dispatcher.Dispatch<&OrthographicCameraController::OnWindowResized>(this);
 	}
 
 	/**
@@ -19,6 +19,6 @@
 
 namespace Violet
 {
-	// Defines The Renderer API for RenderCommand.
-	Scope<RendererAPI> RenderCommand::s_RendererAPI = RendererAPI::Create();
+	// Defines The Renderer API for RenderCommand, created in Init.
+	Scope<RendererAPI> RenderCommand::s_RendererAPI = nullptr;
 }
\ No newline at end of file
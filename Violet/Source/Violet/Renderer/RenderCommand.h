@@ -24,10 +24,13 @@ namespace Violet
 	{
 	public: // Main Functionality
 		/**
-		 * @brief Initializes the graphics API. 
+		 * @brief Creates and initializes the graphics API. It is
+		 * created here instead of statically so the API can be
+		 * chosen at runtime.
 		 */
 		static void Init()
 		{
+			s_RendererAPI = RendererAPI::Create();
 			s_RendererAPI->Init();
 		}
 
@@ -71,6 +74,20 @@ namespace Violet
 		{
 			s_RendererAPI->DrawIndexed(p_VertexArray, p_Count);
 		}
+
+		/**
+		 * @brief Reads back pixels of the framebuffer, the bottom
+		 * row first.
+		 * @param p_X The left of the rectangle.
+		 * @param p_Y The bottom of the rectangle.
+		 * @param p_Width The width of the rectangle.
+		 * @param p_Height The height of the rectangle.
+		 * @param p_Pixels The RGBA8 pixels, p_Width * p_Height of them.
+		 */
+		static void ReadPixels(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height, uint32_t* p_Pixels)
+		{
+			s_RendererAPI->ReadPixels(p_X, p_Y, p_Width, p_Height, p_Pixels);
+		}
 	private: // Private State Member Variables
 		static Scope<RendererAPI> s_RendererAPI;
 	};
@@ -3,7 +3,7 @@
 /// Renderer.cpp
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// Violet's main renderer which handles
 /// creating and ending a scene, as well
@@ -20,6 +20,19 @@
 namespace Violet
 {
 	Scope<Renderer::SceneData> Renderer::s_SceneData = CreateScope<Renderer::SceneData>();
+	Scope<GPUProfiler> Renderer::s_GPUProfiler = nullptr;
+
+	/**
+	 * @brief Initializes the graphics API and the GPU profiler,
+	 * enough to clear and present a frame.
+	 */
+	void Renderer::InitAPI()
+	{
+		VT_PROFILE_FUNCTION();
+
+		RenderCommand::Init();
+		s_GPUProfiler = GPUProfiler::Create();
+	}
 
 	/**
 	 * @brief Initializes the renderer. 
@@ -28,7 +41,7 @@ namespace Violet
 	{
 		VT_PROFILE_FUNCTION();
 
-		RenderCommand::Init();
+		InitAPI();
 		Renderer2D::Init();
 	}
 
@@ -38,6 +51,7 @@ namespace Violet
 	void Renderer::Shutdown()
 	{
 		Renderer2D::Shutdown();
+		s_GPUProfiler.reset();
 	}
 
 	/**
@@ -50,6 +64,19 @@ namespace Violet
 		RenderCommand::SetViewport(0, 0, p_Width, p_Height);
 	}
 
+	/**
+	 * @brief Runs once at the end of every frame, before the
+	 * buffers are swapped. Writes the per-frame counters and
+	 * collects finished GPU timings.
+	 */
+	void Renderer::EndFrame()
+	{
+		VT_PROFILE_FUNCTION();
+
+		Renderer2D::EndFrame();
+		s_GPUProfiler->EndFrame();
+	}
+
 	/**
 	 * @brief Initializes for the scene. 
 	 * @param p_Camera The camera being initialized.
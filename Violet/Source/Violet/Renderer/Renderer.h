@@ -3,7 +3,7 @@
 /// Renderer.h
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// Violet's main renderer which handles
 /// creating and ending a scene, as well
@@ -14,6 +14,7 @@
 #ifndef __VIOLET_ENGINE_RENDERER_H_INCLUDED__
 #define __VIOLET_ENGINE_RENDERER_H_INCLUDED__
 
+#include "Violet/Renderer/GPUProfiler.h"
 #include "Violet/Renderer/OrthographicCamera.h"
 #include "Violet/Renderer/RenderCommand.h"
 #include "Violet/Renderer/Shader.h"
@@ -26,10 +27,12 @@ namespace Violet
 	class Renderer
 	{
 	public: // Initializer
+		static void InitAPI();
 		static void Init();
 		static void Shutdown();
 	public: // Events
 		static void OnWindowResize(uint32_t p_Width, uint32_t p_Height);
+		static void EndFrame();
 	public: // Main Functionality
 		static void BeginScene(OrthographicCamera& p_Camera);
 		static void EndScene();
@@ -40,6 +43,12 @@ namespace Violet
 		 * @returns The Renderer API.
 		 */
 		static RendererAPI::API GetAPI() { return RendererAPI::GetAPI(); }
+
+		/**
+		 * @brief Gets the GPU profiler.
+		 * @returns The GPU profiler.
+		 */
+		static GPUProfiler& GetGPUProfiler() { return *s_GPUProfiler; }
 	private: // SceneData
 		struct SceneData
 		{
@@ -47,6 +56,7 @@ namespace Violet
 		};
 	private: // Private Static Member Variables
 		static Scope<SceneData> s_SceneData;
+		static Scope<GPUProfiler> s_GPUProfiler;
 	};
 }
 
@@ -3,7 +3,7 @@
 /// Renderer2D.cpp
 /// Violet McAllister
 /// July 14th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Violet's main 2D Renderer which
 /// handles drawing 2D shapes.
@@ -16,6 +16,8 @@
 
 #include <glm/gtc/matrix_transform.hpp>
 
+#include "Violet/Debug/FastLog.h"
+#include "Violet/Renderer/GPUProfiler.h"
 #include "Violet/Renderer/RenderCommand.h"
 #include "Violet/Renderer/Shader.h"
 #include "Violet/Renderer/VertexArray.h"
@@ -49,6 +51,9 @@ namespace Violet
 		Ref<Shader> TextureShader;
 		Ref<Texture2D> WhiteTexture;
 
+		// Read ahead of Init, released once the shader is compiled.
+		ShaderSource TextureShaderSource;
+
 		uint32_t QuadIndexCount = 0;
 		QuadVertex* QuadVertexBufferBase = nullptr;
 		QuadVertex* QuadVertexBufferPtr = nullptr;
@@ -58,18 +63,40 @@ namespace Violet
 
 		glm::vec4 QuadVertexPositions[4];
 
+		// The texture GetTextureSlot found last, checked before searching.
+		const Texture2D* LastTexture = nullptr;
+		uint32_t LastTextureSlot = 0;
+
+		// Stats is reset by the client, FrameStats by the engine every frame.
 		Renderer2D::Statistics Stats;
+		Renderer2D::Statistics FrameStats;
 	};
 
 	static Renderer2DData s_Data;
 
 	/**
-	 * @brief Initializes the renderer.
+	 * @brief Reads the shader sources of the renderer from disk.
+	 * Touches no graphics API, so startup runs it on a worker
+	 * ahead of Init.
+	 */
+	void Renderer2D::LoadSources()
+	{
+		VT_PROFILE_FUNCTION();
+
+		s_Data.TextureShaderSource = Shader::LoadSource("Assets/Shaders/Texture.glsl");
+	}
+
+	/**
+	 * @brief Initializes the renderer, loading the shader sources
+	 * first unless LoadSources already has.
 	 */
 	void Renderer2D::Init()
 	{
 		VT_PROFILE_FUNCTION();
 
+		if (s_Data.TextureShaderSource.Name.empty())
+			LoadSources();
+
 		// Initialize Data
 		s_Data.QuadVertexArray = VertexArray::Create();
 		s_Data.QuadVertexBuffer = VertexBuffer::Create(s_Data.MaxVertices * sizeof(QuadVertex));
@@ -116,7 +143,8 @@ namespace Violet
 			samplers[i] = i;
 
 		// Texture Shader
-		s_Data.TextureShader = Shader::Create("Assets/Shaders/Texture.glsl");
+		s_Data.TextureShader = Shader::Create(s_Data.TextureShaderSource);
+		s_Data.TextureShaderSource = ShaderSource();
 		s_Data.TextureShader->Bind();
 		s_Data.TextureShader->SetIntArray("u_Textures", samplers, s_Data.MaxTextureSlots);
 
@@ -166,6 +194,8 @@ namespace Violet
 
 		uint32_t dataSize = (uint32_t)((uint8_t*)s_Data.QuadVertexBufferPtr - (uint8_t*)s_Data.QuadVertexBufferBase);
 		s_Data.QuadVertexBuffer->SetData(s_Data.QuadVertexBufferBase, dataSize);
+		s_Data.Stats.BytesUploaded += dataSize;
+		s_Data.FrameStats.BytesUploaded += dataSize;
 
 		Flush();
 	}
@@ -178,12 +208,31 @@ namespace Violet
 		if (s_Data.QuadIndexCount == 0)
 			return; // Nothing To Draw
 
+		VT_PROFILE_GPU_SCOPE("Renderer2D::Flush");
+		VT_LOG_FAST("Renderer2D Flush: {0} Quads, {1} Textures", s_Data.QuadIndexCount / 6, s_Data.TextureSlotIndex);
+
 		// Bind textures
 		for (uint32_t i = 0; i < s_Data.TextureSlotIndex; i++)
 			s_Data.TextureSlots[i]->Bind(i);
 
 		RenderCommand::DrawIndexed(s_Data.QuadVertexArray, s_Data.QuadIndexCount);
 		s_Data.Stats.DrawCalls++;
+		s_Data.Stats.TexturesBound += s_Data.TextureSlotIndex;
+		s_Data.FrameStats.DrawCalls++;
+		s_Data.FrameStats.TexturesBound += s_Data.TextureSlotIndex;
+	}
+
+	/**
+	 * @brief Writes this frame's statistics as counters to the
+	 * profile trace and resets them.
+	 */
+	void Renderer2D::EndFrame()
+	{
+		const Statistics& stats = s_Data.FrameStats;
+		VT_PROFILE_COUNTER("Renderer2D", { "Quads", (double)stats.QuadCount }, { "DrawCalls", (double)stats.DrawCalls });
+		VT_PROFILE_COUNTER("Renderer2D Uploads", { "BytesUploaded", (double)stats.BytesUploaded }, { "TexturesBound", (double)stats.TexturesBound });
+
+		s_Data.FrameStats = Statistics();
 	}
 
 	/**
@@ -218,7 +267,7 @@ namespace Violet
 	 */
 	void Renderer2D::DrawQuad(const glm::vec3& p_Position, const glm::vec2& p_Size, const glm::vec4& p_Color)
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		constexpr size_t quadVertexCount = 4;
 		const float textureIndex = 0.0f; // White Texture
@@ -244,6 +293,7 @@ namespace Violet
 		s_Data.QuadIndexCount += 6;
 
 		s_Data.Stats.QuadCount++;
+		s_Data.FrameStats.QuadCount++;
 	}
 
 	/**
@@ -269,7 +319,7 @@ namespace Violet
 	 */
 	void Renderer2D::DrawQuad(const glm::vec3& p_Position, const glm::vec2& p_Size, const Ref<Texture2D>& p_Texture, float p_TilingFactor, const glm::vec4& p_TintColor)
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		constexpr size_t quadVertexCount = 4;
 		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
@@ -277,25 +327,7 @@ namespace Violet
 		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
 			FlushAndReset();
 
-		float textureIndex = 0.0f;
-		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
-		{
-			if (*s_Data.TextureSlots[i].get() == *p_Texture.get())
-			{
-				textureIndex = (float)i;
-				break;
-			}
-		}
-
-		if (textureIndex == 0.0f)
-		{
-			if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
-				FlushAndReset();
-
-			textureIndex = (float)s_Data.TextureSlotIndex;
-			s_Data.TextureSlots[s_Data.TextureSlotIndex] = p_Texture;
-			s_Data.TextureSlotIndex++;
-		}
+		float textureIndex = (float)GetTextureSlot(p_Texture.get());
 
 		glm::mat4 transform = glm::translate(glm::mat4(1.0f), p_Position)
 			* glm::scale(glm::mat4(1.0f), { p_Size.x, p_Size.y, 1.0f });
@@ -313,6 +345,7 @@ namespace Violet
 		s_Data.QuadIndexCount += 6;
 
 		s_Data.Stats.QuadCount++;
+		s_Data.FrameStats.QuadCount++;
 	}
 
 	/**
@@ -336,7 +369,7 @@ namespace Violet
 	 */
 	void Renderer2D::DrawRotatedQuad(const glm::vec3& p_Position, const glm::vec2& p_Size, float p_Rotation, const glm::vec4& p_Color)
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		constexpr size_t quadVertexCount = 4;
 		const float textureIndex = 0.0f; // White Texture
@@ -363,6 +396,7 @@ namespace Violet
 		s_Data.QuadIndexCount += 6;
 
 		s_Data.Stats.QuadCount++;
+		s_Data.FrameStats.QuadCount++;
 	}
 
 	/**
@@ -390,7 +424,7 @@ namespace Violet
 	 */
 	void Renderer2D::DrawRotatedQuad(const glm::vec3& p_Position, const glm::vec2& p_Size, float p_Rotation, const Ref<Texture2D>& p_Texture, float p_TilingFactor, const glm::vec4& p_TintColor)
 	{
-		VT_PROFILE_FUNCTION();
+		VT_PROFILE_VERBOSE_FUNCTION();
 
 		constexpr size_t quadVertexCount = 4;
 		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
@@ -398,25 +432,7 @@ namespace Violet
 		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
 			FlushAndReset();
 
-		float textureIndex = 0.0f;
-		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
-		{
-			if (*s_Data.TextureSlots[i].get() == *p_Texture.get())
-			{
-				textureIndex = (float)i;
-				break;
-			}
-		}
-
-		if (textureIndex == 0.0f)
-		{
-			if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
-				FlushAndReset();
-
-			textureIndex = (float)s_Data.TextureSlotIndex;
-			s_Data.TextureSlots[s_Data.TextureSlotIndex] = p_Texture;
-			s_Data.TextureSlotIndex++;
-		}
+		float textureIndex = (float)GetTextureSlot(p_Texture.get());
 
 		glm::mat4 transform = glm::translate(glm::mat4(1.0f), p_Position)
 			* glm::rotate(glm::mat4(1.0f), glm::radians(p_Rotation), { 0.0f, 0.0f, 1.0f })
@@ -435,6 +451,156 @@ namespace Violet
 		s_Data.QuadIndexCount += 6;
 
 		s_Data.Stats.QuadCount++;
+		s_Data.FrameStats.QuadCount++;
+	}
+
+	/**
+	 * @brief Draws a colored square transformed by a matrix, for
+	 * callers caching their transforms.
+	 * @param p_Transform The 2D affine transform of the unit square.
+	 * @param p_Color The color of the square.
+	 */
+	void Renderer2D::DrawQuad(const glm::mat4& p_Transform, const glm::vec4& p_Color)
+	{
+		VT_PROFILE_VERBOSE_FUNCTION();
+
+		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+			FlushAndReset();
+
+		// The corners have z = 0 and w = 1, so only three columns matter.
+		glm::vec3 axisX = p_Transform[0], axisY = p_Transform[1], origin = p_Transform[3];
+		for (size_t i = 0; i < 4; i++)
+		{
+			s_Data.QuadVertexBufferPtr->Position = origin + axisX * s_Data.QuadVertexPositions[i].x + axisY * s_Data.QuadVertexPositions[i].y;
+			s_Data.QuadVertexBufferPtr->Color = p_Color;
+			s_Data.QuadVertexBufferPtr->TexCoord = textureCoords[i];
+			s_Data.QuadVertexBufferPtr->TexIndex = 0.0f;
+			s_Data.QuadVertexBufferPtr->TilingFactor = 1.0f;
+			s_Data.QuadVertexBufferPtr++;
+		}
+
+		s_Data.QuadIndexCount += 6;
+
+		s_Data.Stats.QuadCount++;
+		s_Data.FrameStats.QuadCount++;
+	}
+
+	/**
+	 * @brief Draws a textured square transformed by a matrix, for
+	 * callers caching their transforms.
+	 * @param p_Transform The 2D affine transform of the unit square.
+	 * @param p_Texture The texture for the square.
+	 * @param p_TilingFactor Optional setting to change how the image tiles.
+	 * @param p_TintColor Option setting to change the tint color.
+	 */
+	void Renderer2D::DrawQuad(const glm::mat4& p_Transform, const Ref<Texture2D>& p_Texture, float p_TilingFactor, const glm::vec4& p_TintColor)
+	{
+		VT_PROFILE_VERBOSE_FUNCTION();
+
+		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+		if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+			FlushAndReset();
+
+		float textureIndex = (float)GetTextureSlot(p_Texture.get());
+
+		glm::vec3 axisX = p_Transform[0], axisY = p_Transform[1], origin = p_Transform[3];
+		for (size_t i = 0; i < 4; i++)
+		{
+			s_Data.QuadVertexBufferPtr->Position = origin + axisX * s_Data.QuadVertexPositions[i].x + axisY * s_Data.QuadVertexPositions[i].y;
+			s_Data.QuadVertexBufferPtr->Color = p_TintColor;
+			s_Data.QuadVertexBufferPtr->TexCoord = textureCoords[i];
+			s_Data.QuadVertexBufferPtr->TexIndex = textureIndex;
+			s_Data.QuadVertexBufferPtr->TilingFactor = p_TilingFactor;
+			s_Data.QuadVertexBufferPtr++;
+		}
+
+		s_Data.QuadIndexCount += 6;
+
+		s_Data.Stats.QuadCount++;
+		s_Data.FrameStats.QuadCount++;
+	}
+
+	/**
+	 * @brief Draws many quads at once, the corners are computed
+	 * from the axes of each sprite. The sprite renderer system of
+	 * Scene draws through this.
+	 * @param p_Sprites The sprites.
+	 * @param p_Count The number of sprites.
+	 */
+	void Renderer2D::DrawSprites(const Sprite* p_Sprites, uint32_t p_Count)
+	{
+		VT_PROFILE_FUNCTION();
+
+		constexpr glm::vec2 textureCoords[] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+		constexpr glm::vec2 corners[] = { { -0.5f, -0.5f }, { 0.5f, -0.5f }, { 0.5f, 0.5f }, { -0.5f, 0.5f } };
+
+		for (uint32_t s = 0; s < p_Count; s++)
+		{
+			const Sprite& sprite = p_Sprites[s];
+
+			if (s_Data.QuadIndexCount >= Renderer2DData::MaxIndices)
+				FlushAndReset();
+
+			uint32_t textureIndex = sprite.Texture ? GetTextureSlot(sprite.Texture) : 0;
+
+			for (size_t i = 0; i < 4; i++)
+			{
+				glm::vec2 offset = sprite.AxisX * corners[i].x + sprite.AxisY * corners[i].y;
+				s_Data.QuadVertexBufferPtr->Position = { sprite.Position.x + offset.x, sprite.Position.y + offset.y, sprite.Position.z };
+				s_Data.QuadVertexBufferPtr->Color = sprite.Color;
+				s_Data.QuadVertexBufferPtr->TexCoord = textureCoords[i];
+				s_Data.QuadVertexBufferPtr->TexIndex = (float)textureIndex;
+				s_Data.QuadVertexBufferPtr->TilingFactor = sprite.TilingFactor;
+				s_Data.QuadVertexBufferPtr++;
+			}
+
+			s_Data.QuadIndexCount += 6;
+		}
+
+		s_Data.Stats.QuadCount += p_Count;
+		s_Data.FrameStats.QuadCount += p_Count;
+	}
+
+	/**
+	 * @brief Finds the slot of a texture in the batch, adding it if
+	 * the batch does not hold it yet. The texture found last is
+	 * checked first, so runs of one texture skip the search.
+	 * @param p_Texture The texture.
+	 * @returns The slot of the texture.
+	 */
+	uint32_t Renderer2D::GetTextureSlot(Texture2D* p_Texture)
+	{
+		// The last slot is only reused while the batch still holds it.
+		uint32_t slot = s_Data.LastTextureSlot;
+		if (p_Texture == s_Data.LastTexture && slot < s_Data.TextureSlotIndex && s_Data.TextureSlots[slot].get() == p_Texture)
+			return slot;
+
+		slot = 0;
+		for (uint32_t i = 1; i < s_Data.TextureSlotIndex; i++)
+		{
+			if (*s_Data.TextureSlots[i].get() == *p_Texture)
+			{
+				slot = i;
+				break;
+			}
+		}
+
+		if (slot == 0)
+		{
+			if (s_Data.TextureSlotIndex >= Renderer2DData::MaxTextureSlots)
+				FlushAndReset();
+
+			slot = s_Data.TextureSlotIndex;
+			s_Data.TextureSlots[s_Data.TextureSlotIndex] = Ref<Texture2D>(p_Texture);
+			s_Data.TextureSlotIndex++;
+		}
+
+		s_Data.LastTexture = p_Texture;
+		s_Data.LastTextureSlot = slot;
+		return slot;
 	}
 
 	/**
@@ -3,7 +3,7 @@
 /// Renderer2D.h
 /// Violet McAllister
 /// July 14th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 ///
 /// Violet's main 2D Renderer which
 /// handles drawing 2D shapes.
@@ -25,6 +25,7 @@ namespace Violet
 	class Renderer2D
 	{
 	public: // Initializer & Shutdown
+		static void LoadSources();
 		static void Init();
 		static void Shutdown();
 	public: // Scene
@@ -32,6 +33,8 @@ namespace Violet
 		static void EndScene();
 	public: // Batching
 		static void Flush();
+	public: // Frame
+		static void EndFrame();
 	public: // Main Functionality
 		static void DrawQuad(const glm::vec2& p_Position, const glm::vec2& p_Size, const glm::vec4& p_Color);
 		static void DrawQuad(const glm::vec3& p_Position, const glm::vec2& p_Size, const glm::vec4& p_Color);
@@ -41,6 +44,26 @@ namespace Violet
 		static void DrawRotatedQuad(const glm::vec3& p_Position, const glm::vec2& p_Size, float p_Rotation, const glm::vec4& p_Color);
 		static void DrawRotatedQuad(const glm::vec2& p_Position, const glm::vec2& p_Size, float p_Rotation, const Ref<Texture2D>& p_Texture, float p_TilingFactor = 1.0f, const glm::vec4& p_TintColor = glm::vec4(1.0f));
 		static void DrawRotatedQuad(const glm::vec3& p_Position, const glm::vec2& p_Size, float p_Rotation, const Ref<Texture2D>& p_Texture, float p_TilingFactor = 1.0f, const glm::vec4& p_TintColor = glm::vec4(1.0f));
+		static void DrawQuad(const glm::mat4& p_Transform, const glm::vec4& p_Color);
+		static void DrawQuad(const glm::mat4& p_Transform, const Ref<Texture2D>& p_Texture, float p_TilingFactor = 1.0f, const glm::vec4& p_TintColor = glm::vec4(1.0f));
+	public: // Bulk Drawing
+		/**
+		 * @brief A quad for DrawSprites, centered on its position and
+		 * spanned by its two axes, the first two columns of its world
+		 * matrix. The texture is not held by the sprite, no texture
+		 * draws a flat colored quad.
+		 */
+		struct Sprite
+		{
+			glm::vec3 Position;
+			glm::vec2 AxisX;
+			glm::vec2 AxisY;
+			glm::vec4 Color;
+			Texture2D* Texture;
+			float TilingFactor;
+		};
+
+		static void DrawSprites(const Sprite* p_Sprites, uint32_t p_Count);
 	public: // Statistics
 		/**
 		 * @brief Contains Renderer stats. 
@@ -49,6 +72,8 @@ namespace Violet
 		{
 			uint32_t DrawCalls = 0;
 			uint32_t QuadCount = 0;
+			uint32_t BytesUploaded = 0;
+			uint32_t TexturesBound = 0;
 
 			/**
 			 * @brief Gets the total number of vertices drawn.
@@ -67,6 +92,7 @@ namespace Violet
 		static Statistics GetStats();
 	private: // Helpers
 		static void FlushAndReset();
+		static uint32_t GetTextureSlot(Texture2D* p_Texture);
 	};
 }
 
@@ -17,7 +17,9 @@
 
 #include "Violet/Renderer/RendererAPI.h"
 
+#include "Platform/Null/NullRendererAPI.h"
 #include "Platform/OpenGL/OpenGLRendererAPI.h"
+#include "Platform/Software/SoftwareRendererAPI.h"
 
 namespace Violet
 {
@@ -33,6 +35,8 @@ namespace Violet
 		{
 			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateScope<OpenGLRendererAPI>();
+			case RendererAPI::API::Null:    return CreateScope<NullRendererAPI>();
+			case RendererAPI::API::Software: return CreateScope<SoftwareRendererAPI>();
 		}
 
 		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -31,7 +31,7 @@ namespace Violet
 	public: // API
 		enum class API
 		{
-			None = 0, OpenGL = 1
+			None = 0, OpenGL = 1, Null = 2, Software = 3
 		};
 	public: // Initializer
 		virtual void Init() = 0;
@@ -40,12 +40,20 @@ namespace Violet
 		virtual void SetClearColor(const glm::vec4& p_Color) = 0;
 		virtual void Clear() = 0;
 		virtual void DrawIndexed(const Ref<VertexArray>& p_VertexArray, uint32_t p_IndexCount = 0) = 0;
+		virtual void ReadPixels(uint32_t p_X, uint32_t p_Y, uint32_t p_Width, uint32_t p_Height, uint32_t* p_Pixels) = 0;
 	public: // Getter
 		/**
 		 * @brief Gets the static API.
 		 * @returns The static API.
 		 */
 		static API GetAPI() { return s_API; }
+
+		/**
+		 * @brief Sets the static API. Only takes effect when set
+		 * before the renderer is initialized.
+		 * @param p_API The API.
+		 */
+		static void SetAPI(API p_API) { s_API = p_API; }
 	public: // Creator
 		static Scope<RendererAPI> Create();
 	private: // Private Static Member Variables
@@ -3,7 +3,7 @@
 /// Shader.cpp
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 13th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// A shader is a program which allows
 /// you to communicate with the GPU directly
@@ -16,7 +16,11 @@
 
 #include "Violet/Renderer/Shader.h"
 
+#include "Platform/Null/NullShader.h"
 #include "Platform/OpenGL/OpenGLShader.h"
+#include "Platform/Software/SoftwareShader.h"
+
+#include <fstream>
 
 #include "Violet/Renderer/Renderer.h"
 
@@ -28,14 +32,17 @@ namespace Violet
 	 */
 	Ref<Shader> Shader::Create(const std::string& p_Filepath)
 	{
-		switch (Renderer::GetAPI())
-		{
-			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(p_Filepath);
-		}
+		return Create(LoadSource(p_Filepath));
+	}
 
-		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
-		return nullptr;
+	/**
+	 * @brief Creates a Shader object based on the current API from
+	 * sources already read from disk.
+	 * @param p_Source The shader sources.
+	 */
+	Ref<Shader> Shader::Create(const ShaderSource& p_Source)
+	{
+		return Create(p_Source.Name, p_Source.VertexSource, p_Source.FragmentSource);
 	}
 
 	/**
@@ -49,12 +56,82 @@ namespace Violet
 		{
 			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(p_Name, p_VertexSource, p_FragmentSource);
+			case RendererAPI::API::Null:    return CreateRef<NullShader>(p_Name, p_VertexSource, p_FragmentSource);
+			case RendererAPI::API::Software: return CreateRef<SoftwareShader>(p_Name, p_VertexSource, p_FragmentSource);
 		}
 
 		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
 		return nullptr;
 	}
 
+	/**
+	 * @brief Reads a shader program from disk and splits it into
+	 * its stages by the "#type" lines. Touches no graphics API,
+	 * so it can run on any thread.
+	 * @param p_Filepath The file path to a shader program.
+	 * @returns The shader sources, named after the file.
+	 */
+	ShaderSource Shader::LoadSource(const std::string& p_Filepath)
+	{
+		VT_PROFILE_FUNCTION();
+
+		ShaderSource result;
+
+		// Extract Name From Filepath
+		auto lastSlash = p_Filepath.find_last_of("/\\");
+		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+		auto lastDot = p_Filepath.rfind('.');
+		auto count = lastDot == std::string::npos ? p_Filepath.size() - lastSlash : lastDot - lastSlash;
+		result.Name = p_Filepath.substr(lastSlash, count);
+
+		// Reads File Data into source
+		std::string source;
+		std::ifstream in(p_Filepath, std::ios::in | std::ios::binary);
+		if (!in)
+		{
+			VT_CORE_ERROR("Could Not Open File '{0}'", p_Filepath);
+			return result;
+		}
+
+		in.seekg(0, std::ios::end);
+		size_t size = in.tellg();
+		if (size == -1)
+		{
+			VT_CORE_ERROR("Could not read from file '{0}'", p_Filepath);
+			return result;
+		}
+
+		source.resize(size);
+		in.seekg(0, std::ios::beg);
+		in.read(&source[0], size);
+		in.close();
+
+		const char* typeToken = "#type";
+		size_t typeTokenLength = strlen(typeToken);
+		size_t pos = source.find(typeToken, 0); // Start of shader type declaration line
+		while (pos != std::string::npos)
+		{
+			size_t eol = source.find_first_of("\r\n", pos);
+			VT_CORE_ASSERT(eol != std::string::npos, "Syntax error");
+			size_t begin = pos + typeTokenLength + 1; // Start of shader type name (after "#type " keyword)
+			std::string type = source.substr(begin, eol - begin);
+
+			size_t nextLinePos = source.find_first_not_of("\r\n", eol); // Start of shader code after shader type declaration line
+			VT_CORE_ASSERT(nextLinePos != std::string::npos, "Syntax error");
+			pos = source.find(typeToken, nextLinePos); // Start of next shader type declaration line
+
+			std::string code = (pos == std::string::npos) ? source.substr(nextLinePos) : source.substr(nextLinePos, pos - nextLinePos);
+			if (type == "vertex")
+				result.VertexSource = std::move(code);
+			else if (type == "fragment" || type == "pixel")
+				result.FragmentSource = std::move(code);
+			else
+				VT_CORE_ASSERT(false, "Invalid shader type specified");
+		}
+
+		return result;
+	}
+
 	/**
 	 * @brief Adds a shader to the ShaderLibrary given its name and the shader itself.
 	 * @param p_Name The name of the shader.
@@ -3,7 +3,7 @@
 /// Shader.h
 /// Violet McAllister
 /// July 11th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// A shader is a program which allows
 /// you to communicate with the GPU directly
@@ -24,14 +24,27 @@
 
 #include <glm/glm.hpp>
 
+#include "Violet/Core/Base.h"
+
 namespace Violet
 {
+	/**
+	 * @brief The sources of a shader program, read from disk
+	 * before a graphics context is needed.
+	 */
+	struct ShaderSource
+	{
+		std::string Name;
+		std::string VertexSource;
+		std::string FragmentSource;
+	};
+
 	/**
 	 * @brief Abstract Shader class used to
 	 * define implementations of a Shader
 	 * using a graphics API.
 	 */
-	class Shader
+	class Shader : public SingleThreadRefCounted
 	{
 	public: // Deconstructors
 		virtual ~Shader() = default;
@@ -39,17 +52,20 @@ namespace Violet
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 	public: // Uniforms
-		virtual void SetInt(const std::string& p_Name, int p_Value) = 0;
-		virtual void SetIntArray(const std::string& p_Name, int* p_Values, uint32_t p_Count) = 0;
-		virtual void SetFloat(const std::string& p_Name, float p_Value) = 0;
-		virtual void SetFloat3(const std::string& p_Name, const glm::vec3& p_Value) = 0;
-		virtual void SetFloat4(const std::string& p_Name, const glm::vec4& p_Value) = 0;
-		virtual void SetMat4(const std::string& p_Name, const glm::mat4& p_Value) = 0;
+		virtual void SetInt(const char* p_Name, int p_Value) = 0;
+		virtual void SetIntArray(const char* p_Name, int* p_Values, uint32_t p_Count) = 0;
+		virtual void SetFloat(const char* p_Name, float p_Value) = 0;
+		virtual void SetFloat3(const char* p_Name, const glm::vec3& p_Value) = 0;
+		virtual void SetFloat4(const char* p_Name, const glm::vec4& p_Value) = 0;
+		virtual void SetMat4(const char* p_Name, const glm::mat4& p_Value) = 0;
 	public: // Getters
 		virtual const std::string& GetName() const = 0;
 	public: // Creator
 		static Ref<Shader> Create(const std::string& p_Filepath);
+		static Ref<Shader> Create(const ShaderSource& p_Source);
 		static Ref<Shader> Create(const std::string& p_Name, const std::string& p_VertexSource, const std::string& p_FragmentSource);
+
+		static ShaderSource LoadSource(const std::string& p_Filepath);
 	};
 
 	class ShaderLibrary
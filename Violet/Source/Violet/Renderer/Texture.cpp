@@ -3,7 +3,7 @@
 /// Texture.cpp
 /// Violet McAllister
 /// July 13th, 2022
-/// Updated: July 15th, 2022
+/// Updated: August 2nd, 2022
 ///
 /// A texture is a collection of
 /// data which can be uploaded to
@@ -16,12 +16,93 @@
 
 #include "Violet/Renderer/Texture.h"
 
+#include "Platform/Null/NullTexture.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
+#include "Platform/Software/SoftwareTexture.h"
 
 #include "Violet/Renderer/Renderer.h"
 
+#include <mutex>
+
+#include <stb_image.h>
+
 namespace Violet
 {
+	/**
+	 * @brief Takes the pixels of another image.
+	 * @param p_Other The image being moved from.
+	 */
+	ImageData::ImageData(ImageData&& p_Other) noexcept
+	{
+		*this = std::move(p_Other);
+	}
+
+	/**
+	 * @brief Frees the pixels of the image.
+	 */
+	ImageData::~ImageData()
+	{
+		if (m_Pixels)
+			stbi_image_free(m_Pixels);
+	}
+
+	/**
+	 * @brief Decodes an image file, flipped so the first row is
+	 * the bottom of the image.
+	 * @param p_Filepath The path to the image file.
+	 * @returns The decoded image, invalid if it failed to load.
+	 */
+	ImageData ImageData::Load(const std::string& p_Filepath)
+	{
+		VT_PROFILE_FUNCTION();
+
+		// The flip is global in stb_image, set once so decodes on other threads never race on it.
+		static std::once_flag s_FlipOnce;
+		std::call_once(s_FlipOnce, []() { stbi_set_flip_vertically_on_load(1); });
+
+		ImageData result;
+		result.m_Path = p_Filepath;
+
+		int width, height, channels;
+		{
+			VT_PROFILE_SCOPE("stbi_load - ImageData::Load(const std::string&)");
+			result.m_Pixels = stbi_load(p_Filepath.c_str(), &width, &height, &channels, 0);
+		}
+		if (!result.m_Pixels)
+		{
+			VT_CORE_ERROR("[STB_IMAGE ERROR] Failed To Load Image '{0}'!", p_Filepath);
+			return result;
+		}
+
+		result.m_Width = width;
+		result.m_Height = height;
+		result.m_Channels = channels;
+		return result;
+	}
+
+	/**
+	 * @brief Takes the pixels of another image.
+	 * @param p_Other The image being moved from.
+	 * @returns This image.
+	 */
+	ImageData& ImageData::operator=(ImageData&& p_Other) noexcept
+	{
+		if (this != &p_Other)
+		{
+			if (m_Pixels)
+				stbi_image_free(m_Pixels);
+
+			m_Path = std::move(p_Other.m_Path);
+			m_Pixels = p_Other.m_Pixels;
+			m_Width = p_Other.m_Width;
+			m_Height = p_Other.m_Height;
+			m_Channels = p_Other.m_Channels;
+			p_Other.m_Pixels = nullptr;
+		}
+
+		return *this;
+	}
+
 	/**
 	 * @brief Creates a Texture2D object based on the current API using
 	 * only the width and height.
@@ -34,6 +115,8 @@ namespace Violet
 		{
 			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(p_Width, p_Height);
+			case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(p_Width, p_Height);
+			case RendererAPI::API::Software: return CreateRef<SoftwareTexture2D>(p_Width, p_Height);
 		}
 
 		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -50,6 +133,27 @@ namespace Violet
 		{
 			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(p_Filepath);
+			case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(p_Filepath);
+			case RendererAPI::API::Software: return CreateRef<SoftwareTexture2D>(p_Filepath);
+		}
+
+		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	/**
+	 * @brief Creates a Texture2D object based on the current API from
+	 * an image which has already been decoded.
+	 * @param p_Image The decoded image.
+	 */
+	Ref<Texture2D> Texture2D::Create(const ImageData& p_Image)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(p_Image);
+			case RendererAPI::API::Null:    return CreateRef<NullTexture2D>(p_Image);
+			case RendererAPI::API::Software: return CreateRef<SoftwareTexture2D>(p_Image);
 		}
 
 		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -3,7 +3,7 @@
 /// Texture.h
 /// Violet McAllister
 /// July 13th, 2022
-/// Updated: July 16th, 2022
+/// Updated: August 6th, 2022
 ///
 /// A texture is a collection of
 /// data which can be uploaded to
@@ -21,11 +21,44 @@
 
 namespace Violet
 {
+	/**
+	 * @brief The decoded pixels of an image file. Decoding touches
+	 * no graphics API, so it can run on any thread before the
+	 * texture is created.
+	 */
+	class ImageData
+	{
+	public: // Constructors & Deconstructors
+		ImageData() = default;
+		ImageData(ImageData&& p_Other) noexcept;
+		ImageData(const ImageData&) = delete;
+		~ImageData();
+	public: // Main Functionality
+		static ImageData Load(const std::string& p_Filepath);
+	public: // Getters
+		const std::string& GetPath() const { return m_Path; }
+		const uint8_t* GetPixels() const { return m_Pixels; }
+		uint32_t GetWidth() const { return m_Width; }
+		uint32_t GetHeight() const { return m_Height; }
+		uint32_t GetChannels() const { return m_Channels; }
+		bool IsValid() const { return m_Pixels != nullptr; }
+	public: // Operator Overrides
+		ImageData& operator=(ImageData&& p_Other) noexcept;
+		ImageData& operator=(const ImageData&) = delete;
+	private: // Private Member Variables
+		std::string m_Path;
+		uint8_t* m_Pixels = nullptr;
+		uint32_t m_Width = 0, m_Height = 0, m_Channels = 0;
+	};
+
 	/**
 	 * @brief A texture is data which can be processed
-	 * as an image.
+	 * as an image. Counted atomically, unlike the other renderer
+	 * resources, since sprites hold textures and jobs iterating a
+	 * View may copy them. The last reference must still be
+	 * released on the thread owning the graphics context.
 	 */
-	class Texture
+	class Texture : public RefCounted
 	{
 	public: // Deconstructors
 		virtual ~Texture() = default;
@@ -50,6 +83,7 @@ namespace Violet
 	public: // Creator
 		static Ref<Texture2D> Create(uint32_t p_Width, uint32_t p_Height);
 		static Ref<Texture2D> Create(const std::string& p_Filepath);
+		static Ref<Texture2D> Create(const ImageData& p_Image);
 	};
 }
 
@@ -17,6 +17,7 @@
 
 #include "Violet/Renderer/VertexArray.h"
 
+#include "Platform/Null/NullVertexArray.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
 
 #include "Violet/Renderer/Renderer.h"
@@ -32,6 +33,8 @@ namespace Violet
 		{
 			case RendererAPI::API::None:    VT_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
 			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexArray>();
+			case RendererAPI::API::Null:    return CreateRef<NullVertexArray>();
+			case RendererAPI::API::Software: return CreateRef<NullVertexArray>();
 		}
 
 		VT_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -3,6 +3,7 @@
 /// VertexArray.h
 /// Violet McAllister
 /// July 12th, 2022
+/// Updated: July 30th, 2022
 ///
 /// The vertex array object contains
 /// information about how the vertex 
@@ -24,7 +25,7 @@ namespace Violet
 	 * @brief Contains definitions for all
 	 * Vertex Array functionality.
 	 */
-	class VertexArray
+	class VertexArray : public SingleThreadRefCounted
 	{
 	public: // Deconstructor
 		virtual ~VertexArray() = default;
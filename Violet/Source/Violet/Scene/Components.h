@@ -0,0 +1,59 @@
+/////////////////
+///
+/// Components.h
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// The components the engine knows about. Kept
+/// small and plain so a pool of them packs
+/// tightly.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_SCENE_COMPONENTS_H_INCLUDED__
+#define __VIOLET_ENGINE_SCENE_COMPONENTS_H_INCLUDED__
+
+#include <string>
+
+#include <glm/glm.hpp>
+
+#include "Violet/Core/Base.h"
+#include "Violet/Renderer/Texture.h"
+
+namespace Violet
+{
+	/**
+	 * @brief A name for an entity, for tools and debugging.
+	 */
+	struct TagComponent
+	{
+		std::string Tag;
+	};
+
+	/**
+	 * @brief Where an entity is. The rotation is in degrees
+	 * around the z axis, like Renderer2D::DrawRotatedQuad.
+	 * Edits are only picked up once the entity is marked, see
+	 * Entity::SetTransform and Entity::MarkTransformDirty.
+	 */
+	struct TransformComponent
+	{
+		glm::vec3 Translation = { 0.0f, 0.0f, 0.0f };
+		glm::vec2 Scale = { 1.0f, 1.0f };
+		float Rotation = 0.0f;
+	};
+
+	/**
+	 * @brief Draws an entity as a quad the size of its scale. No
+	 * texture draws a flat colored quad. The texture may be copied
+	 * inside View::ParallelEach, but only replaced on the main thread.
+	 */
+	struct SpriteRendererComponent
+	{
+		glm::vec4 Color = { 1.0f, 1.0f, 1.0f, 1.0f };
+		Ref<Texture2D> Texture;
+		float TilingFactor = 1.0f;
+	};
+}
+
+#endif // __VIOLET_ENGINE_SCENE_COMPONENTS_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,100 @@
+/////////////////
+///
+/// Entity.h
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// A handle to an entity of a Scene, for adding,
+/// getting and removing its components.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_SCENE_ENTITY_H_INCLUDED__
+#define __VIOLET_ENGINE_SCENE_ENTITY_H_INCLUDED__
+
+#include "Violet/Scene/Scene.h"
+
+namespace Violet
+{
+	/**
+	 * @brief A lightweight handle, copied around by value. It does
+	 * not own the entity.
+	 */
+	class Entity
+	{
+	public: // Constructors
+		Entity() = default;
+
+		/**
+		 * @brief Constructs a handle to an entity.
+		 * @param p_Handle The entity.
+		 * @param p_Scene The scene the entity lives in.
+		 */
+		Entity(EntityID p_Handle, Scene* p_Scene)
+			: m_Handle(p_Handle), m_Scene(p_Scene) { }
+	public: // Components
+		template<typename T, typename... Args>
+		T& AddComponent(Args&&... p_Arguments)
+		{
+			return m_Scene->m_Registry.Emplace<T>(m_Handle, std::forward<Args>(p_Arguments)...);
+		}
+
+		template<typename T>
+		T& GetComponent() { return m_Scene->m_Registry.Get<T>(m_Handle); }
+
+		template<typename T>
+		bool HasComponent() { return m_Scene->m_Registry.Has<T>(m_Handle); }
+
+		template<typename T>
+		void RemoveComponent() { m_Scene->m_Registry.Remove<T>(m_Handle); }
+	public: // Hierarchy
+		/**
+		 * @brief Parents the entity to another, keeping its local
+		 * transform.
+		 * @param p_Parent The new parent, or a null Entity to make it a root.
+		 */
+		void SetParent(Entity p_Parent) { m_Scene->m_Hierarchy.SetParent(m_Handle, p_Parent.m_Handle); }
+		Entity GetParent() const { return Entity(m_Scene->m_Hierarchy.GetParent(m_Handle), m_Scene); }
+
+		/**
+		 * @brief Replaces the local transform of the entity, its world
+		 * matrix is rebuilt by the next Scene::UpdateTransforms.
+		 * @param p_Transform The new local transform.
+		 */
+		void SetTransform(const TransformComponent& p_Transform)
+		{
+			GetComponent<TransformComponent>() = p_Transform;
+			MarkTransformDirty();
+		}
+
+		/**
+		 * @brief Has the world matrix rebuilt by the next
+		 * Scene::UpdateTransforms, after editing the TransformComponent
+		 * in place.
+		 */
+		void MarkTransformDirty() { m_Scene->m_Hierarchy.MarkDirty(m_Handle); }
+
+		/**
+		 * @brief Gets the world matrix of the entity as of the last
+		 * Scene::UpdateTransforms.
+		 */
+		const glm::mat4& GetWorldTransform() const { return m_Scene->m_Hierarchy.GetWorldMatrix(m_Handle); }
+	public: // Getters
+		EntityID GetHandle() const { return m_Handle; }
+		Scene* GetScene() const { return m_Scene; }
+
+		/**
+		 * @brief Checks whether the handle refers to a live entity.
+		 */
+		bool IsValid() const { return m_Scene && m_Scene->m_Registry.IsValid(m_Handle); }
+		explicit operator bool() const { return IsValid(); }
+	public: // Operators
+		bool operator==(const Entity& p_Other) const { return m_Handle == p_Other.m_Handle && m_Scene == p_Other.m_Scene; }
+		bool operator!=(const Entity& p_Other) const { return !(*this == p_Other); }
+	private: // Private Member Variables
+		EntityID m_Handle = NullEntity;
+		Scene* m_Scene = nullptr;
+	};
+}
+
+#endif // __VIOLET_ENGINE_SCENE_ENTITY_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,492 @@
+/////////////////
+///
+/// Registry.h
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Entity and component storage. Every component
+/// type lives in its own sparse set: the components
+/// are packed in one contiguous array, with a paged
+/// sparse array mapping entities into it, so
+/// iterating a component type is a linear walk.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_SCENE_REGISTRY_H_INCLUDED__
+#define __VIOLET_ENGINE_SCENE_REGISTRY_H_INCLUDED__
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Violet/Core/Base.h"
+#include "Violet/Core/JobSystem.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Identifies an entity. The low bits index the entity,
+	 * the high bits count how often the index was reused, so a
+	 * destroyed entity never matches the one replacing it.
+	 */
+	using EntityID = uint32_t;
+
+	static constexpr EntityID NullEntity = 0xffffffff;
+	static constexpr uint32_t EntityIndexBits = 20;
+	static constexpr uint32_t EntityIndexMask = (1u << EntityIndexBits) - 1;
+	static constexpr uint32_t EntityVersionMask = ~EntityIndexMask;
+
+	/**
+	 * @brief Gets the index part of an entity.
+	 * @param p_Entity The entity.
+	 * @returns The index of the entity.
+	 */
+	inline uint32_t GetEntityIndex(EntityID p_Entity) { return p_Entity & EntityIndexMask; }
+
+	/**
+	 * @brief The set of entities owning one component type. Dense
+	 * holds the entities packed together, the sparse pages map an
+	 * entity index to its position in dense.
+	 */
+	class SparseSet
+	{
+	public: // Constants
+		static constexpr uint32_t PageSize = 4096;
+		static constexpr uint32_t NullIndex = 0xffffffff;
+	public: // Constructors & Deconstructors
+		SparseSet() = default;
+		virtual ~SparseSet() = default;
+
+		SparseSet(const SparseSet&) = delete;
+		SparseSet& operator=(const SparseSet&) = delete;
+	public: // Main Functionality
+		/**
+		 * @brief Checks whether an entity is in the set.
+		 * @param p_Entity The entity.
+		 * @returns If the entity is in the set.
+		 */
+		bool Contains(EntityID p_Entity) const
+		{
+			uint32_t index = IndexOf(p_Entity);
+			return index != NullIndex && m_Dense[index] == p_Entity;
+		}
+
+		/**
+		 * @brief Gets where an entity is packed. Only meaningful if
+		 * the set contains the entity.
+		 * @param p_Entity The entity.
+		 * @returns The dense index, or NullIndex.
+		 */
+		uint32_t IndexOf(EntityID p_Entity) const
+		{
+			uint32_t index = GetEntityIndex(p_Entity);
+			uint32_t page = index / PageSize;
+			if (page >= m_Sparse.size() || !m_Sparse[page])
+				return NullIndex;
+			return m_Sparse[page][index % PageSize];
+		}
+
+		virtual void Remove(EntityID p_Entity) = 0;
+	public: // Getters
+		uint32_t GetSize() const { return (uint32_t)m_Dense.size(); }
+		const EntityID* GetEntities() const { return m_Dense.data(); }
+
+		/**
+		 * @brief Gets a counter bumped on every change to the order
+		 * of the set, to tell whether a sort is still valid.
+		 * @returns The version of the order.
+		 */
+		uint32_t GetOrderVersion() const { return m_OrderVersion; }
+	protected: // Helpers
+		/**
+		 * @brief Appends an entity to the dense array.
+		 * @param p_Entity The entity, not yet in the set.
+		 * @returns The dense index of the entity.
+		 */
+		uint32_t Insert(EntityID p_Entity)
+		{
+			uint32_t index = GetEntityIndex(p_Entity);
+			uint32_t page = index / PageSize;
+			if (page >= m_Sparse.size())
+				m_Sparse.resize(page + 1);
+			if (!m_Sparse[page])
+			{
+				m_Sparse[page] = std::make_unique<uint32_t[]>(PageSize);
+				std::fill_n(m_Sparse[page].get(), PageSize, NullIndex);
+			}
+
+			uint32_t denseIndex = (uint32_t)m_Dense.size();
+			m_Sparse[page][index % PageSize] = denseIndex;
+			m_Dense.push_back(p_Entity);
+			m_OrderVersion++;
+			return denseIndex;
+		}
+
+		/**
+		 * @brief Removes an entity by moving the last entity into
+		 * its place. Derived sets move their last component the same.
+		 * @param p_Entity The entity, in the set.
+		 * @returns The dense index the entity had.
+		 */
+		uint32_t Erase(EntityID p_Entity)
+		{
+			uint32_t denseIndex = IndexOf(p_Entity);
+			EntityID last = m_Dense.back();
+
+			m_Dense[denseIndex] = last;
+			SetIndex(last, denseIndex);
+			SetIndex(p_Entity, NullIndex);
+			m_Dense.pop_back();
+			m_OrderVersion++;
+			return denseIndex;
+		}
+
+		/**
+		 * @brief Swaps two entities in the dense array.
+		 */
+		void SwapEntities(uint32_t p_First, uint32_t p_Second)
+		{
+			std::swap(m_Dense[p_First], m_Dense[p_Second]);
+			SetIndex(m_Dense[p_First], p_First);
+			SetIndex(m_Dense[p_Second], p_Second);
+			m_OrderVersion++;
+		}
+	private: // Private Helpers
+		void SetIndex(EntityID p_Entity, uint32_t p_DenseIndex)
+		{
+			uint32_t index = GetEntityIndex(p_Entity);
+			m_Sparse[index / PageSize][index % PageSize] = p_DenseIndex;
+		}
+	private: // Private Member Variables
+		std::vector<EntityID> m_Dense;
+		std::vector<std::unique_ptr<uint32_t[]>> m_Sparse;
+		uint32_t m_OrderVersion = 0;
+	};
+
+	/**
+	 * @brief A sparse set storing a component for every entity, in
+	 * the same order as the entities.
+	 */
+	template<typename T>
+	class ComponentPool : public SparseSet
+	{
+	public: // Main Functionality
+		/**
+		 * @brief Adds a component to an entity.
+		 * @param p_Entity The entity, without the component.
+		 * @param p_Arguments The constructor arguments of the component.
+		 * @returns The component.
+		 */
+		template<typename... Args>
+		T& Emplace(EntityID p_Entity, Args&&... p_Arguments)
+		{
+			VT_CORE_ASSERT(!Contains(p_Entity), "Entity Already Has Component!");
+
+			Insert(p_Entity);
+			if constexpr (std::is_aggregate_v<T>)
+				m_Components.push_back(T{ std::forward<Args>(p_Arguments)... });
+			else
+				m_Components.emplace_back(std::forward<Args>(p_Arguments)...);
+			return m_Components.back();
+		}
+
+		/**
+		 * @brief Removes the component of an entity.
+		 * @param p_Entity The entity, with the component.
+		 */
+		virtual void Remove(EntityID p_Entity) override
+		{
+			VT_CORE_ASSERT(Contains(p_Entity), "Entity Does Not Have Component!");
+
+			uint32_t index = Erase(p_Entity);
+			if (index != m_Components.size() - 1)
+				m_Components[index] = std::move(m_Components.back());
+			m_Components.pop_back();
+		}
+
+		/**
+		 * @brief Reorders the set so the entities it shares with
+		 * another set come first, in the order of the other set.
+		 * Iterating both together then walks both arrays linearly.
+		 * @param p_Other The set to follow.
+		 */
+		void SortAs(const SparseSet& p_Other)
+		{
+			uint32_t position = 0;
+			const EntityID* entities = p_Other.GetEntities();
+			for (uint32_t i = 0; i < p_Other.GetSize(); i++)
+			{
+				if (!Contains(entities[i]))
+					continue;
+
+				uint32_t index = IndexOf(entities[i]);
+				if (index != position)
+				{
+					SwapEntities(index, position);
+					std::swap(m_Components[index], m_Components[position]);
+				}
+				position++;
+			}
+		}
+	public: // Getters
+		/**
+		 * @brief Gets the component of an entity.
+		 * @param p_Entity The entity, with the component.
+		 * @returns The component.
+		 */
+		T& Get(EntityID p_Entity)
+		{
+			VT_CORE_ASSERT(Contains(p_Entity), "Entity Does Not Have Component!");
+			return m_Components[IndexOf(p_Entity)];
+		}
+
+		/**
+		 * @brief Gets the component of an entity if it has one.
+		 * @param p_Entity The entity.
+		 * @returns The component, or nullptr.
+		 */
+		T* TryGet(EntityID p_Entity)
+		{
+			return Contains(p_Entity) ? &m_Components[IndexOf(p_Entity)] : nullptr;
+		}
+
+		T* GetComponents() { return m_Components.data(); }
+	private: // Private Member Variables
+		std::vector<T> m_Components;
+	};
+
+	/**
+	 * @brief Iterates the entities owning every one of a set of
+	 * components. The smallest set drives the iteration, the
+	 * others are read at the same dense index when they were
+	 * sorted to match and through the sparse pages otherwise.
+	 */
+	template<typename... Ts>
+	class View
+	{
+	public: // Constructors
+		View(ComponentPool<Ts>&... p_Pools)
+			: m_Pools(&p_Pools...)
+		{
+			const SparseSet* sets[] = { &p_Pools... };
+			m_Driver = *std::min_element(std::begin(sets), std::end(sets), [](const SparseSet* p_First, const SparseSet* p_Second)
+			{
+				return p_First->GetSize() < p_Second->GetSize();
+			});
+		}
+	public: // Main Functionality
+		/**
+		 * @brief Calls a function for every entity in the view.
+		 * @param p_Function Called as p_Function(entity, components...).
+		 */
+		template<typename F>
+		void Each(const F& p_Function)
+		{
+			for (uint32_t i = 0; i < m_Driver->GetSize(); i++)
+				Visit(i, p_Function);
+		}
+
+		/**
+		 * @brief Calls a function for every entity in the view from
+		 * the job workers. The function may only touch the components
+		 * of the entity it is given.
+		 * @param p_Name The name of the jobs in profiles.
+		 * @param p_BatchSize The number of entities per job.
+		 * @param p_Function Called as p_Function(entity, components...).
+		 */
+		template<typename F>
+		void ParallelEach(const char* p_Name, uint32_t p_BatchSize, const F& p_Function)
+		{
+			JobSystem::ParallelFor(p_Name, m_Driver->GetSize(), p_BatchSize, [this, &p_Function](uint32_t p_Index)
+			{
+				Visit(p_Index, p_Function);
+			});
+		}
+	public: // Getters
+		/**
+		 * @brief Gets the most entities the view can visit.
+		 * @returns The size of the smallest set.
+		 */
+		uint32_t GetSizeHint() const { return m_Driver->GetSize(); }
+	private: // Helpers
+		template<typename F>
+		void Visit(uint32_t p_Index, const F& p_Function)
+		{
+			EntityID entity = m_Driver->GetEntities()[p_Index];
+			uint32_t indices[] = { Find(*std::get<ComponentPool<Ts>*>(m_Pools), entity, p_Index)... };
+			for (uint32_t index : indices)
+			{
+				if (index == SparseSet::NullIndex)
+					return;
+			}
+
+			Call(entity, indices, p_Function, std::index_sequence_for<Ts...>());
+		}
+
+		template<typename F, size_t... Is>
+		void Call(EntityID p_Entity, const uint32_t* p_Indices, const F& p_Function, std::index_sequence<Is...>)
+		{
+			p_Function(p_Entity, std::get<Is>(m_Pools)->GetComponents()[p_Indices[Is]]...);
+		}
+
+		/**
+		 * @brief Finds where a set holds an entity, trying the index
+		 * of the driving set first.
+		 * @returns The dense index, or NullIndex if it is missing.
+		 */
+		static uint32_t Find(const SparseSet& p_Set, EntityID p_Entity, uint32_t p_Index)
+		{
+			if (p_Index < p_Set.GetSize() && p_Set.GetEntities()[p_Index] == p_Entity)
+				return p_Index;
+
+			uint32_t index = p_Set.IndexOf(p_Entity);
+			return index != SparseSet::NullIndex && p_Set.GetEntities()[index] == p_Entity ? index : SparseSet::NullIndex;
+		}
+	private: // Private Member Variables
+		std::tuple<ComponentPool<Ts>*...> m_Pools;
+		const SparseSet* m_Driver;
+	};
+
+	/**
+	 * @brief Creates and destroys entities and owns the component
+	 * pools. Not thread safe, except for components touched from
+	 * View::ParallelEach.
+	 */
+	class Registry
+	{
+	public: // Constructors
+		Registry() = default;
+
+		Registry(const Registry&) = delete;
+		Registry& operator=(const Registry&) = delete;
+	public: // Entities
+		/**
+		 * @brief Creates an entity, reusing a destroyed index first.
+		 * @returns The entity.
+		 */
+		EntityID Create()
+		{
+			m_AliveCount++;
+			if (m_FreeList != EntityIndexMask)
+			{
+				// Destroyed slots hold the next free index and their bumped version.
+				uint32_t index = m_FreeList;
+				m_FreeList = GetEntityIndex(m_Entities[index]);
+				m_Entities[index] = (m_Entities[index] & EntityVersionMask) | index;
+				return m_Entities[index];
+			}
+
+			VT_CORE_ASSERT(m_Entities.size() < EntityIndexMask, "Too Many Entities!");
+			EntityID entity = (EntityID)m_Entities.size();
+			m_Entities.push_back(entity);
+			return entity;
+		}
+
+		/**
+		 * @brief Destroys an entity and removes all its components.
+		 * @param p_Entity The entity.
+		 */
+		void Destroy(EntityID p_Entity)
+		{
+			VT_CORE_ASSERT(IsValid(p_Entity), "Entity Does Not Exist!");
+
+			for (const Scope<SparseSet>& pool : m_Pools)
+			{
+				if (pool && pool->Contains(p_Entity))
+					pool->Remove(p_Entity);
+			}
+
+			uint32_t index = GetEntityIndex(p_Entity);
+			uint32_t version = (p_Entity & EntityVersionMask) + (1u << EntityIndexBits);
+			m_Entities[index] = version | m_FreeList;
+			m_FreeList = index;
+			m_AliveCount--;
+		}
+
+		/**
+		 * @brief Checks whether an entity exists.
+		 * @param p_Entity The entity.
+		 * @returns If the entity exists.
+		 */
+		bool IsValid(EntityID p_Entity) const
+		{
+			uint32_t index = GetEntityIndex(p_Entity);
+			return p_Entity != NullEntity && index < m_Entities.size() && m_Entities[index] == p_Entity;
+		}
+
+		uint32_t GetEntityCount() const { return m_AliveCount; }
+	public: // Components
+		template<typename T, typename... Args>
+		T& Emplace(EntityID p_Entity, Args&&... p_Arguments)
+		{
+			VT_CORE_ASSERT(IsValid(p_Entity), "Entity Does Not Exist!");
+			return GetPool<T>().Emplace(p_Entity, std::forward<Args>(p_Arguments)...);
+		}
+
+		template<typename T>
+		void Remove(EntityID p_Entity) { GetPool<T>().Remove(p_Entity); }
+
+		template<typename T>
+		bool Has(EntityID p_Entity) { return GetPool<T>().Contains(p_Entity); }
+
+		template<typename T>
+		T& Get(EntityID p_Entity) { return GetPool<T>().Get(p_Entity); }
+
+		template<typename T>
+		T* TryGet(EntityID p_Entity) { return GetPool<T>().TryGet(p_Entity); }
+
+		/**
+		 * @brief Gets a view of the entities with every component.
+		 * @returns The view.
+		 */
+		template<typename... Ts>
+		View<Ts...> GetView() { return View<Ts...>(GetPool<Ts>()...); }
+
+		/**
+		 * @brief Reorders the components of To to follow the order of
+		 * From, so views of both walk both arrays linearly.
+		 */
+		template<typename To, typename From>
+		void Sort() { GetPool<To>().SortAs(GetPool<From>()); }
+
+		/**
+		 * @brief Gets the pool of a component type, creating it the
+		 * first time.
+		 * @returns The pool.
+		 */
+		template<typename T>
+		ComponentPool<T>& GetPool()
+		{
+			uint32_t id = GetComponentTypeID<T>();
+			if (id >= m_Pools.size())
+				m_Pools.resize(id + 1);
+			if (!m_Pools[id])
+				m_Pools[id] = CreateScope<ComponentPool<T>>();
+			return static_cast<ComponentPool<T>&>(*m_Pools[id]);
+		}
+	private: // Helpers
+		/**
+		 * @brief Gets a dense index for a component type, shared by
+		 * every registry.
+		 */
+		template<typename T>
+		static uint32_t GetComponentTypeID()
+		{
+			static const uint32_t id = s_NextComponentTypeID.fetch_add(1, std::memory_order_relaxed);
+			return id;
+		}
+	private: // Private Member Variables
+		std::vector<EntityID> m_Entities;
+		uint32_t m_FreeList = EntityIndexMask; // The first destroyed index, the mask if there is none.
+		uint32_t m_AliveCount = 0;
+
+		std::vector<Scope<SparseSet>> m_Pools;
+	private: // Private Static Member Variables
+		inline static std::atomic<uint32_t> s_NextComponentTypeID = 0;
+	};
+}
+
+#endif // __VIOLET_ENGINE_SCENE_REGISTRY_H_INCLUDED__
\ No newline at end of file
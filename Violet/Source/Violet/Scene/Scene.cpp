@@ -0,0 +1,248 @@
+/////////////////
+///
+/// Scene.cpp
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// A world of entities and the systems running
+/// over them.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Scene/Scene.h"
+
+#include "Violet/Renderer/Renderer2D.h"
+
+#include "Violet/Scene/Components.h"
+#include "Violet/Scene/Entity.h"
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif // _MSC_VER
+
+namespace Violet
+{
+	/**
+	 * @brief Counts the zero bits below the lowest set bit.
+	 * @param p_Bits The bits, not all zero.
+	 * @returns The index of the lowest set bit.
+	 */
+	static uint32_t CountTrailingZeros(uint64_t p_Bits)
+	{
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward64(&index, p_Bits);
+		return (uint32_t)index;
+#else
+		return (uint32_t)__builtin_ctzll(p_Bits);
+#endif // _MSC_VER
+	}
+
+	/**
+	 * @brief Gets the bounds of the unit quad under a transform.
+	 * @param p_Transform The world matrix.
+	 * @returns The bounds.
+	 */
+	static Bounds2D GetQuadBounds(const glm::mat4& p_Transform)
+	{
+		// The corners reach out by half of each axis.
+		glm::vec2 extent = { (fabsf(p_Transform[0].x) + fabsf(p_Transform[1].x)) * 0.5f, (fabsf(p_Transform[0].y) + fabsf(p_Transform[1].y)) * 0.5f };
+		glm::vec2 origin = { p_Transform[3].x, p_Transform[3].y };
+		return { origin - extent, origin + extent };
+	}
+
+	/**
+	 * @brief Creates an entity with a transform, as a root of the
+	 * transform hierarchy, and adds it to the spatial index.
+	 * @param p_Name (optional) The name of the entity. Unnamed
+	 * entities get no TagComponent, so bulk spawns stay lean.
+	 * @returns The entity.
+	 */
+	Entity Scene::CreateEntity(const std::string& p_Name)
+	{
+		Entity entity(m_Registry.Create(), this);
+		entity.AddComponent<TransformComponent>();
+		m_Hierarchy.Add(entity.GetHandle());
+		m_SpatialIndex.Insert(entity.GetHandle(), GetQuadBounds(glm::mat4(1.0f)));
+		if (!p_Name.empty())
+			entity.AddComponent<TagComponent>(p_Name);
+		return entity;
+	}
+
+	/**
+	 * @brief Destroys an entity and all its components. Its
+	 * children become roots.
+	 * @param p_Entity The entity.
+	 */
+	void Scene::DestroyEntity(Entity p_Entity)
+	{
+		if (m_Hierarchy.Contains(p_Entity.GetHandle()))
+			m_Hierarchy.Remove(p_Entity.GetHandle());
+		if (m_SpatialIndex.Contains(p_Entity.GetHandle()))
+			m_SpatialIndex.Remove(p_Entity.GetHandle());
+		m_Registry.Destroy(p_Entity.GetHandle());
+	}
+
+	/**
+	 * @brief Finds the entity under a point, exactly against its
+	 * rotated quad. Uses the transforms of the last UpdateTransforms.
+	 * @param p_Position The point in world space.
+	 * @returns The entity closest to the viewer, or a null Entity.
+	 */
+	Entity Scene::PickEntity(const glm::vec2& p_Position)
+	{
+		VT_PROFILE_FUNCTION();
+
+		EntityID picked = NullEntity;
+		float pickedDepth = 0.0f;
+		uint32_t pickedIndex = 0;
+
+		const glm::mat4* worldMatrices = m_Hierarchy.GetWorldMatrices();
+		m_SpatialIndex.QueryPoint(p_Position, [&](EntityID p_Entity, const Bounds2D& p_Bounds)
+		{
+			uint32_t index = m_Hierarchy.IndexOf(p_Entity);
+			const glm::mat4& transform = worldMatrices[index];
+
+			// Solve for the point in the quad's own axes.
+			glm::vec2 axisX = { transform[0].x, transform[0].y };
+			glm::vec2 axisY = { transform[1].x, transform[1].y };
+			glm::vec2 offset = { p_Position.x - transform[3].x, p_Position.y - transform[3].y };
+			float determinant = axisX.x * axisY.y - axisY.x * axisX.y;
+			if (determinant == 0.0f)
+				return;
+
+			float u = (offset.x * axisY.y - axisY.x * offset.y) / determinant;
+			float v = (axisX.x * offset.y - offset.x * axisX.y) / determinant;
+			if (fabsf(u) > 0.5f || fabsf(v) > 0.5f)
+				return;
+
+			// Higher z is closer, among equals the one drawn later wins.
+			float depth = transform[3].z;
+			if (picked == NullEntity || depth > pickedDepth || (depth == pickedDepth && index > pickedIndex))
+			{
+				picked = p_Entity;
+				pickedDepth = depth;
+				pickedIndex = index;
+			}
+		});
+
+		return picked != NullEntity ? Entity(picked, this) : Entity();
+	}
+
+	/**
+	 * @brief The transform system. Rebuilds the cached world matrices
+	 * of the transforms changed since the last call.
+	 */
+	void Scene::UpdateTransforms()
+	{
+		VT_PROFILE_FUNCTION();
+
+		// Sorting first, so the transforms are walked in hierarchy order.
+		m_Hierarchy.Sort();
+		FollowHierarchy<TransformComponent>(m_TransformOrder);
+		m_Hierarchy.Update(m_Registry.GetPool<TransformComponent>());
+
+		// Only the rebuilt matrices can have moved in the spatial index.
+		const std::vector<uint32_t>& updated = m_Hierarchy.GetUpdatedIndices();
+		const EntityID* entities = m_Hierarchy.GetEntities();
+		const glm::mat4* worldMatrices = m_Hierarchy.GetWorldMatrices();
+		m_EntityBatch.resize(updated.size());
+		m_BoundsBatch.resize(updated.size());
+		for (size_t i = 0; i < updated.size(); i++)
+		{
+			m_EntityBatch[i] = entities[updated[i]];
+			m_BoundsBatch[i] = GetQuadBounds(worldMatrices[updated[i]]);
+		}
+		m_SpatialIndex.Update(m_EntityBatch.data(), m_BoundsBatch.data(), (uint32_t)updated.size());
+	}
+
+	/**
+	 * @brief Draws the scene.
+	 * @param p_Camera The camera to draw the scene with.
+	 */
+	void Scene::OnRender(const OrthographicCamera& p_Camera)
+	{
+		VT_PROFILE_FUNCTION();
+
+		UpdateTransforms();
+
+		Renderer2D::BeginScene(p_Camera);
+		RenderSprites(p_Camera.GetViewBounds());
+		Renderer2D::EndScene();
+	}
+
+	/**
+	 * @brief The sprite renderer system. Draws the entities with a
+	 * sprite the spatial index finds in view, with their cached
+	 * world matrices, as one Renderer2D::DrawSprites call.
+	 * @param p_ViewBounds The world space region the camera sees.
+	 */
+	void Scene::RenderSprites(const Bounds2D& p_ViewBounds)
+	{
+		VT_PROFILE_FUNCTION();
+
+		FollowHierarchy<SpriteRendererComponent>(m_SpriteOrder);
+		ComponentPool<SpriteRendererComponent>& sprites = m_Registry.GetPool<SpriteRendererComponent>();
+
+		{
+			VT_PROFILE_SCOPE("Cull Sprites");
+
+			// One bit per hierarchy index, so they come out in order without sorting.
+			m_VisibleMask.assign((m_Hierarchy.GetSize() + 63) / 64, 0);
+			m_SpatialIndex.QueryRegion(p_ViewBounds, [this](EntityID p_Entity, const Bounds2D& p_Bounds)
+			{
+				uint32_t index = m_Hierarchy.IndexOf(p_Entity);
+				m_VisibleMask[index / 64] |= 1ull << (index % 64);
+			});
+		}
+
+		// Gathered in hierarchy order, the order without culling, which also reads the matrices front to back.
+		// Handed over in small batches that stay in cache.
+		Renderer2D::Sprite batch[128];
+		uint32_t batchCount = 0;
+
+		const EntityID* entities = m_Hierarchy.GetEntities();
+		const glm::mat4* worldMatrices = m_Hierarchy.GetWorldMatrices();
+		for (uint32_t word = 0; word < m_VisibleMask.size(); word++)
+		{
+			for (uint64_t bits = m_VisibleMask[word]; bits != 0; bits &= bits - 1)
+			{
+				uint32_t index = word * 64 + CountTrailingZeros(bits);
+				const SpriteRendererComponent* sprite = sprites.TryGet(entities[index]);
+				if (!sprite)
+					continue;
+
+				const glm::mat4& matrix = worldMatrices[index];
+				batch[batchCount++] = { glm::vec3(matrix[3]), glm::vec2(matrix[0]), glm::vec2(matrix[1]), sprite->Color, sprite->Texture.get(), sprite->TilingFactor };
+				if (batchCount == sizeof(batch) / sizeof(batch[0]))
+				{
+					Renderer2D::DrawSprites(batch, batchCount);
+					batchCount = 0;
+				}
+			}
+		}
+
+		Renderer2D::DrawSprites(batch, batchCount);
+	}
+
+	/**
+	 * @brief Sorts a pool to follow the order of the hierarchy, if
+	 * either changed order since the last sort.
+	 * @param p_Order The versions of the last sort.
+	 */
+	template<typename T>
+	void Scene::FollowHierarchy(SortedOrder& p_Order)
+	{
+		ComponentPool<T>& pool = m_Registry.GetPool<T>();
+		if (pool.GetOrderVersion() == p_Order.PoolVersion && m_Hierarchy.GetOrderVersion() == p_Order.HierarchyVersion)
+			return;
+
+		VT_PROFILE_FUNCTION();
+
+		pool.SortAs(m_Hierarchy);
+		p_Order.PoolVersion = pool.GetOrderVersion();
+		p_Order.HierarchyVersion = m_Hierarchy.GetOrderVersion();
+	}
+}
\ No newline at end of file
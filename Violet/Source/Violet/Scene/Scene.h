@@ -0,0 +1,80 @@
+/////////////////
+///
+/// Scene.h
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// A world of entities and the systems running
+/// over them.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_SCENE_SCENE_H_INCLUDED__
+#define __VIOLET_ENGINE_SCENE_SCENE_H_INCLUDED__
+
+#include "Violet/Core/Timestep.h"
+#include "Violet/Renderer/OrthographicCamera.h"
+#include "Violet/Scene/Registry.h"
+#include "Violet/Scene/SpatialIndex.h"
+#include "Violet/Scene/TransformHierarchy.h"
+
+namespace Violet
+{
+	class Entity;
+
+	/**
+	 * @brief Owns the entities of a world and renders them.
+	 */
+	class Scene
+	{
+	public: // Constructors & Deconstructors
+		Scene() = default;
+		~Scene() = default;
+
+		Scene(const Scene&) = delete;
+		Scene& operator=(const Scene&) = delete;
+	public: // Entities
+		Entity CreateEntity(const std::string& p_Name = std::string());
+		void DestroyEntity(Entity p_Entity);
+		Entity PickEntity(const glm::vec2& p_Position);
+	public: // Systems
+		void UpdateTransforms();
+		void OnRender(const OrthographicCamera& p_Camera);
+	public: // Getters
+		Registry& GetRegistry() { return m_Registry; }
+		TransformHierarchy& GetTransformHierarchy() { return m_Hierarchy; }
+		const SpatialIndex& GetSpatialIndex() const { return m_SpatialIndex; }
+		uint32_t GetEntityCount() const { return m_Registry.GetEntityCount(); }
+	private: // Private Structures
+		/**
+		 * @brief The order versions a pool was last sorted for.
+		 */
+		struct SortedOrder
+		{
+			uint32_t PoolVersion = SparseSet::NullIndex;
+			uint32_t HierarchyVersion = SparseSet::NullIndex;
+		};
+	private: // Systems
+		void RenderSprites(const Bounds2D& p_ViewBounds);
+	private: // Helpers
+		template<typename T>
+		void FollowHierarchy(SortedOrder& p_Order);
+	private: // Private Member Variables
+		Registry m_Registry;
+		TransformHierarchy m_Hierarchy;
+		SpatialIndex m_SpatialIndex;
+
+		// Transforms and sprites follow the hierarchy, so its passes read them in order.
+		SortedOrder m_TransformOrder;
+		SortedOrder m_SpriteOrder;
+
+		// Scratch space of the systems, kept to avoid allocating every frame.
+		std::vector<EntityID> m_EntityBatch;
+		std::vector<Bounds2D> m_BoundsBatch;
+		std::vector<uint64_t> m_VisibleMask;
+	private: // Friend Objects
+		friend class Entity;
+	};
+}
+
+#endif // __VIOLET_ENGINE_SCENE_SCENE_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,351 @@
+/////////////////
+///
+/// SpatialIndex.cpp
+/// Violet McAllister
+/// August 6th, 2022
+/// Updated: August 6th, 2022
+///
+/// A loose quadtree over entity bounds, for culling
+/// and picking. Every level of the tree is a grid
+/// stored in one hash table of cells, so there are
+/// no node pointers to chase and a query only
+/// visits the cells around the region it asks for.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Scene/SpatialIndex.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Constructs an empty spatial index.
+	 * @param p_CellSize The size of the cells of the finest level,
+	 * about the size of the smallest entities.
+	 */
+	SpatialIndex::SpatialIndex(float p_CellSize)
+		: m_CellSize(p_CellSize)
+	{
+		VT_CORE_ASSERT(p_CellSize > 0.0f, "Cell Size Must Be Positive!");
+
+		m_Cells.emplace_back(); // OversizedCell
+		m_Table.assign(64, NullIndex);
+	}
+
+	/**
+	 * @brief Adds an entity.
+	 * @param p_Entity The entity, not yet in the index.
+	 * @param p_Bounds The bounds of the entity.
+	 */
+	void SpatialIndex::Insert(EntityID p_Entity, const Bounds2D& p_Bounds)
+	{
+		VT_CORE_ASSERT(!Contains(p_Entity), "Entity Is Already In The Spatial Index!");
+
+		uint32_t index = SparseSet::Insert(p_Entity);
+		m_Items.push_back({ p_Bounds });
+		Link(index, GetCell(GetCellKey(p_Bounds)));
+	}
+
+	/**
+	 * @brief Adds many entities.
+	 * @param p_Entities The entities, none of them in the index yet.
+	 * @param p_Bounds The bounds of every entity.
+	 * @param p_Count The number of entities.
+	 */
+	void SpatialIndex::Insert(const EntityID* p_Entities, const Bounds2D* p_Bounds, uint32_t p_Count)
+	{
+		VT_PROFILE_FUNCTION();
+
+		m_Items.reserve(m_Items.size() + p_Count);
+		for (uint32_t i = 0; i < p_Count; i++)
+			Insert(p_Entities[i], p_Bounds[i]);
+	}
+
+	/**
+	 * @brief Changes the bounds of an entity. It only moves to
+	 * another cell when its center or size left the old one.
+	 * @param p_Entity The entity, in the index.
+	 * @param p_Bounds The new bounds.
+	 */
+	void SpatialIndex::Update(EntityID p_Entity, const Bounds2D& p_Bounds)
+	{
+		VT_CORE_ASSERT(Contains(p_Entity), "Entity Is Not In The Spatial Index!");
+
+		uint32_t index = IndexOf(p_Entity);
+		m_Items[index].Bounds = p_Bounds;
+
+		CellKey key = GetCellKey(p_Bounds);
+		const Cell& cell = m_Cells[m_Items[index].Cell];
+		if (cell.Level == key.Level && (key.Level == NullIndex || (cell.X == key.X && cell.Y == key.Y)))
+			return;
+
+		Unlink(index);
+		Link(index, GetCell(key));
+	}
+
+	/**
+	 * @brief Changes the bounds of many entities.
+	 * @param p_Entities The entities, all in the index.
+	 * @param p_Bounds The new bounds of every entity.
+	 * @param p_Count The number of entities.
+	 */
+	void SpatialIndex::Update(const EntityID* p_Entities, const Bounds2D* p_Bounds, uint32_t p_Count)
+	{
+		VT_PROFILE_FUNCTION();
+
+		for (uint32_t i = 0; i < p_Count; i++)
+			Update(p_Entities[i], p_Bounds[i]);
+	}
+
+	/**
+	 * @brief Removes an entity.
+	 * @param p_Entity The entity, in the index.
+	 */
+	void SpatialIndex::Remove(EntityID p_Entity)
+	{
+		VT_CORE_ASSERT(Contains(p_Entity), "Entity Is Not In The Spatial Index!");
+
+		uint32_t index = IndexOf(p_Entity);
+		Unlink(index);
+		Erase(p_Entity);
+
+		// The last item took the place of the removed one, point its neighbours at it.
+		uint32_t last = (uint32_t)m_Items.size() - 1;
+		if (index != last)
+		{
+			Item& moved = m_Items[index];
+			moved = m_Items[last];
+			if (moved.Previous != NullIndex)
+				m_Items[moved.Previous].Next = index;
+			else
+				m_Cells[moved.Cell].First = index;
+			if (moved.Next != NullIndex)
+				m_Items[moved.Next].Previous = index;
+		}
+		m_Items.pop_back();
+	}
+
+	/**
+	 * @brief Removes many entities.
+	 * @param p_Entities The entities, all in the index.
+	 * @param p_Count The number of entities.
+	 */
+	void SpatialIndex::Remove(const EntityID* p_Entities, uint32_t p_Count)
+	{
+		VT_PROFILE_FUNCTION();
+
+		for (uint32_t i = 0; i < p_Count; i++)
+			Remove(p_Entities[i]);
+	}
+
+	/**
+	 * @brief Collects the entities overlapping a region.
+	 * @param p_Region The region.
+	 * @param p_Entities The entities are appended to this.
+	 */
+	void SpatialIndex::QueryRegion(const Bounds2D& p_Region, std::vector<EntityID>& p_Entities) const
+	{
+		VT_PROFILE_FUNCTION();
+
+		QueryRegion(p_Region, [&p_Entities](EntityID p_Entity, const Bounds2D& p_Bounds)
+		{
+			p_Entities.push_back(p_Entity);
+		});
+	}
+
+	/**
+	 * @brief Looks up a cell in the table.
+	 * @returns The index of the cell, or NullIndex if it was never used.
+	 */
+	uint32_t SpatialIndex::FindCell(uint32_t p_Level, int32_t p_X, int32_t p_Y) const
+	{
+		uint32_t mask = (uint32_t)m_Table.size() - 1;
+		for (uint32_t slot = Hash(p_Level, p_X, p_Y) & mask; m_Table[slot] != NullIndex; slot = (slot + 1) & mask)
+		{
+			const Cell& cell = m_Cells[m_Table[slot]];
+			if (cell.Level == p_Level && cell.X == p_X && cell.Y == p_Y)
+				return m_Table[slot];
+		}
+
+		return NullIndex;
+	}
+
+	/**
+	 * @brief Finds the cell bounds belong in: the cell holding their
+	 * center on the first level with cells as large as they are.
+	 * @param p_Bounds The bounds.
+	 * @returns The key of the cell.
+	 */
+	SpatialIndex::CellKey SpatialIndex::GetCellKey(const Bounds2D& p_Bounds) const
+	{
+		glm::vec2 size = p_Bounds.GetSize();
+		glm::vec2 center = p_Bounds.GetCenter();
+		float extent = std::max(size.x, size.y);
+		if (!(extent <= GetCellSize(MaxLevels - 1)) || !std::isfinite(center.x) || !std::isfinite(center.y))
+			return { NullIndex, 0, 0 };
+
+		uint32_t level = 0;
+		while (GetCellSize(level) < extent)
+			level++;
+
+		float cellSize = GetCellSize(level);
+		double x = std::floor(center.x / cellSize), y = std::floor(center.y / cellSize);
+		if (x < INT32_MIN || x > INT32_MAX || y < INT32_MIN || y > INT32_MAX)
+			return { NullIndex, 0, 0 };
+
+		return { level, (int32_t)x, (int32_t)y };
+	}
+
+	/**
+	 * @brief Finds a cell, adding it the first time.
+	 * @param p_Key The key of the cell.
+	 * @returns The index of the cell.
+	 */
+	uint32_t SpatialIndex::GetCell(const CellKey& p_Key)
+	{
+		if (p_Key.Level == NullIndex)
+			return OversizedCell;
+
+		uint32_t index = FindCell(p_Key.Level, p_Key.X, p_Key.Y);
+		if (index != NullIndex)
+			return index;
+
+		// Kept at most half full, so probes stay short.
+		if ((m_Cells.size() - m_FreeCells.size() + 1) * 2 > m_Table.size())
+			GrowTable();
+
+		if (!m_FreeCells.empty())
+		{
+			index = m_FreeCells.back();
+			m_FreeCells.pop_back();
+			m_Cells[index] = { p_Key.X, p_Key.Y, p_Key.Level, NullIndex };
+		}
+		else
+		{
+			index = (uint32_t)m_Cells.size();
+			m_Cells.push_back({ p_Key.X, p_Key.Y, p_Key.Level, NullIndex });
+		}
+
+		uint32_t mask = (uint32_t)m_Table.size() - 1;
+		uint32_t slot = Hash(p_Key.Level, p_Key.X, p_Key.Y) & mask;
+		while (m_Table[slot] != NullIndex)
+			slot = (slot + 1) & mask;
+		m_Table[slot] = index;
+		return index;
+	}
+
+	/**
+	 * @brief Takes an empty cell out of the table and keeps it
+	 * for reuse.
+	 * @param p_Cell The index of the cell, not the oversized cell.
+	 */
+	void SpatialIndex::FreeCell(uint32_t p_Cell)
+	{
+		Cell& cell = m_Cells[p_Cell];
+		VT_CORE_ASSERT(cell.First == NullIndex, "Only Empty Cells Can Be Freed!");
+
+		uint32_t mask = (uint32_t)m_Table.size() - 1;
+		uint32_t hole = Hash(cell.Level, cell.X, cell.Y) & mask;
+		while (m_Table[hole] != p_Cell)
+			hole = (hole + 1) & mask;
+
+		// Shift the rest of the probe run back over the hole, so lookups don't stop early.
+		for (uint32_t slot = (hole + 1) & mask; m_Table[slot] != NullIndex; slot = (slot + 1) & mask)
+		{
+			const Cell& other = m_Cells[m_Table[slot]];
+			uint32_t home = Hash(other.Level, other.X, other.Y) & mask;
+			if (((slot - home) & mask) >= ((slot - hole) & mask))
+			{
+				m_Table[hole] = m_Table[slot];
+				hole = slot;
+			}
+		}
+		m_Table[hole] = NullIndex;
+
+		cell.Level = NullIndex;
+		m_FreeCells.push_back(p_Cell);
+	}
+
+	/**
+	 * @brief Puts an item at the front of a cell.
+	 * @param p_Item The index of the item, in no cell.
+	 * @param p_Cell The index of the cell.
+	 */
+	void SpatialIndex::Link(uint32_t p_Item, uint32_t p_Cell)
+	{
+		Item& item = m_Items[p_Item];
+		Cell& cell = m_Cells[p_Cell];
+
+		item.Cell = p_Cell;
+		item.Previous = NullIndex;
+		item.Next = cell.First;
+		if (cell.First != NullIndex)
+			m_Items[cell.First].Previous = p_Item;
+		cell.First = p_Item;
+
+		if (cell.Level != NullIndex)
+			m_LevelCounts[cell.Level]++;
+	}
+
+	/**
+	 * @brief Takes an item out of its cell.
+	 * @param p_Item The index of the item.
+	 */
+	void SpatialIndex::Unlink(uint32_t p_Item)
+	{
+		Item& item = m_Items[p_Item];
+		Cell& cell = m_Cells[item.Cell];
+
+		if (item.Previous != NullIndex)
+			m_Items[item.Previous].Next = item.Next;
+		else
+			cell.First = item.Next;
+		if (item.Next != NullIndex)
+			m_Items[item.Next].Previous = item.Previous;
+
+		uint32_t index = item.Cell;
+		item.Cell = NullIndex;
+		item.Previous = NullIndex;
+		item.Next = NullIndex;
+
+		if (cell.Level != NullIndex)
+		{
+			m_LevelCounts[cell.Level]--;
+			if (cell.First == NullIndex)
+				FreeCell(index);
+		}
+	}
+
+	/**
+	 * @brief Doubles the table and puts every cell back in.
+	 */
+	void SpatialIndex::GrowTable()
+	{
+		VT_PROFILE_FUNCTION();
+
+		m_Table.assign(m_Table.size() * 2, NullIndex);
+		uint32_t mask = (uint32_t)m_Table.size() - 1;
+		for (uint32_t index = 1; index < m_Cells.size(); index++)
+		{
+			const Cell& cell = m_Cells[index];
+			if (cell.Level == NullIndex)
+				continue; // Free
+
+			uint32_t slot = Hash(cell.Level, cell.X, cell.Y) & mask;
+			while (m_Table[slot] != NullIndex)
+				slot = (slot + 1) & mask;
+			m_Table[slot] = index;
+		}
+	}
+
+	/**
+	 * @brief Hashes the key of a cell.
+	 * @returns The hash.
+	 */
+	uint32_t SpatialIndex::Hash(uint32_t p_Level, int32_t p_X, int32_t p_Y)
+	{
+		uint32_t hash = (uint32_t)p_X * 0x9e3779b1u ^ (uint32_t)p_Y * 0x85ebca77u ^ p_Level * 0xc2b2ae3du;
+		return hash ^ (hash >> 15);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,182 @@
+/////////////////
+///
+/// SpatialIndex.h
+/// Violet McAllister
+/// August 6th, 2022
+/// Updated: August 6th, 2022
+///
+/// A loose quadtree over entity bounds, for culling
+/// and picking. Every level of the tree is a grid
+/// stored in one hash table of cells, so there are
+/// no node pointers to chase and a query only
+/// visits the cells around the region it asks for.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_SCENE_SPATIAL_INDEX_H_INCLUDED__
+#define __VIOLET_ENGINE_SCENE_SPATIAL_INDEX_H_INCLUDED__
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "Violet/Core/Bounds2D.h"
+#include "Violet/Scene/Registry.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Finds the entities overlapping a region. An entity is
+	 * stored once, in the cell holding its center on the level whose
+	 * cells are at least as large as it is. Cells are loose: their
+	 * entities stick out by at most half a cell, so a query only
+	 * grows its region by half a cell per level.
+	 */
+	class SpatialIndex : public SparseSet
+	{
+	public: // Constants
+		static constexpr uint32_t MaxLevels = 16;
+	public: // Constructors
+		SpatialIndex(float p_CellSize = 4.0f);
+	public: // Main Functionality
+		void Insert(EntityID p_Entity, const Bounds2D& p_Bounds);
+		void Insert(const EntityID* p_Entities, const Bounds2D* p_Bounds, uint32_t p_Count);
+		void Update(EntityID p_Entity, const Bounds2D& p_Bounds);
+		void Update(const EntityID* p_Entities, const Bounds2D* p_Bounds, uint32_t p_Count);
+		virtual void Remove(EntityID p_Entity) override;
+		void Remove(const EntityID* p_Entities, uint32_t p_Count);
+
+		/**
+		 * @brief Calls a function for every entity overlapping a region.
+		 * @param p_Region The region.
+		 * @param p_Function Called as p_Function(entity, bounds).
+		 */
+		template<typename F>
+		void QueryRegion(const Bounds2D& p_Region, const F& p_Function) const
+		{
+			VisitCell(m_Cells[OversizedCell], p_Region, p_Function);
+
+			for (uint32_t level = 0; level < MaxLevels; level++)
+			{
+				if (m_LevelCounts[level] == 0)
+					continue;
+
+				// Anything in a cell lies within half a cell of it.
+				float cellSize = GetCellSize(level);
+				double minX = std::floor((p_Region.Min.x - cellSize * 0.5) / cellSize);
+				double minY = std::floor((p_Region.Min.y - cellSize * 0.5) / cellSize);
+				double maxX = std::floor((p_Region.Max.x + cellSize * 0.5) / cellSize);
+				double maxY = std::floor((p_Region.Max.y + cellSize * 0.5) / cellSize);
+
+				// Past the number of cells there are, walking every cell is cheaper.
+				bool inRange = minX >= INT32_MIN && maxX <= INT32_MAX && minY >= INT32_MIN && maxY <= INT32_MAX;
+				if (!inRange || !((maxX - minX + 1.0) * (maxY - minY + 1.0) <= (double)m_Cells.size()))
+				{
+					for (const Cell& cell : m_Cells)
+					{
+						if (cell.Level == level && cell.X >= minX && cell.X <= maxX && cell.Y >= minY && cell.Y <= maxY)
+							VisitCell(cell, p_Region, p_Function);
+					}
+					continue;
+				}
+
+				for (int32_t y = (int32_t)minY; y <= (int32_t)maxY; y++)
+				{
+					for (int32_t x = (int32_t)minX; x <= (int32_t)maxX; x++)
+					{
+						uint32_t cell = FindCell(level, x, y);
+						if (cell != NullIndex)
+							VisitCell(m_Cells[cell], p_Region, p_Function);
+					}
+				}
+			}
+		}
+
+		/**
+		 * @brief Calls a function for every entity whose bounds hold a point.
+		 * @param p_Point The point.
+		 * @param p_Function Called as p_Function(entity, bounds).
+		 */
+		template<typename F>
+		void QueryPoint(const glm::vec2& p_Point, const F& p_Function) const
+		{
+			QueryRegion({ p_Point, p_Point }, p_Function);
+		}
+
+		void QueryRegion(const Bounds2D& p_Region, std::vector<EntityID>& p_Entities) const;
+	public: // Getters
+		/**
+		 * @brief Gets the bounds an entity was stored with.
+		 * @param p_Entity The entity, in the index.
+		 * @returns The bounds.
+		 */
+		const Bounds2D& GetBounds(EntityID p_Entity) const
+		{
+			VT_CORE_ASSERT(Contains(p_Entity), "Entity Is Not In The Spatial Index!");
+			return m_Items[IndexOf(p_Entity)].Bounds;
+		}
+
+		float GetCellSize(uint32_t p_Level = 0) const { return m_CellSize * (float)(1u << p_Level); }
+	private: // Private Structures
+		struct Cell
+		{
+			int32_t X = 0;
+			int32_t Y = 0;
+			uint32_t Level = NullIndex; // NullIndex for the oversized cell and free cells.
+			uint32_t First = NullIndex; // The first item, linked through Item::Next.
+		};
+
+		struct CellKey
+		{
+			uint32_t Level; // NullIndex for the oversized cell.
+			int32_t X;
+			int32_t Y;
+		};
+
+		struct Item
+		{
+			Bounds2D Bounds;
+			uint32_t Cell = NullIndex;
+			uint32_t Previous = NullIndex;
+			uint32_t Next = NullIndex;
+		};
+	private: // Helpers
+		template<typename F>
+		void VisitCell(const Cell& p_Cell, const Bounds2D& p_Region, const F& p_Function) const
+		{
+			const EntityID* entities = GetEntities();
+			for (uint32_t item = p_Cell.First; item != NullIndex; item = m_Items[item].Next)
+			{
+				if (m_Items[item].Bounds.Overlaps(p_Region))
+					p_Function(entities[item], m_Items[item].Bounds);
+			}
+		}
+
+		uint32_t FindCell(uint32_t p_Level, int32_t p_X, int32_t p_Y) const;
+		CellKey GetCellKey(const Bounds2D& p_Bounds) const;
+		uint32_t GetCell(const CellKey& p_Key);
+		void FreeCell(uint32_t p_Cell);
+		void Link(uint32_t p_Item, uint32_t p_Cell);
+		void Unlink(uint32_t p_Item);
+		void GrowTable();
+
+		static uint32_t Hash(uint32_t p_Level, int32_t p_X, int32_t p_Y);
+	private: // Private Member Variables
+		float m_CellSize;
+
+		// Items are parallel to the entities of the set.
+		std::vector<Item> m_Items;
+
+		// The table maps a cell to its index. Emptied cells leave the
+		// table and are reused, so neither outgrows the most cells in use.
+		std::vector<Cell> m_Cells;
+		std::vector<uint32_t> m_FreeCells;
+		std::vector<uint32_t> m_Table;
+		uint32_t m_LevelCounts[MaxLevels] = {};
+
+		// Entities too large for the top level, always visited.
+		static constexpr uint32_t OversizedCell = 0;
+	};
+}
+
+#endif // __VIOLET_ENGINE_SCENE_SPATIAL_INDEX_H_INCLUDED__
\ No newline at end of file
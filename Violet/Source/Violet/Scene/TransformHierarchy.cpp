@@ -0,0 +1,276 @@
+/////////////////
+///
+/// TransformHierarchy.cpp
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Parents entities to each other and caches the
+/// world matrix of every transform. Nodes are kept
+/// in a flat array sorted by depth, so one pass
+/// updates parents before their children and only
+/// recomputes the matrices that changed.
+///
+/////////////////
+
+#include "vtpch.h"
+
+#include "Violet/Scene/TransformHierarchy.h"
+
+namespace Violet
+{
+	/**
+	 * @brief Adds an entity as a root.
+	 * @param p_Entity The entity, not yet in the hierarchy.
+	 */
+	void TransformHierarchy::Add(EntityID p_Entity)
+	{
+		VT_CORE_ASSERT(!Contains(p_Entity), "Entity Is Already In The Hierarchy!");
+
+		// Roots may go anywhere, so appending keeps the order valid.
+		Insert(p_Entity);
+		m_Nodes.emplace_back();
+		m_WorldMatrices.emplace_back(1.0f);
+		m_AnyDirty.store(true, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Removes an entity. Its children become roots, keeping
+	 * their local transforms.
+	 * @param p_Entity The entity, in the hierarchy.
+	 */
+	void TransformHierarchy::Remove(EntityID p_Entity)
+	{
+		VT_CORE_ASSERT(Contains(p_Entity), "Entity Is Not In The Hierarchy!");
+
+		Node& node = m_Nodes[IndexOf(p_Entity)];
+		if (node.Parent != NullEntity)
+			m_Nodes[IndexOf(node.Parent)].ChildCount--;
+
+		if (node.ChildCount > 0)
+		{
+			for (Node& other : m_Nodes)
+			{
+				if (other.Parent == p_Entity)
+				{
+					other.Parent = NullEntity;
+					other.ParentIndex = NullIndex;
+					other.Dirty = true;
+				}
+			}
+			m_AnyDirty.store(true, std::memory_order_relaxed);
+		}
+
+		uint32_t index = Erase(p_Entity);
+		if (index != m_Nodes.size() - 1)
+		{
+			// The last node may now sit ahead of its parent.
+			m_Nodes[index] = m_Nodes.back();
+			m_WorldMatrices[index] = m_WorldMatrices.back();
+			m_NeedsSort = true;
+		}
+		m_Nodes.pop_back();
+		m_WorldMatrices.pop_back();
+	}
+
+	/**
+	 * @brief Parents an entity to another. The local transform of
+	 * the child is kept, so it is now relative to the new parent.
+	 * @param p_Child The entity being parented.
+	 * @param p_Parent The new parent, NullEntity to make the child a root.
+	 */
+	void TransformHierarchy::SetParent(EntityID p_Child, EntityID p_Parent)
+	{
+		VT_CORE_ASSERT(Contains(p_Child), "Entity Is Not In The Hierarchy!");
+		VT_CORE_ASSERT(p_Parent == NullEntity || Contains(p_Parent), "Parent Is Not In The Hierarchy!");
+
+		Node& node = m_Nodes[IndexOf(p_Child)];
+		if (node.Parent == p_Parent)
+			return;
+
+#ifdef VT_ENABLE_ASSERTS
+		for (EntityID ancestor = p_Parent; ancestor != NullEntity; ancestor = m_Nodes[IndexOf(ancestor)].Parent)
+			VT_CORE_ASSERT(ancestor != p_Child, "Parenting Would Create A Cycle!");
+#endif // VT_ENABLE_ASSERTS
+
+		if (node.Parent != NullEntity)
+			m_Nodes[IndexOf(node.Parent)].ChildCount--;
+		if (p_Parent != NullEntity)
+			m_Nodes[IndexOf(p_Parent)].ChildCount++;
+
+		node.Parent = p_Parent;
+		node.Dirty = true;
+		m_NeedsSort = true;
+		m_AnyDirty.store(true, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Has the world matrix of an entity rebuilt by the next
+	 * Update, after its TransformComponent was edited. Jobs of a
+	 * View::ParallelEach may mark their own entities.
+	 * @param p_Entity The entity, in the hierarchy.
+	 */
+	void TransformHierarchy::MarkDirty(EntityID p_Entity)
+	{
+		VT_CORE_ASSERT(Contains(p_Entity), "Entity Is Not In The Hierarchy!");
+		m_Nodes[IndexOf(p_Entity)].Dirty = true;
+		m_AnyDirty.store(true, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Restores the depth order if parenting or removals broke
+	 * it. Update sorts on its own, sorting ahead lets pools follow
+	 * the new order before Update reads them.
+	 */
+	void TransformHierarchy::Sort()
+	{
+		if (m_NeedsSort)
+			SortByDepth();
+	}
+
+	/**
+	 * @brief Rebuilds the world matrices of the entities marked dirty,
+	 * and of everything below them.
+	 * @param p_Transforms The local transforms of the entities. They
+	 * are read in place where the pool follows the hierarchy order.
+	 */
+	void TransformHierarchy::Update(ComponentPool<TransformComponent>& p_Transforms)
+	{
+		VT_PROFILE_FUNCTION();
+
+		Sort();
+
+		// Nothing marked, nothing can have moved.
+		m_UpdatedIndices.clear();
+		if (!m_AnyDirty.exchange(false, std::memory_order_relaxed))
+			return;
+
+		const EntityID* entities = GetEntities();
+		const EntityID* transformEntities = p_Transforms.GetEntities();
+		const TransformComponent* transforms = p_Transforms.GetComponents();
+		uint32_t transformCount = p_Transforms.GetSize();
+
+		for (uint32_t i = 0; i < GetSize(); i++)
+		{
+			// Parents come first, so their Changed is already this Update's.
+			Node& node = m_Nodes[i];
+			node.Changed = node.Dirty || (node.ParentIndex != NullIndex && m_Nodes[node.ParentIndex].Changed);
+			if (!node.Changed)
+				continue;
+
+			node.Dirty = false;
+
+			const TransformComponent& local = i < transformCount && transformEntities[i] == entities[i] ? transforms[i] : p_Transforms.Get(entities[i]);
+			glm::mat4 matrix = ComposeMatrix(local);
+			m_WorldMatrices[i] = node.ParentIndex != NullIndex ? m_WorldMatrices[node.ParentIndex] * matrix : matrix;
+			m_UpdatedIndices.push_back(i);
+		}
+	}
+
+	/**
+	 * @brief Gets the parent of an entity.
+	 * @param p_Entity The entity, in the hierarchy.
+	 * @returns The parent, or NullEntity for a root.
+	 */
+	EntityID TransformHierarchy::GetParent(EntityID p_Entity) const
+	{
+		VT_CORE_ASSERT(Contains(p_Entity), "Entity Is Not In The Hierarchy!");
+		return m_Nodes[IndexOf(p_Entity)].Parent;
+	}
+
+	/**
+	 * @brief Reorders the nodes by depth, keeping the order within
+	 * a depth, and resolves the parent indices.
+	 */
+	void TransformHierarchy::SortByDepth()
+	{
+		VT_PROFILE_FUNCTION();
+
+		uint32_t count = GetSize();
+
+		// Walk up to the first ancestor with a known depth, then fill in the path.
+		m_Depths.assign(count, NullIndex);
+		uint32_t maxDepth = 0;
+		for (uint32_t i = 0; i < count; i++)
+		{
+			m_Order.clear();
+			uint32_t index = i;
+			while (m_Depths[index] == NullIndex)
+			{
+				m_Order.push_back(index);
+				if (m_Nodes[index].Parent == NullEntity)
+					break;
+				index = IndexOf(m_Nodes[index].Parent);
+			}
+
+			uint32_t depth = m_Depths[index] != NullIndex ? m_Depths[index] + 1 : 0;
+			for (auto it = m_Order.rbegin(); it != m_Order.rend(); ++it)
+				m_Depths[*it] = depth++;
+			maxDepth = std::max(maxDepth, m_Depths[i]);
+		}
+
+		// Counting sort, m_Order[position] is the index the node had.
+		std::vector<uint32_t> offsets(maxDepth + 2, 0);
+		for (uint32_t i = 0; i < count; i++)
+			offsets[m_Depths[i] + 1]++;
+		for (uint32_t depth = 1; depth < offsets.size(); depth++)
+			offsets[depth] += offsets[depth - 1];
+
+		m_Order.resize(count);
+		for (uint32_t i = 0; i < count; i++)
+			m_Order[offsets[m_Depths[i]]++] = i;
+
+		// Move the nodes into place with swaps, so the entities move with them.
+		m_Positions.resize(count);
+		m_Occupants.resize(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			m_Positions[i] = i;
+			m_Occupants[i] = i;
+		}
+
+		for (uint32_t position = 0; position < count; position++)
+		{
+			uint32_t from = m_Positions[m_Order[position]];
+			if (from == position)
+				continue;
+
+			SwapEntities(position, from);
+			std::swap(m_Nodes[position], m_Nodes[from]);
+			std::swap(m_WorldMatrices[position], m_WorldMatrices[from]);
+
+			uint32_t displaced = m_Occupants[position];
+			m_Occupants[position] = m_Order[position];
+			m_Occupants[from] = displaced;
+			m_Positions[m_Order[position]] = position;
+			m_Positions[displaced] = from;
+		}
+
+		for (Node& node : m_Nodes)
+			node.ParentIndex = node.Parent != NullEntity ? IndexOf(node.Parent) : NullIndex;
+
+		m_NeedsSort = false;
+	}
+
+	/**
+	 * @brief Builds translate * rotate * scale without multiplying
+	 * matrices.
+	 * @param p_Transform The local transform.
+	 * @returns The matrix.
+	 */
+	glm::mat4 TransformHierarchy::ComposeMatrix(const TransformComponent& p_Transform)
+	{
+		float cosine = 1.0f, sine = 0.0f;
+		if (p_Transform.Rotation != 0.0f)
+		{
+			float radians = glm::radians(p_Transform.Rotation);
+			cosine = cosf(radians);
+			sine = sinf(radians);
+		}
+
+		glm::mat4 matrix(1.0f);
+		matrix[0] = { cosine * p_Transform.Scale.x, sine * p_Transform.Scale.x, 0.0f, 0.0f };
+		matrix[1] = { -sine * p_Transform.Scale.y, cosine * p_Transform.Scale.y, 0.0f, 0.0f };
+		matrix[3] = { p_Transform.Translation, 1.0f };
+		return matrix;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+/////////////////
+///
+/// TransformHierarchy.h
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Parents entities to each other and caches the
+/// world matrix of every transform. Nodes are kept
+/// in a flat array sorted by depth, so one pass
+/// updates parents before their children and only
+/// recomputes the matrices that changed.
+///
+/////////////////
+
+#ifndef __VIOLET_ENGINE_SCENE_TRANSFORM_HIERARCHY_H_INCLUDED__
+#define __VIOLET_ENGINE_SCENE_TRANSFORM_HIERARCHY_H_INCLUDED__
+
+#include <atomic>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Violet/Scene/Components.h"
+#include "Violet/Scene/Registry.h"
+
+namespace Violet
+{
+	/**
+	 * @brief The set of entities with a transform, in depth order.
+	 * The local transforms stay in the TransformComponent pool and
+	 * are only read again once their entity is marked dirty, so
+	 * editing a component must be followed by MarkDirty.
+	 */
+	class TransformHierarchy : public SparseSet
+	{
+	public: // Main Functionality
+		void Add(EntityID p_Entity);
+		virtual void Remove(EntityID p_Entity) override;
+
+		void SetParent(EntityID p_Child, EntityID p_Parent);
+		void MarkDirty(EntityID p_Entity);
+
+		void Sort();
+		void Update(ComponentPool<TransformComponent>& p_Transforms);
+	public: // Getters
+		EntityID GetParent(EntityID p_Entity) const;
+
+		/**
+		 * @brief Gets the world matrix of an entity as of the last
+		 * Update.
+		 * @param p_Entity The entity, in the hierarchy.
+		 * @returns The world matrix.
+		 */
+		const glm::mat4& GetWorldMatrix(EntityID p_Entity) const
+		{
+			VT_CORE_ASSERT(Contains(p_Entity), "Entity Is Not In The Hierarchy!");
+			return m_WorldMatrices[IndexOf(p_Entity)];
+		}
+
+		/**
+		 * @brief Gets the world matrices in the order of the entities.
+		 * @returns The world matrices.
+		 */
+		const glm::mat4* GetWorldMatrices() const { return m_WorldMatrices.data(); }
+
+		/**
+		 * @brief Gets where the world matrices the last Update rebuilt
+		 * are, for systems following transform changes.
+		 * @returns The indices, in the order of the entities.
+		 */
+		const std::vector<uint32_t>& GetUpdatedIndices() const { return m_UpdatedIndices; }
+		uint32_t GetUpdatedCount() const { return (uint32_t)m_UpdatedIndices.size(); }
+	private: // Helpers
+		void SortByDepth();
+
+		static glm::mat4 ComposeMatrix(const TransformComponent& p_Transform);
+	private: // Private Structures
+		struct Node
+		{
+			EntityID Parent = NullEntity;
+			uint32_t ParentIndex = NullIndex; // Valid once sorted.
+			uint32_t ChildCount = 0;
+			bool Dirty = true;                // The local transform or parent changed.
+			bool Changed = false;             // Rebuilt by the running Update.
+		};
+	private: // Private Member Variables
+		std::vector<Node> m_Nodes;
+		std::vector<glm::mat4> m_WorldMatrices;
+		bool m_NeedsSort = false;
+		std::vector<uint32_t> m_UpdatedIndices;
+
+		// Set by MarkDirty from any thread, lets Update skip a still hierarchy.
+		std::atomic<bool> m_AnyDirty = false;
+
+		// Scratch space of SortByDepth.
+		std::vector<uint32_t> m_Depths;
+		std::vector<uint32_t> m_Order;
+		std::vector<uint32_t> m_Positions;
+		std::vector<uint32_t> m_Occupants;
+	};
+}
+
+#endif // __VIOLET_ENGINE_SCENE_TRANSFORM_HIERARCHY_H_INCLUDED__
\ No newline at end of file
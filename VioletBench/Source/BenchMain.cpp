@@ -0,0 +1,85 @@
+/////////////////
+///
+/// BenchMain.cpp
+/// Violet McAllister
+/// July 30th, 2022
+/// Updated: August 6th, 2022
+///
+/// Entry point of VioletBench, runs every
+/// benchmark in turn and writes the results.
+///
+/// Usage: VioletBench [--filter <suite>]
+///     [--repetitions <count>] [--warmup <count>]
+///     [--out <results.json|results.csv>]
+///
+/////////////////
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <Violet/Core/Log.h>
+
+#include "Benchmarks.h"
+#include "BenchRunner.h"
+
+/**
+ * @brief A named group of benchmarks.
+ */
+struct BenchSuite
+{
+	const char* Name;
+	void(*Run)();
+};
+
+static const BenchSuite s_Suites[] = {
+	{ "EventDispatch", RunEventDispatchBench },
+	{ "RefCount", RunRefCountBench },
+	{ "Renderer2D", RunRenderer2DBench },
+	{ "BufferLayout", RunBufferLayoutBench },
+	{ "Instrumentor", RunInstrumentorBench },
+	{ "OrthographicCamera", RunCameraBench },
+	{ "Scene", RunSceneBench },
+	{ "SoftwareRasterizer", RunSoftwareRasterizerBench }
+};
+
+int main(int argc, char** argv)
+{
+	Violet::Log::Init();
+
+	BenchSettings settings;
+	std::string filter;
+	std::string outputPath = "VioletBench-Results.json";
+	for (int i = 1; i < argc; i++)
+	{
+		bool hasValue = i + 1 < argc;
+		if (hasValue && strcmp(argv[i], "--filter") == 0)
+			filter = argv[++i];
+		else if (hasValue && strcmp(argv[i], "--repetitions") == 0)
+			settings.Repetitions = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+		else if (hasValue && strcmp(argv[i], "--warmup") == 0)
+			settings.WarmupRepetitions = (uint32_t)std::strtoul(argv[++i], nullptr, 10);
+		else if (hasValue && strcmp(argv[i], "--out") == 0)
+			outputPath = argv[++i];
+		else
+			VT_WARN("Unknown Argument '{0}'", argv[i]);
+	}
+
+	BenchRunner::Init(settings);
+	VT_INFO("VioletBench: {0} Warm-Up And {1} Measured Repetitions, Median Shown", BenchRunner::GetSettings().WarmupRepetitions, BenchRunner::GetSettings().Repetitions);
+
+	for (const BenchSuite& suite : s_Suites)
+	{
+		if (filter.empty() || filter == suite.Name)
+			suite.Run();
+	}
+
+	int result = 0;
+	if (BenchRunner::WriteResults(outputPath))
+		VT_INFO("Wrote {0} Results To '{1}'", BenchRunner::GetResults().size(), outputPath);
+	else
+		result = 1;
+
+	Violet::Log::Shutdown();
+	return result;
+}
\ No newline at end of file
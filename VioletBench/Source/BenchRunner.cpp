@@ -0,0 +1,195 @@
+/////////////////
+///
+/// BenchRunner.cpp
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Times benchmarks with warm-up and repeated
+/// samples, logs ns/op and items/s and writes
+/// every result to a JSON or CSV file for
+/// regression tracking.
+///
+/////////////////
+
+#include "BenchRunner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+#include <Violet/Core/Base.h>
+#include <Violet/Core/Log.h>
+#include <Violet/Debug/Instrumentor.h>
+
+// Written through by KeepValue, the compiler has to assume it is read.
+static const void* volatile s_KeptValue = nullptr;
+
+/**
+ * @brief Gets the configuration VioletBench was built in.
+ * @returns The name of the configuration.
+ */
+static const char* GetConfiguration()
+{
+#if defined(VT_DIST)
+	return "Dist";
+#elif defined(VT_RELEASE)
+	return "Release";
+#elif defined(VT_DEBUG)
+	return "Debug";
+#else
+	return "Unknown";
+#endif
+}
+
+/**
+ * @brief Writes a string as the inside of a JSON string.
+ * @param p_Out The stream to write to.
+ * @param p_String The string.
+ */
+static void WriteJsonString(std::ostream& p_Out, const std::string& p_String)
+{
+	for (char c : p_String)
+	{
+		if (c == '"' || c == '\\')
+			p_Out << '\\' << c;
+		else if ((unsigned char)c < 0x20)
+			p_Out << "\\u00" << "0123456789abcdef"[(c >> 4) & 0xf] << "0123456789abcdef"[c & 0xf];
+		else
+			p_Out << c;
+	}
+}
+
+/**
+ * @brief Writes a string as the inside of a quoted CSV field.
+ * @param p_Out The stream to write to.
+ * @param p_String The string.
+ */
+static void WriteCsvString(std::ostream& p_Out, const std::string& p_String)
+{
+	for (char c : p_String)
+	{
+		if (c == '"')
+			p_Out << '"';
+		p_Out << c;
+	}
+}
+
+/**
+ * @brief Sets how benchmarks are sampled.
+ * @param p_Settings The settings.
+ */
+void BenchRunner::Init(const BenchSettings& p_Settings)
+{
+	s_Settings = p_Settings;
+	s_Settings.Repetitions = std::max(s_Settings.Repetitions, 1u);
+	s_Results.clear();
+}
+
+/**
+ * @brief Writes every result so far. Files ending in .csv are
+ * written as CSV, anything else as JSON.
+ * @param p_Filepath The path to the results file.
+ * @returns Whether the file could be written.
+ */
+bool BenchRunner::WriteResults(const std::string& p_Filepath)
+{
+	std::ofstream out(p_Filepath);
+	if (!out)
+	{
+		VT_ERROR("Could Not Open Results File '{0}'", p_Filepath);
+		return false;
+	}
+
+	out << std::setprecision(4) << std::fixed;
+
+	bool csv = p_Filepath.size() >= 4 && p_Filepath.compare(p_Filepath.size() - 4, 4, ".csv") == 0;
+	if (csv)
+	{
+		out << "name,operations,items_per_op,repetitions,median_ns,mean_ns,min_ns,max_ns,stddev_ns,items_per_sec\n";
+		for (const BenchResult& result : s_Results)
+		{
+			out << '"';
+			WriteCsvString(out, result.Name);
+			out << "\"," << result.Operations << ',' << result.ItemsPerOperation << ',' << result.Repetitions << ','
+				<< result.MedianTime << ',' << result.MeanTime << ',' << result.MinTime << ',' << result.MaxTime << ','
+				<< result.StandardDeviation << ',' << result.GetItemsPerSecond() << '\n';
+		}
+		return true;
+	}
+
+	out << "{\"configuration\":\"" << GetConfiguration() << "\",";
+	out << "\"profile_level\":" << VT_PROFILE_LEVEL << ',';
+	out << "\"warmup_repetitions\":" << s_Settings.WarmupRepetitions << ',';
+	out << "\"repetitions\":" << s_Settings.Repetitions << ',';
+	out << "\"benchmarks\":[";
+	for (const BenchResult& result : s_Results)
+	{
+		if (&result != &s_Results.front())
+			out << ',';
+		out << "{\"name\":\"";
+		WriteJsonString(out, result.Name);
+		out << "\",";
+		out << "\"operations\":" << result.Operations << ',';
+		out << "\"items_per_op\":" << result.ItemsPerOperation << ',';
+		out << "\"median_ns\":" << result.MedianTime << ',';
+		out << "\"mean_ns\":" << result.MeanTime << ',';
+		out << "\"min_ns\":" << result.MinTime << ',';
+		out << "\"max_ns\":" << result.MaxTime << ',';
+		out << "\"stddev_ns\":" << result.StandardDeviation << ',';
+		out << "\"items_per_sec\":" << result.GetItemsPerSecond() << '}';
+	}
+	out << "]}";
+	return true;
+}
+
+/**
+ * @brief Keeps the compiler from optimizing away the work
+ * producing a value.
+ * @param p_Value The value.
+ */
+void BenchRunner::KeepValue(const void* p_Value)
+{
+	s_KeptValue = p_Value;
+}
+
+/**
+ * @brief Reduces the samples of a benchmark to its result and
+ * logs it.
+ * @param p_Name The name of the benchmark.
+ * @param p_Operations The operations per repetition.
+ * @param p_ItemsPerOperation The items processed per operation.
+ * @param p_Samples The nanoseconds per operation of every repetition.
+ * @returns The result of the benchmark.
+ */
+BenchResult BenchRunner::Record(const char* p_Name, uint64_t p_Operations, uint64_t p_ItemsPerOperation, std::vector<double>& p_Samples)
+{
+	std::sort(p_Samples.begin(), p_Samples.end());
+
+	BenchResult result;
+	result.Name = p_Name;
+	result.Operations = p_Operations;
+	result.ItemsPerOperation = p_ItemsPerOperation;
+	result.Repetitions = (uint32_t)p_Samples.size();
+
+	size_t middle = p_Samples.size() / 2;
+	result.MedianTime = p_Samples.size() % 2 ? p_Samples[middle] : (p_Samples[middle - 1] + p_Samples[middle]) * 0.5;
+	result.MinTime = p_Samples.front();
+	result.MaxTime = p_Samples.back();
+
+	double sum = 0.0;
+	for (double sample : p_Samples)
+		sum += sample;
+	result.MeanTime = sum / p_Samples.size();
+
+	double variance = 0.0;
+	for (double sample : p_Samples)
+		variance += (sample - result.MeanTime) * (sample - result.MeanTime);
+	result.StandardDeviation = p_Samples.size() > 1 ? std::sqrt(variance / (p_Samples.size() - 1)) : 0.0;
+
+	double spread = result.MeanTime > 0.0 ? 100.0 * result.StandardDeviation / result.MeanTime : 0.0;
+	VT_INFO("  {0:<48} {1:>12.2f} ns/op {2:>10.2f}M items/s (+/- {3:.1f}%)", result.Name, result.MedianTime, result.GetItemsPerSecond() / 1e6, spread);
+
+	s_Results.push_back(result);
+	return result;
+}
\ No newline at end of file
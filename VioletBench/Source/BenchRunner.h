@@ -0,0 +1,103 @@
+/////////////////
+///
+/// BenchRunner.h
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Times benchmarks with warm-up and repeated
+/// samples, logs ns/op and items/s and writes
+/// every result to a JSON or CSV file for
+/// regression tracking.
+///
+/////////////////
+
+#ifndef __VIOLET_BENCH_BENCH_RUNNER_H_INCLUDED__
+#define __VIOLET_BENCH_BENCH_RUNNER_H_INCLUDED__
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief How every benchmark is sampled.
+ */
+struct BenchSettings
+{
+	uint32_t WarmupRepetitions = 2;
+	uint32_t Repetitions = 10;
+};
+
+/**
+ * @brief The statistics of one benchmark. Times are nanoseconds
+ * per operation, taken over the repetitions.
+ */
+struct BenchResult
+{
+	std::string Name;
+	uint64_t Operations = 0;        // Operations per repetition.
+	uint64_t ItemsPerOperation = 0; // Quads per scene, events per dispatch...
+	uint32_t Repetitions = 0;
+
+	double MedianTime = 0.0;
+	double MeanTime = 0.0;
+	double MinTime = 0.0;
+	double MaxTime = 0.0;
+	double StandardDeviation = 0.0;
+
+	/**
+	 * @brief Gets the throughput at the median time.
+	 * @returns The items per second.
+	 */
+	double GetItemsPerSecond() const { return MedianTime > 0.0 ? ItemsPerOperation * 1e9 / MedianTime : 0.0; }
+};
+
+/**
+ * @brief Runs benchmarks and keeps their results.
+ */
+class BenchRunner
+{
+public: // Initializer
+	static void Init(const BenchSettings& p_Settings);
+public: // Main Functionality
+	/**
+	 * @brief Runs a benchmark. The function performs all the
+	 * operations of one repetition and is called for every
+	 * warm-up and measured repetition.
+	 * @param p_Name The name of the benchmark, "Suite/Case".
+	 * @param p_Operations The operations per repetition.
+	 * @param p_ItemsPerOperation The items processed per operation.
+	 * @param p_Function The repetition.
+	 * @returns The result of the benchmark.
+	 */
+	template<typename F>
+	static BenchResult Run(const char* p_Name, uint64_t p_Operations, uint64_t p_ItemsPerOperation, const F& p_Function)
+	{
+		for (uint32_t i = 0; i < s_Settings.WarmupRepetitions; i++)
+			p_Function();
+
+		std::vector<double> samples(s_Settings.Repetitions);
+		for (double& sample : samples)
+		{
+			auto start = std::chrono::steady_clock::now();
+			p_Function();
+			auto end = std::chrono::steady_clock::now();
+			sample = std::chrono::duration<double, std::nano>(end - start).count() / p_Operations;
+		}
+
+		return Record(p_Name, p_Operations, p_ItemsPerOperation, samples);
+	}
+
+	static bool WriteResults(const std::string& p_Filepath);
+	static void KeepValue(const void* p_Value);
+public: // Getters
+	static const BenchSettings& GetSettings() { return s_Settings; }
+	static const std::vector<BenchResult>& GetResults() { return s_Results; }
+private: // Helpers
+	static BenchResult Record(const char* p_Name, uint64_t p_Operations, uint64_t p_ItemsPerOperation, std::vector<double>& p_Samples);
+private: // Private Static Member Variables
+	inline static BenchSettings s_Settings;
+	inline static std::vector<BenchResult> s_Results;
+};
+
+#endif // __VIOLET_BENCH_BENCH_RUNNER_H_INCLUDED__
\ No newline at end of file
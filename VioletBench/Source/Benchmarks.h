@@ -0,0 +1,24 @@
+/////////////////
+///
+/// Benchmarks.h
+/// Violet McAllister
+/// July 30th, 2022
+/// Updated: August 6th, 2022
+///
+/// Declares the benchmarks run by VioletBench.
+///
+/////////////////
+
+#ifndef __VIOLET_BENCH_BENCHMARKS_H_INCLUDED__
+#define __VIOLET_BENCH_BENCHMARKS_H_INCLUDED__
+
+void RunEventDispatchBench();
+void RunRefCountBench();
+void RunRenderer2DBench();
+void RunBufferLayoutBench();
+void RunInstrumentorBench();
+void RunCameraBench();
+void RunSceneBench();
+void RunSoftwareRasterizerBench();
+
+#endif // __VIOLET_BENCH_BENCHMARKS_H_INCLUDED__
\ No newline at end of file
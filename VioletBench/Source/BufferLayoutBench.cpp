@@ -0,0 +1,60 @@
+/////////////////
+///
+/// BufferLayoutBench.cpp
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Measures building BufferLayouts, which copies
+/// every element and its name and calculates
+/// the offsets and the stride.
+///
+/////////////////
+
+#include <Violet/Core/Base.h>
+#include <Violet/Core/Log.h>
+#include <Violet/Renderer/Buffer.h>
+
+#include "Benchmarks.h"
+#include "BenchRunner.h"
+
+static constexpr uint32_t s_Iterations = 200000;
+
+void RunBufferLayoutBench()
+{
+	VT_INFO("BufferLayout Construction, {0} Layouts:", s_Iterations);
+
+	// The layout of Renderer2D quads.
+	BenchRunner::Run("BufferLayout/Quad, 5 Elements", s_Iterations, 5, []()
+	{
+		for (uint32_t i = 0; i < s_Iterations; i++)
+		{
+			Violet::BufferLayout layout = {
+				{ Violet::ShaderDataType::Float3, "a_Position" },
+				{ Violet::ShaderDataType::Float4, "a_Color" },
+				{ Violet::ShaderDataType::Float2, "a_TexCoord" },
+				{ Violet::ShaderDataType::Float, "a_TexIndex" },
+				{ Violet::ShaderDataType::Float, "a_TilingFactor" }
+			};
+			BenchRunner::KeepValue(&layout);
+		}
+	});
+
+	// Instanced data, names too long to be stored inline.
+	BenchRunner::Run("BufferLayout/Instanced, 8 Elements", s_Iterations, 8, []()
+	{
+		for (uint32_t i = 0; i < s_Iterations; i++)
+		{
+			Violet::BufferLayout layout = {
+				{ Violet::ShaderDataType::Float3, "a_Position" },
+				{ Violet::ShaderDataType::Float3, "a_Normal" },
+				{ Violet::ShaderDataType::Float2, "a_TexCoord" },
+				{ Violet::ShaderDataType::Mat4, "a_InstanceTransform" },
+				{ Violet::ShaderDataType::Float4, "a_InstanceColor" },
+				{ Violet::ShaderDataType::Int, "a_InstanceEntityID" },
+				{ Violet::ShaderDataType::Float, "a_InstanceTilingFactor" },
+				{ Violet::ShaderDataType::Bool, "a_InstanceVisible" }
+			};
+			BenchRunner::KeepValue(&layout);
+		}
+	});
+}
\ No newline at end of file
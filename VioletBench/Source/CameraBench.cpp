@@ -0,0 +1,52 @@
+/////////////////
+///
+/// CameraBench.cpp
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Measures recalculating the matrices of an
+/// OrthographicCamera when it moves, rotates
+/// or changes its projection.
+///
+/////////////////
+
+#include <Violet/Core/Base.h>
+#include <Violet/Core/Log.h>
+#include <Violet/Renderer/OrthographicCamera.h>
+
+#include "Benchmarks.h"
+#include "BenchRunner.h"
+
+static constexpr uint32_t s_Iterations = 1000000;
+
+void RunCameraBench()
+{
+	Violet::OrthographicCamera camera(-1.6f, 1.6f, -0.9f, 0.9f);
+
+	VT_INFO("OrthographicCamera Recalculation, {0} Updates:", s_Iterations);
+
+	BenchRunner::Run("OrthographicCamera/SetPosition", s_Iterations, 1, [&]()
+	{
+		for (uint32_t i = 0; i < s_Iterations; i++)
+			camera.SetPosition({ (float)(i % 100) * 0.01f, (float)(i % 37) * 0.02f, 0.0f });
+		BenchRunner::KeepValue(&camera.GetViewProjectionMatrix());
+	});
+
+	BenchRunner::Run("OrthographicCamera/SetRotation", s_Iterations, 1, [&]()
+	{
+		for (uint32_t i = 0; i < s_Iterations; i++)
+			camera.SetRotation((float)(i % 360));
+		BenchRunner::KeepValue(&camera.GetViewProjectionMatrix());
+	});
+
+	// Zooming, as the camera controller does on every scroll.
+	BenchRunner::Run("OrthographicCamera/SetProjection", s_Iterations, 1, [&]()
+	{
+		for (uint32_t i = 0; i < s_Iterations; i++)
+		{
+			float zoom = 1.0f + (float)(i % 64) * 0.1f;
+			camera.SetProjection(-1.6f * zoom, 1.6f * zoom, -0.9f * zoom, 0.9f * zoom);
+		}
+		BenchRunner::KeepValue(&camera.GetViewProjectionMatrix());
+	});
+}
\ No newline at end of file
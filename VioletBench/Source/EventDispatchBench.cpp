@@ -0,0 +1,168 @@
+/////////////////
+///
+/// EventDispatchBench.cpp
+/// Violet McAllister
+/// July 24th, 2022
+/// Updated: August 6th, 2022
+///
+/// Measures events per second through a 20 layer
+/// LayerStack, comparing the std::bind/std::function
+/// path against member pointer dispatch with layers
+/// registered for event categories.
+///
+/////////////////
+
+#include <functional>
+
+#include <Violet/Core/Base.h>
+#include <Violet/Core/LayerStack.h>
+#include <Violet/Core/Log.h>
+#include <Violet/Events/ApplicationEvent.h>
+#include <Violet/Events/EventCallback.h>
+#include <Violet/Events/KeyEvent.h>
+#include <Violet/Events/MouseEvent.h>
+
+#include "Benchmarks.h"
+#include "BenchRunner.h"
+
+/**
+ * @brief A layer handling keys, mouse movement and resizing
+ * through member pointer dispatch.
+ */
+class DispatchLayer : public Violet::Layer
+{
+public:
+	DispatchLayer(int p_Categories)
+		: Layer("DispatchLayer")
+	{
+		SetEventCategories(p_Categories);
+	}
+
+	void OnEvent(Violet::Event& p_Event) override
+	{
+		Violet::EventDispatcher dispatcher(p_Event);
+		dispatcher.Dispatch<&DispatchLayer::OnKeyPressed>(this);
+		dispatcher.Dispatch<&DispatchLayer::OnMouseMoved>(this);
+		dispatcher.Dispatch<&DispatchLayer::OnWindowResize>(this);
+	}
+
+	uint64_t GetHandledCount() const { return m_HandledCount; }
+private:
+	bool OnKeyPressed(Violet::KeyPressedEvent& p_Event) { m_HandledCount++; return false; }
+	bool OnMouseMoved(Violet::MouseMovedEvent& p_Event) { m_HandledCount++; return false; }
+	bool OnWindowResize(Violet::WindowResizeEvent& p_Event) { m_HandledCount++; return false; }
+private:
+	uint64_t m_HandledCount = 0;
+};
+
+/**
+ * @brief The same layer handling events the way the engine
+ * used to, through std::bind with every layer receiving
+ * every event.
+ */
+class BindLayer : public Violet::Layer
+{
+public:
+	BindLayer()
+		: Layer("BindLayer") { }
+
+	void OnEvent(Violet::Event& p_Event) override
+	{
+		Violet::EventDispatcher dispatcher(p_Event);
+		dispatcher.Dispatch<Violet::KeyPressedEvent>(std::bind(&BindLayer::OnKeyPressed, this, std::placeholders::_1));
+		dispatcher.Dispatch<Violet::MouseMovedEvent>(std::bind(&BindLayer::OnMouseMoved, this, std::placeholders::_1));
+		dispatcher.Dispatch<Violet::WindowResizeEvent>(std::bind(&BindLayer::OnWindowResize, this, std::placeholders::_1));
+	}
+
+	uint64_t GetHandledCount() const { return m_HandledCount; }
+private:
+	bool OnKeyPressed(Violet::KeyPressedEvent& p_Event) { m_HandledCount++; return false; }
+	bool OnMouseMoved(Violet::MouseMovedEvent& p_Event) { m_HandledCount++; return false; }
+	bool OnWindowResize(Violet::WindowResizeEvent& p_Event) { m_HandledCount++; return false; }
+private:
+	uint64_t m_HandledCount = 0;
+};
+
+/**
+ * @brief Owns a LayerStack and stands in for the Application
+ * as the window event callback.
+ */
+struct BenchStack
+{
+	Violet::LayerStack Layers;
+	uint64_t Received = 0;
+
+	void OnEvent(Violet::Event& p_Event)
+	{
+		Received++;
+		Layers.OnEvent(p_Event);
+	}
+};
+
+static constexpr uint32_t s_LayerCount = 20;
+static constexpr uint32_t s_Iterations = 500000;
+
+/**
+ * @brief Sends a mix of events through a callback.
+ * @param p_Name The name of the benchmark.
+ * @param p_Callback The window event callback.
+ * @returns The result of the benchmark.
+ */
+template<typename F>
+static BenchResult Run(const char* p_Name, const F& p_Callback)
+{
+	Violet::KeyPressedEvent keyPressed(Violet::Key::A, 0);
+	Violet::MouseMovedEvent mouseMoved(640.0f, 360.0f);
+	Violet::MouseScrolledEvent mouseScrolled(0.0f, 1.0f);
+	Violet::WindowResizeEvent windowResize(1280, 720);
+	Violet::Event* events[] = { &mouseMoved, &mouseMoved, &keyPressed, &mouseScrolled, &mouseMoved, &windowResize };
+	constexpr uint32_t eventCount = sizeof(events) / sizeof(events[0]);
+
+	return BenchRunner::Run(p_Name, s_Iterations, 1, [&]()
+	{
+		for (uint32_t i = 0; i < s_Iterations; i++)
+		{
+			Violet::Event& event = *events[i % eventCount];
+			event.Handled = false;
+			p_Callback(event);
+		}
+	});
+}
+
+void RunEventDispatchBench()
+{
+	// Every layer sees every event, as before.
+	BenchStack bindStack;
+	for (uint32_t i = 0; i < s_LayerCount; i++)
+		bindStack.Layers.PushLayer(new BindLayer());
+
+	// Most layers only care about one kind of input.
+	BenchStack dispatchStack;
+	for (uint32_t i = 0; i < s_LayerCount; i++)
+	{
+		int categories = Violet::EventCategoryAll;
+		if (i % 4 == 1)
+			categories = Violet::EventCategoryKeyboard;
+		else if (i % 4 == 2)
+			categories = Violet::EventCategoryMouse;
+		else if (i % 4 == 3)
+			categories = Violet::EventCategoryApplication;
+		dispatchStack.Layers.PushLayer(new DispatchLayer(categories));
+	}
+
+	std::function<void(Violet::Event&)> bindCallback = std::bind(&BenchStack::OnEvent, &bindStack, std::placeholders::_1);
+	Violet::EventCallback dispatchCallback = Violet::EventCallback::Bind<&BenchStack::OnEvent>(&dispatchStack);
+
+	VT_INFO("Event Dispatch Through {0} Layers, {1} Events:", s_LayerCount, s_Iterations);
+	BenchResult bindResult = Run("EventDispatch/std::bind & std::function", bindCallback);
+	BenchResult dispatchResult = Run("EventDispatch/Member Pointer & Categories", dispatchCallback);
+
+	uint64_t bindHandled = 0, dispatchHandled = 0;
+	for (Violet::Layer* layer : bindStack.Layers)
+		bindHandled += static_cast<BindLayer*>(layer)->GetHandledCount();
+	for (Violet::Layer* layer : dispatchStack.Layers)
+		dispatchHandled += static_cast<DispatchLayer*>(layer)->GetHandledCount();
+
+	VT_INFO("  Handled: {0} through std::bind, {1} through member pointers", bindHandled, dispatchHandled);
+	VT_INFO("  Speedup: {0:.2f}x", bindResult.MedianTime / dispatchResult.MedianTime);
+}
\ No newline at end of file
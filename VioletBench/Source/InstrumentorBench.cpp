@@ -0,0 +1,55 @@
+/////////////////
+///
+/// InstrumentorBench.cpp
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Measures the cost of a profile scope with
+/// nothing capturing and with each in-memory
+/// sink capturing.
+///
+/////////////////
+
+#include <Violet/Core/Base.h>
+#include <Violet/Core/Log.h>
+#include <Violet/Debug/Instrumentor.h>
+
+#include "Benchmarks.h"
+#include "BenchRunner.h"
+
+static constexpr uint32_t s_Iterations = 1000000;
+
+/**
+ * @brief Opens and closes profile scopes. The timer is used
+ * directly so the scopes are measured whatever
+ * VT_PROFILE_LEVEL VioletBench is built with.
+ * @param p_Frame Ends a frame once the scopes are closed.
+ */
+static void OpenScopes(bool p_Frame)
+{
+	for (uint32_t i = 0; i < s_Iterations; i++)
+	{
+		Violet::InstrumentationTimer timer("InstrumentorBench Scope");
+	}
+
+	if (p_Frame)
+		Violet::InstrumentationTimer timer("InstrumentorBench Frame", true);
+}
+
+void RunInstrumentorBench()
+{
+	VT_INFO("Instrumentor Scope Overhead, {0} Scopes:", s_Iterations);
+
+	BenchRunner::Run("Instrumentor/Scope, Nothing Capturing", s_Iterations, 1, []() { OpenScopes(false); });
+
+	Violet::FlightRecorderSettings settings;
+	settings.ThresholdMilliseconds = 1e9f; // Never dump a record.
+	Violet::FlightRecorder::Get().Enable(settings);
+	BenchRunner::Run("Instrumentor/Scope, Flight Recorder", s_Iterations, 1, []() { OpenScopes(true); });
+	Violet::FlightRecorder::Get().Disable();
+
+	Violet::FrameProfiler::Get().Enable();
+	BenchRunner::Run("Instrumentor/Scope, Frame Profiler", s_Iterations, 1, []() { OpenScopes(true); });
+	Violet::FrameProfiler::Get().Disable();
+	Violet::FrameProfiler::Get().Reset();
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+/////////////////
+///
+/// RefCountBench.cpp
+/// Violet McAllister
+/// July 30th, 2022
+/// Updated: August 6th, 2022
+///
+/// Measures the texture-slot assignment path of
+/// Renderer2D with std::shared_ptr compared to the
+/// intrusive Ref in both counting modes.
+///
+/////////////////
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <Violet/Core/Base.h>
+#include <Violet/Core/Log.h>
+
+#include "Benchmarks.h"
+#include "BenchRunner.h"
+
+/**
+ * @brief Stands in for a texture, compared by renderer ID
+ * through a virtual operator like Texture2D.
+ */
+template<typename Base>
+class BenchTexture : public Base
+{
+public:
+	BenchTexture(uint32_t p_RendererID)
+		: m_RendererID(p_RendererID) { }
+	virtual ~BenchTexture() = default;
+
+	virtual bool operator==(const BenchTexture& p_Other) const { return m_RendererID == p_Other.m_RendererID; }
+private:
+	uint32_t m_RendererID;
+};
+
+struct NoRefCount { };
+
+using SharedTexture = BenchTexture<NoRefCount>;
+using AtomicTexture = BenchTexture<Violet::RefCounted>;
+using SingleThreadTexture = BenchTexture<Violet::SingleThreadRefCounted>;
+
+static constexpr uint32_t s_MaxTextureSlots = 32;
+static constexpr uint32_t s_TextureCount = 48;
+static constexpr uint32_t s_QuadsPerBatch = 2000;
+static constexpr uint32_t s_Batches = 5000;
+
+/**
+ * @brief The slot lookup of Renderer2D::DrawQuad, the texture
+ * reference is only copied when it takes a new slot.
+ */
+template<typename Pointer>
+struct SlotBatch
+{
+	std::array<Pointer, s_MaxTextureSlots> TextureSlots;
+	uint32_t TextureSlotIndex = 1;
+	uint64_t Flushes = 0;
+
+	float AssignSlot(const Pointer& p_Texture)
+	{
+		for (uint32_t i = 1; i < TextureSlotIndex; i++)
+		{
+			if (*TextureSlots[i].get() == *p_Texture.get())
+				return (float)i;
+		}
+
+		if (TextureSlotIndex >= s_MaxTextureSlots)
+		{
+			TextureSlotIndex = 1;
+			Flushes++;
+		}
+
+		TextureSlots[TextureSlotIndex] = p_Texture;
+		return (float)TextureSlotIndex++;
+	}
+};
+
+/**
+ * @brief Draws batches of quads spread over more textures than
+ * there are slots, with the texture passed by value the way
+ * client code often holds a copy.
+ * @param p_Name The name of the benchmark.
+ * @param p_Textures The textures.
+ * @param p_Sink Accumulates the slots so the work is kept.
+ * @returns The result of the benchmark, per quad.
+ */
+template<typename Pointer>
+static BenchResult Run(const char* p_Name, const std::vector<Pointer>& p_Textures, double& p_Sink)
+{
+	SlotBatch<Pointer> batch;
+	batch.TextureSlots[0] = p_Textures[0];
+
+	return BenchRunner::Run(p_Name, (uint64_t)s_Batches * s_QuadsPerBatch, 1, [&]()
+	{
+		for (uint32_t b = 0; b < s_Batches; b++)
+		{
+			batch.TextureSlotIndex = 1;
+			for (uint32_t q = 0; q < s_QuadsPerBatch; q++)
+			{
+				Pointer texture = p_Textures[(q * 7 + b) % s_TextureCount];
+				p_Sink += batch.AssignSlot(texture);
+			}
+		}
+	});
+}
+
+void RunRefCountBench()
+{
+	// The standard library skips atomics for std::shared_ptr until a
+	// second thread exists. The engine always runs job workers.
+	std::thread([]() { }).join();
+
+	std::vector<std::shared_ptr<SharedTexture>> shared;
+	std::vector<Violet::Ref<AtomicTexture>> atomic;
+	std::vector<Violet::Ref<SingleThreadTexture>> singleThread;
+	for (uint32_t i = 0; i < s_TextureCount; i++)
+	{
+		shared.push_back(std::make_shared<SharedTexture>(i + 1));
+		atomic.push_back(Violet::CreateRef<AtomicTexture>(i + 1));
+		singleThread.push_back(Violet::CreateRef<SingleThreadTexture>(i + 1));
+	}
+
+	double sink = 0.0;
+	VT_INFO("Texture Slot Assignment, {0} Textures Over {1} Slots, {2} Quads:", s_TextureCount, s_MaxTextureSlots, (uint64_t)s_Batches * s_QuadsPerBatch);
+	VT_INFO("  Pointer sizes: std::shared_ptr {0} bytes, Ref {1} bytes", sizeof(std::shared_ptr<SharedTexture>), sizeof(Violet::Ref<AtomicTexture>));
+	BenchResult sharedResult = Run("RefCount/std::shared_ptr", shared, sink);
+	BenchResult atomicResult = Run("RefCount/Ref, Atomic Count", atomic, sink);
+	BenchResult singleThreadResult = Run("RefCount/Ref, Single Thread", singleThread, sink);
+
+	VT_INFO("  Speedup: {0:.2f}x atomic, {1:.2f}x single thread", sharedResult.MedianTime / atomicResult.MedianTime, sharedResult.MedianTime / singleThreadResult.MedianTime);
+	VT_INFO("  Checksum: {0}", sink);
+}
\ No newline at end of file
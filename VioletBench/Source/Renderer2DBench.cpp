@@ -0,0 +1,114 @@
+/////////////////
+///
+/// Renderer2DBench.cpp
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Measures the CPU side of Renderer2D: building
+/// quad batches, assigning texture slots and
+/// flushing. Runs on the Null renderer so no
+/// driver time is included.
+///
+/////////////////
+
+#include <vector>
+
+#include <Violet/Core/Base.h>
+#include <Violet/Core/Log.h>
+#include <Violet/Renderer/Renderer.h>
+#include <Violet/Renderer/Renderer2D.h>
+
+#include "Benchmarks.h"
+#include "BenchRunner.h"
+
+static constexpr uint32_t s_QuadCount = 100000;
+static constexpr uint32_t s_GridWidth = 400;
+static constexpr uint32_t s_TextureCount = 48;
+
+/**
+ * @brief Draws one scene of quads laid out on a grid.
+ * @param p_Camera The camera of the scene.
+ * @param p_DrawQuad Draws the quad at a grid cell.
+ */
+template<typename F>
+static void DrawScene(const Violet::OrthographicCamera& p_Camera, const F& p_DrawQuad)
+{
+	Violet::Renderer2D::BeginScene(p_Camera);
+	for (uint32_t i = 0; i < s_QuadCount; i++)
+		p_DrawQuad(i, glm::vec2((float)(i % s_GridWidth), (float)(i / s_GridWidth)));
+	Violet::Renderer2D::EndScene();
+	Violet::Renderer2D::EndFrame();
+}
+
+/**
+ * @brief Runs one scene benchmark and logs the batches it took.
+ * @param p_Name The name of the benchmark.
+ * @param p_Camera The camera of the scene.
+ * @param p_DrawQuad Draws the quad at a grid cell.
+ */
+template<typename F>
+static void RunScene(const char* p_Name, const Violet::OrthographicCamera& p_Camera, const F& p_DrawQuad)
+{
+	BenchRunner::Run(p_Name, 1, s_QuadCount, [&]() { DrawScene(p_Camera, p_DrawQuad); });
+
+	Violet::Renderer2D::ResetStats();
+	DrawScene(p_Camera, p_DrawQuad);
+	Violet::Renderer2D::Statistics stats = Violet::Renderer2D::GetStats();
+	VT_INFO("    {0} draw calls, {1} textures bound, {2} KB uploaded per scene", stats.DrawCalls, stats.TexturesBound, stats.BytesUploaded / 1024);
+}
+
+void RunRenderer2DBench()
+{
+	// Buffers and textures only keep their data, the Null log does not record by default.
+	Violet::RendererAPI::SetAPI(Violet::RendererAPI::API::Null);
+	Violet::Renderer::Init();
+
+	std::vector<Violet::Ref<Violet::Texture2D>> textures;
+	for (uint32_t i = 0; i < s_TextureCount; i++)
+	{
+		uint32_t pixel = 0xff000000 | (i * 0x050a0f);
+		textures.push_back(Violet::Texture2D::Create(1, 1));
+		textures.back()->SetData(&pixel, sizeof(uint32_t));
+	}
+
+	Violet::OrthographicCamera camera(0.0f, (float)s_GridWidth, 0.0f, (float)(s_QuadCount / s_GridWidth));
+	glm::vec2 size = { 0.9f, 0.9f };
+	glm::vec4 color = { 0.8f, 0.2f, 0.3f, 1.0f };
+
+	VT_INFO("Renderer2D, {0} Quads Per Scene (Null Renderer):", s_QuadCount);
+
+	RunScene("Renderer2D/DrawQuad, Color", camera, [&](uint32_t p_Index, const glm::vec2& p_Position)
+	{
+		Violet::Renderer2D::DrawQuad(p_Position, size, color);
+	});
+
+	RunScene("Renderer2D/DrawRotatedQuad, Color", camera, [&](uint32_t p_Index, const glm::vec2& p_Position)
+	{
+		Violet::Renderer2D::DrawRotatedQuad(p_Position, size, (float)(p_Index % 360), color);
+	});
+
+	RunScene("Renderer2D/DrawQuad, 1 Texture", camera, [&](uint32_t p_Index, const glm::vec2& p_Position)
+	{
+		Violet::Renderer2D::DrawQuad(p_Position, size, textures[0]);
+	});
+
+	// Fills every slot, the quads after that keep finding their texture.
+	RunScene("Renderer2D/DrawQuad, 31 Textures", camera, [&](uint32_t p_Index, const glm::vec2& p_Position)
+	{
+		Violet::Renderer2D::DrawQuad(p_Position, size, textures[p_Index % 31]);
+	});
+
+	// More textures than slots, every batch ends when the slots run out.
+	RunScene("Renderer2D/DrawQuad, Texture Slot Churn", camera, [&](uint32_t p_Index, const glm::vec2& p_Position)
+	{
+		Violet::Renderer2D::DrawQuad(p_Position, size, textures[(p_Index * 7) % s_TextureCount]);
+	});
+
+	RunScene("Renderer2D/DrawRotatedQuad, Texture Slot Churn", camera, [&](uint32_t p_Index, const glm::vec2& p_Position)
+	{
+		Violet::Renderer2D::DrawRotatedQuad(p_Position, size, (float)(p_Index % 360), textures[(p_Index * 7) % s_TextureCount]);
+	});
+
+	textures.clear();
+	Violet::Renderer::Shutdown();
+}
\ No newline at end of file
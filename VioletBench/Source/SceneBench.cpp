@@ -0,0 +1,226 @@
+/////////////////
+///
+/// SceneBench.cpp
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Measures the Scene module: iterating component
+/// views, the transform hierarchy, culling and
+/// picking through the spatial index, the sprite
+/// renderer system and the Renderer2D paths fed
+/// with cached or uncached transforms.
+///
+/////////////////
+
+#include <vector>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <Violet/Core/Base.h>
+#include <Violet/Core/Log.h>
+#include <Violet/Renderer/Renderer.h>
+#include <Violet/Renderer/Renderer2D.h>
+#include <Violet/Scene/Components.h>
+#include <Violet/Scene/Entity.h>
+#include <Violet/Scene/Scene.h>
+
+#include "Benchmarks.h"
+#include "BenchRunner.h"
+
+static constexpr uint32_t s_EntityCount = 100000;
+static constexpr uint32_t s_GridWidth = 400;
+static constexpr uint32_t s_TextureCount = 8;
+
+struct VelocityComponent
+{
+	glm::vec2 Velocity;
+};
+
+void RunSceneBench()
+{
+	Violet::RendererAPI::SetAPI(Violet::RendererAPI::API::Null);
+	Violet::Renderer::Init();
+
+	std::vector<Violet::Ref<Violet::Texture2D>> textures;
+	for (uint32_t i = 0; i < s_TextureCount; i++)
+	{
+		uint32_t pixel = 0xff000000 | (i * 0x1f2f3f);
+		textures.push_back(Violet::Texture2D::Create(1, 1));
+		textures.back()->SetData(&pixel, sizeof(uint32_t));
+	}
+
+	Violet::OrthographicCamera camera(0.0f, (float)s_GridWidth, 0.0f, (float)(s_EntityCount / s_GridWidth));
+
+	{
+		Violet::Scene scene;
+		for (uint32_t i = 0; i < s_EntityCount; i++)
+		{
+			Violet::Entity entity = scene.CreateEntity();
+			Violet::TransformComponent& transform = entity.GetComponent<Violet::TransformComponent>();
+			transform.Translation = { (float)(i % s_GridWidth), (float)(i / s_GridWidth), 0.0f };
+			transform.Scale = { 0.9f, 0.9f };
+			transform.Rotation = (float)(i % 360);
+
+			// Every other entity moves, so the view has to skip the rest.
+			if (i % 2 == 0)
+				entity.AddComponent<VelocityComponent>(glm::vec2(0.001f, -0.001f));
+
+			Violet::SpriteRendererComponent& sprite = entity.AddComponent<Violet::SpriteRendererComponent>();
+			sprite.Color = { 0.8f, 0.2f, 0.3f, 1.0f };
+			if (i % 4 == 0)
+				sprite.Texture = textures[(i / 4) % s_TextureCount];
+		}
+
+		VT_INFO("Scene, {0} Entities (Null Renderer):", s_EntityCount);
+
+		Violet::Registry& registry = scene.GetRegistry();
+		BenchRunner::Run("Scene/View Each, Transform", 1, s_EntityCount, [&]()
+		{
+			registry.GetView<Violet::TransformComponent>().Each([](Violet::EntityID p_Entity, Violet::TransformComponent& p_Transform)
+			{
+				p_Transform.Rotation += 1.0f;
+			});
+		});
+
+		BenchRunner::Run("Scene/View Each, Transform + Velocity", 1, s_EntityCount / 2, [&]()
+		{
+			registry.GetView<Violet::TransformComponent, VelocityComponent>().Each([](Violet::EntityID p_Entity, Violet::TransformComponent& p_Transform, const VelocityComponent& p_Velocity)
+			{
+				p_Transform.Translation.x += p_Velocity.Velocity.x;
+				p_Transform.Translation.y += p_Velocity.Velocity.y;
+			});
+		});
+
+		scene.UpdateTransforms();
+		BenchRunner::Run("Scene/UpdateTransforms, Unchanged", 1, s_EntityCount, [&]()
+		{
+			scene.UpdateTransforms();
+		});
+
+		// Includes the view pass changing every rotation.
+		Violet::TransformHierarchy& hierarchy = scene.GetTransformHierarchy();
+		BenchRunner::Run("Scene/UpdateTransforms, All Changed", 1, s_EntityCount, [&]()
+		{
+			registry.GetView<Violet::TransformComponent>().Each([&hierarchy](Violet::EntityID p_Entity, Violet::TransformComponent& p_Transform)
+			{
+				p_Transform.Rotation += 1.0f;
+				hierarchy.MarkDirty(p_Entity);
+			});
+			scene.UpdateTransforms();
+		});
+
+		BenchRunner::Run("Scene/OnRender, Sprites", 1, s_EntityCount, [&]()
+		{
+			scene.OnRender(camera);
+			Violet::Renderer2D::EndFrame();
+		});
+
+		// A tenth of each axis, the spatial index skips the rest.
+		Violet::OrthographicCamera closeCamera(0.0f, s_GridWidth * 0.1f, 0.0f, s_EntityCount / s_GridWidth * 0.1f);
+		closeCamera.SetPosition({ s_GridWidth * 0.45f, s_EntityCount / s_GridWidth * 0.45f, 0.0f });
+		BenchRunner::Run("Scene/OnRender, Sprites, 1% In View", 1, s_EntityCount / 100, [&]()
+		{
+			scene.OnRender(closeCamera);
+			Violet::Renderer2D::EndFrame();
+		});
+
+		BenchRunner::Run("Scene/PickEntity", 1000, 1, [&]()
+		{
+			for (uint32_t i = 0; i < 1000; i++)
+			{
+				Violet::Entity entity = scene.PickEntity({ (i * 7919) % s_GridWidth + 0.25f, (i * 104729) % (s_EntityCount / s_GridWidth) + 0.25f });
+				BenchRunner::KeepValue(&entity);
+			}
+		});
+	}
+
+	{
+		// Chains of four, moving one root in a hundred moves the four entities under it.
+		Violet::Scene scene;
+		Violet::Entity parent;
+		std::vector<Violet::Entity> roots;
+		for (uint32_t i = 0; i < s_EntityCount; i++)
+		{
+			Violet::Entity entity = scene.CreateEntity();
+			entity.GetComponent<Violet::TransformComponent>().Translation = { 1.0f, 0.0f, 0.0f };
+			if (i % 4 == 0)
+				roots.push_back(entity);
+			else
+				entity.SetParent(parent);
+			parent = entity;
+		}
+
+		scene.UpdateTransforms();
+		BenchRunner::Run("Scene/UpdateTransforms, Hierarchy, 1% Of Roots Moved", 1, s_EntityCount, [&]()
+		{
+			for (size_t i = 0; i < roots.size(); i += 100)
+			{
+				roots[i].GetComponent<Violet::TransformComponent>().Translation.y += 1.0f;
+				roots[i].MarkTransformDirty();
+			}
+			scene.UpdateTransforms();
+		});
+		VT_INFO("    {0} of {1} world matrices rebuilt per update", scene.GetTransformHierarchy().GetUpdatedCount(), s_EntityCount);
+	}
+
+	// The same quads through every Renderer2D path.
+	std::vector<glm::vec3> positions(s_EntityCount);
+	std::vector<Violet::Texture2D*> quadTextures(s_EntityCount);
+	for (uint32_t i = 0; i < s_EntityCount; i++)
+	{
+		positions[i] = { (float)(i % s_GridWidth), (float)(i / s_GridWidth), 0.0f };
+		quadTextures[i] = textures[(i / 64) % s_TextureCount].get();
+	}
+	glm::vec2 size = { 0.9f, 0.9f };
+	glm::vec4 color = { 0.8f, 0.2f, 0.3f, 1.0f };
+
+	BenchRunner::Run("Scene/Renderer2D DrawRotatedQuad", 1, s_EntityCount, [&]()
+	{
+		Violet::Renderer2D::BeginScene(camera);
+		for (uint32_t i = 0; i < s_EntityCount; i++)
+		{
+			Violet::Ref<Violet::Texture2D> texture(quadTextures[i]);
+			Violet::Renderer2D::DrawRotatedQuad(positions[i], size, (float)(i % 360), texture, 1.0f, color);
+		}
+		Violet::Renderer2D::EndScene();
+		Violet::Renderer2D::EndFrame();
+	});
+
+	std::vector<glm::mat4> transforms(s_EntityCount);
+	for (uint32_t i = 0; i < s_EntityCount; i++)
+	{
+		transforms[i] = glm::translate(glm::mat4(1.0f), positions[i])
+			* glm::rotate(glm::mat4(1.0f), glm::radians((float)(i % 360)), { 0.0f, 0.0f, 1.0f })
+			* glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
+	}
+
+	BenchRunner::Run("Scene/Renderer2D DrawQuad, Cached Matrix", 1, s_EntityCount, [&]()
+	{
+		Violet::Renderer2D::BeginScene(camera);
+		for (uint32_t i = 0; i < s_EntityCount; i++)
+		{
+			Violet::Ref<Violet::Texture2D> texture(quadTextures[i]);
+			Violet::Renderer2D::DrawQuad(transforms[i], texture, 1.0f, color);
+		}
+		Violet::Renderer2D::EndScene();
+		Violet::Renderer2D::EndFrame();
+	});
+
+	// What the sprite renderer system hands over after culling.
+	std::vector<Violet::Renderer2D::Sprite> sprites(s_EntityCount);
+	for (uint32_t i = 0; i < s_EntityCount; i++)
+		sprites[i] = { glm::vec3(transforms[i][3]), glm::vec2(transforms[i][0]), glm::vec2(transforms[i][1]), color, quadTextures[i], 1.0f };
+
+	BenchRunner::Run("Scene/Renderer2D DrawSprites", 1, s_EntityCount, [&]()
+	{
+		Violet::Renderer2D::BeginScene(camera);
+		Violet::Renderer2D::DrawSprites(sprites.data(), (uint32_t)sprites.size());
+		Violet::Renderer2D::EndScene();
+		Violet::Renderer2D::EndFrame();
+	});
+
+	transforms.clear();
+	sprites.clear();
+	textures.clear();
+	Violet::Renderer::Shutdown();
+}
\ No newline at end of file
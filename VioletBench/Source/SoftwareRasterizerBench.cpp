@@ -0,0 +1,114 @@
+/////////////////
+///
+/// SoftwareRasterizerBench.cpp
+/// Violet McAllister
+/// August 6th, 2022
+///
+/// Measures the Software renderer end to end:
+/// Renderer2D batches go through the tiled
+/// SoftwareRasterizer, throughput is given in
+/// shaded pixels per second.
+///
+/////////////////
+
+#include <vector>
+
+#include <Violet/Core/Base.h>
+#include <Violet/Core/JobSystem.h>
+#include <Violet/Core/Log.h>
+#include <Violet/Renderer/RenderCommand.h>
+#include <Violet/Renderer/Renderer.h>
+#include <Violet/Renderer/Renderer2D.h>
+
+#include "Benchmarks.h"
+#include "BenchRunner.h"
+
+static constexpr uint32_t s_Width = 1280;
+static constexpr uint32_t s_Height = 720;
+static constexpr uint32_t s_QuadSize = 32;
+static constexpr uint32_t s_QuadCount = 4000;
+static constexpr uint32_t s_TextureSize = 64;
+
+/**
+ * @brief Draws one frame of pixel sized quads, spread over the
+ * framebuffer with about two layers of overdraw.
+ * @param p_Camera The camera, one unit per pixel.
+ * @param p_DrawQuad Draws a quad at a position.
+ */
+template<typename F>
+static void DrawFrame(const Violet::OrthographicCamera& p_Camera, const F& p_DrawQuad)
+{
+	Violet::RenderCommand::Clear();
+	Violet::Renderer2D::BeginScene(p_Camera);
+
+	uint32_t state = 0x12345678;
+	for (uint32_t i = 0; i < s_QuadCount; i++)
+	{
+		// Same xorshift sequence every frame, so every repetition shades the same pixels.
+		state ^= state << 13; state ^= state >> 17; state ^= state << 5;
+		float x = (float)(state % (s_Width - s_QuadSize)) + s_QuadSize * 0.5f;
+		float y = (float)((state >> 16) % (s_Height - s_QuadSize)) + s_QuadSize * 0.5f;
+		p_DrawQuad(glm::vec2(x, y));
+	}
+
+	Violet::Renderer2D::EndScene();
+	Violet::Renderer2D::EndFrame();
+}
+
+/**
+ * @brief Runs one frame benchmark and logs how much of the
+ * framebuffer it covered.
+ * @param p_Name The name of the benchmark.
+ * @param p_Camera The camera of the frame.
+ * @param p_DrawQuad Draws a quad at a position.
+ */
+template<typename F>
+static void RunFrame(const char* p_Name, const Violet::OrthographicCamera& p_Camera, const F& p_DrawQuad)
+{
+	BenchRunner::Run(p_Name, 1, (uint64_t)s_QuadCount * s_QuadSize * s_QuadSize, [&]() { DrawFrame(p_Camera, p_DrawQuad); });
+
+	// Reading back also checks the frame was actually drawn.
+	static std::vector<uint32_t> s_Pixels(s_Width * s_Height);
+	Violet::RenderCommand::ReadPixels(0, 0, s_Width, s_Height, s_Pixels.data());
+
+	uint32_t covered = 0;
+	for (uint32_t pixel : s_Pixels)
+		covered += pixel != s_Pixels[0] ? 1 : 0;
+	VT_INFO("    {0:.1f}% of the {1}x{2} framebuffer covered", covered * 100.0 / s_Pixels.size(), s_Width, s_Height);
+}
+
+void RunSoftwareRasterizerBench()
+{
+	// Tiles are shaded on the job system, the calling thread joins in.
+	Violet::JobSystem::Init();
+	Violet::RendererAPI::SetAPI(Violet::RendererAPI::API::Software);
+	Violet::Renderer::Init();
+	Violet::Renderer::OnWindowResize(s_Width, s_Height);
+	Violet::RenderCommand::SetClearColor({ 0.0f, 0.0f, 0.0f, 1.0f });
+
+	std::vector<uint32_t> checker(s_TextureSize * s_TextureSize);
+	for (uint32_t i = 0; i < checker.size(); i++)
+		checker[i] = (((i % s_TextureSize) / 8 + (i / s_TextureSize) / 8) & 1) ? 0xffffffff : 0xff3f7fbf;
+	Violet::Ref<Violet::Texture2D> texture = Violet::Texture2D::Create(s_TextureSize, s_TextureSize);
+	texture->SetData(checker.data(), (uint32_t)(checker.size() * sizeof(uint32_t)));
+
+	Violet::OrthographicCamera camera(0.0f, (float)s_Width, 0.0f, (float)s_Height);
+	glm::vec2 size = { (float)s_QuadSize, (float)s_QuadSize };
+	glm::vec4 color = { 0.8f, 0.2f, 0.3f, 1.0f };
+
+	VT_INFO("SoftwareRasterizer, {0} {1}x{1} Quads Per Frame, Pixels Per Second:", s_QuadCount, s_QuadSize);
+
+	RunFrame("SoftwareRasterizer/Quads, Color", camera, [&](const glm::vec2& p_Position)
+	{
+		Violet::Renderer2D::DrawQuad(p_Position, size, color);
+	});
+
+	RunFrame("SoftwareRasterizer/Quads, Texture", camera, [&](const glm::vec2& p_Position)
+	{
+		Violet::Renderer2D::DrawQuad(p_Position, size, texture);
+	});
+
+	texture = nullptr;
+	Violet::Renderer::Shutdown();
+	Violet::JobSystem::Shutdown();
+}
\ No newline at end of file
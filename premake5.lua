@@ -1,3 +1,8 @@
+newoption {
+	trigger = "track-allocations",
+	description = "Hook the global allocator and attribute allocations to profile scopes"
+}
+
 workspace "Violet"
 	architecture "x86_64"
 
@@ -13,6 +18,10 @@ workspace "Violet"
 		"MultiProcessorCompile"
 	}
 
+	filter "options:track-allocations"
+		defines "VT_TRACK_ALLOCATIONS"
+	filter {}
+
 outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
 
 IncludeDir = {
@@ -24,8 +33,11 @@ IncludeDir = {
 }
 
 group "Dependencies"
-	include "Violet/Dependencies/GLFW"
-	include "Violet/Dependencies/Glad"
+	-- Linux builds are headless and never open a GLFW window.
+	if not os.istarget("linux") then
+		include "Violet/Dependencies/GLFW"
+	end
+	include "Violet/Dependencies/GLAD"
 	include "Violet/Dependencies/imgui"
 group ""
 
@@ -64,35 +76,56 @@ project "Violet"
 	}
 
 	links {
-		"GLFW",
 		"Glad",
-		"ImGui",
-		"opengl32.lib"
+		"ImGui"
 	}
 
 	filter "system:windows"
 		staticruntime "On"
 		systemversion "latest"
 
+		removefiles {
+			"%{prj.name}/Source/Platform/Linux/**",
+			"%{prj.name}/Source/Platform/OpenGL/OpenGLHeadlessContext.*"
+		}
+
+		links {
+			"GLFW",
+			"opengl32.lib"
+		}
+
 		postbuildcommands {
 			("{COPY} %{cfg.buildtarget.relpath} \"../bin/" .. outputdir .. "/Sandbox/\"")
 		}
 
+	-- Linux is headless: EGL with Mesa's software rasterizer, no GLFW.
+	filter "system:linux"
+		removefiles {
+			"%{prj.name}/Source/Platform/Windows/**",
+			"%{prj.name}/Source/Platform/OpenGL/OpenGLContext.*"
+		}
+
 	filter "configurations:Debug"
 		defines "VT_DEBUG"
-		buildoptions "/MDd"
 		symbols "on"
 
 	filter "configurations:Release"
 		defines "VT_RELEASE"
-		buildoptions "/MD"
 		optimize "on"
 
 	filter "configurations:Dist"
 		defines "VT_DIST"
-		buildoptions "/MD"
 		optimize "on"
 
+	filter { "system:windows", "configurations:Debug" }
+		buildoptions "/MDd"
+
+	filter { "system:windows", "configurations:Release" }
+		buildoptions "/MD"
+
+	filter { "system:windows", "configurations:Dist" }
+		buildoptions "/MD"
+
 project "Sandbox"
 	location "Sandbox"
 	kind "ConsoleApp"
@@ -123,17 +156,149 @@ project "Sandbox"
 		staticruntime "On"
 		systemversion "latest"
 
+	-- Static libraries do not carry their links on Linux.
+	filter "system:linux"
+		links {
+			"Glad",
+			"ImGui",
+			"EGL",
+			"pthread",
+			"dl"
+		}
+
 	filter "configurations:Debug"
 		defines "VT_DEBUG"
+		symbols "on"
+
+	filter "configurations:Release"
+		defines "VT_RELEASE"
+		optimize "on"
+
+	filter "configurations:Dist"
+		defines "VT_DIST"
+		optimize "on"
+
+	filter { "system:windows", "configurations:Debug" }
 		buildoptions "/MDd"
+
+	filter { "system:windows", "configurations:Release" }
+		buildoptions "/MD"
+
+	filter { "system:windows", "configurations:Dist" }
+		buildoptions "/MD"
+
+project "VioletBench"
+	location "VioletBench"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "on"
+
+	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
+
+	-- Renderer2D reads its shaders from the Sandbox assets.
+	debugdir "Sandbox"
+
+	files {
+		"%{prj.name}/Source/**.h", "%{prj.name}/Source/**.cpp"
+	}
+
+	includedirs {
+		"Violet/Dependencies/spdlog/include",
+		"Violet/Source",
+		"Violet/Dependencies",
+		"%{IncludeDir.glm}"
+	}
+
+	links {
+		"Violet"
+	}
+
+	-- Results are logged at info level, keep them in optimized builds.
+	defines {
+		"VT_LOG_LEVEL=VT_LOG_LEVEL_INFO"
+	}
+
+	filter "system:windows"
+		cppdialect "C++17"
+		staticruntime "On"
+		systemversion "latest"
+
+	-- Static libraries do not carry their links on Linux.
+	filter "system:linux"
+		links {
+			"Glad",
+			"ImGui",
+			"EGL",
+			"pthread",
+			"dl"
+		}
+
+	filter "configurations:Debug"
+		defines "VT_DEBUG"
 		symbols "on"
 
 	filter "configurations:Release"
 		defines "VT_RELEASE"
+		optimize "on"
+
+	filter "configurations:Dist"
+		defines "VT_DIST"
+		optimize "on"
+
+	filter { "system:windows", "configurations:Debug" }
+		buildoptions "/MDd"
+
+	filter { "system:windows", "configurations:Release" }
 		buildoptions "/MD"
+
+	filter { "system:windows", "configurations:Dist" }
+		buildoptions "/MD"
+
+group "Tools"
+
+project "LogDecoder"
+	location "Tools/LogDecoder"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "on"
+
+	targetdir ("bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("bin-int/" .. outputdir .. "/%{prj.name}")
+
+	files {
+		"Tools/%{prj.name}/Source/**.h", "Tools/%{prj.name}/Source/**.cpp"
+	}
+
+	includedirs {
+		"Violet/Dependencies/spdlog/include",
+		"Violet/Source"
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+
+	filter "configurations:Debug"
+		defines "VT_DEBUG"
+		symbols "on"
+
+	filter "configurations:Release"
+		defines "VT_RELEASE"
 		optimize "on"
 
 	filter "configurations:Dist"
 		defines "VT_DIST"
+		optimize "on"
+
+	filter { "system:windows", "configurations:Debug" }
+		buildoptions "/MDd"
+
+	filter { "system:windows", "configurations:Release" }
 		buildoptions "/MD"
-		optimize "on" 
\ No newline at end of file
+
+	filter { "system:windows", "configurations:Dist" }
+		buildoptions "/MD"
+
+group ""
\ No newline at end of file